@@ -12,8 +12,6 @@
 #include <ESP32Time.h>				// NTP time server
 #include <AsyncTCP.h>				// TCP socket
 #include <ESPAsyncWebSrv.h>			// Web server
-#include <ArduinoJson.h>			// ArduinoJson
-#include <ArduinoJson.hpp>			// ArduinoJson
 #include <SPI.h>					// SPI library
 #include <FS.h>						// Files system library
 #include <SD.h>						// SD Card library
@@ -26,9 +24,8 @@
 #include "touchCalibrate.h"			// Calibrate touch screen.
 #include "drawBitmap.h"				// Draw bitmaps
 #include "colours.h"				// Colour pallette
-#include "startScreen.h"			// Start image
 #include "screenLayout.h"			// Screen layout
-#include "icons.h"					// More icons
+#include "iconAssets.h"				// More icons
 #include "Free_Fonts.h"				// Additional fonts
 #include "global.h"					// Global variables
 #include "wifiSystem.h"				// WiFi & Web Server
@@ -36,6 +33,16 @@
 #include "fileOperations.h"			// File operations
 #include "mainDisplay.h"			// Display layout
 #include "parseDataReceived.h"		// CSV file operations
+#include "serialRingBuffer.h"		// UART ring buffer
+#include "eventQueue.h"				// Detection queue & SD persistence task
+#include "binaryLog.h"				// Fixed record event log
+#include "glyphCache.h"				// Cached font glyphs
+#include "screenWidgets.h"			// Buttons, status icons & title
+#include "userInterface.h"			// Menus & dialogs
+#include "touchInput.h"				// Debounced touch events
+#include "displayPower.h"			// Backlight & panel sleep
+#include "spiBus.h"					// Shared SPI bus
+#include "statsRollup.h"				// Hourly, daily & category counts
 
 // Debug serial prints
 
@@ -59,6 +66,7 @@
 #define TFT_RST  22
 #define TFT_MISO 19
 #define TOUCH_CS 14
+#define TOUCH_IRQ -1				// XPT2046 PENIRQ, -1 when not wired and the controller is polled
 
 // SD card interface
 
@@ -82,8 +90,7 @@ const byte calTouchScreenPin = 35;	// Calibrate touch screen
 
 // TFT back light sleep
 
-unsigned long sleepT = 0;
-unsigned long sleepTime = 300000;	// Reset to 300,000 when finished with design (5 minutes sleep time).
+// See displayPower.h & displayPower.cpp
 
 // TFT calibration
 
@@ -139,6 +146,8 @@ void setup() {
 
 	Serial2.begin(115200, SERIAL_8N1, RXD2, TXD2);	// Initialize UART
 
+	beginSerialRing(Serial2);						// Feed received bytes into the ring buffer
+
 	delay(100);
 
 	outputDebugLn("");
@@ -165,10 +174,9 @@ void setup() {
 
 	digitalWrite(TFT_LED, HIGH);			// Output for LCD back light
 
-	// Set all SPI chip selects to HIGH to stablise SPI bus
+	// Set all SPI chip selects to HIGH to stablise SPI bus, and create the lock that shares it
 
-	digitalWrite(TOUCH_CS, HIGH);			// Touch controller chip select
-	digitalWrite(TFT_CS, HIGH);				// TFT screen chip select
+	beginSpiBus(TFT_CS, TOUCH_CS, sdCS);
 
 	// Initialize SPIFFS
 
@@ -185,12 +193,9 @@ void setup() {
 		outputDebugLn("SPIFFS mounted successfully");
 	}
 
-	// Initialize SD card
-
-	digitalWrite(sdCS, LOW);				// TFT screen chip select
-	digitalWrite(TFT_CS, HIGH);				// TFT screen chip select
+	// Initialize SD card, the library drives its own chip select
 
-	if (!SD.begin(sdCS)) {
+	if (!SD.begin(sdCS, SPI, busClock(busSD))) {
 		outputDebugLn("");
 		outputDebugLn("SD initialization failed!");
 
@@ -233,6 +238,8 @@ void setup() {
 
 	tft.setRotation(3);
 	tft.setCursor(0, 0);
+
+	beginGlyphCache();						// Rasterise the table & status line font
 	
 	digitalWrite(TFT_LED, LOW);				// LOW to turn backlight on
 
@@ -240,7 +247,7 @@ void setup() {
 
 	tft.fillScreen(WHITE);
 
-	drawBitmap(tft, 40, 96, startScreen, 128, 128);
+	drawIcon(tft, 40, 96, startScreen);
 
 	tft.setFreeFont(&FreeSans12pt7b);
 	tft.setTextSize(1);
@@ -309,6 +316,8 @@ void setup() {
 	// Set calibration
 
 	tft.setTouch(calData);
+
+	beginTouchInput(TOUCH_IRQ);
 	
 	outputDebugLn("");
 
@@ -402,52 +411,62 @@ void setup() {
 
 	delay(100);
 
+	// Open the binary event log, built from the CSV file the first time
+
+#if BINARY_LOG
+	binaryLogBegin(SD, fileName);
+	statsBegin(SD);
+#endif
+
 	// Populate temporary screen array from the CSV file
 
 	populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
 
 	delay(100);
 
+	// Start writing detections to SD from their own task
+
+	startPersistenceTask();
+
+	// Backlight sleep timer starts now the display is on
+
+	beginDisplayPower(TFT_LED);
+
 	// Draw border and buttons at start.
 
 	tft.fillScreen(WHITE);								// Clear screen
 
+	invalidateWidgets();								// Nothing the widgets drew is on screen now
+
 	drawBorder();										// Screen border layouts.
 
 	Serial.println("");
 
-	printLocalTime();									// Redisplay date & time
+	printLocalTime(true);								// Redisplay date & time, the screen has just been cleared
 
 	// Status icons - SD Card
 
-	if (!SD.exists(fileName)) (
+	if (!SD.exists(fileName)) setStatusIcon(sdCardStatus, sdCardRed);
 
-		drawBitmap(tft, SDCARD_ICON_Y, SDCARD_ICON_X, sdCardRed, SDCARD_ICON_W, SDCARD_ICON_H));
-
-
-	else drawBitmap(tft, SDCARD_ICON_Y, SDCARD_ICON_X, sdCardGreen, SDCARD_ICON_W, SDCARD_ICON_H);
+	else setStatusIcon(sdCardStatus, sdCardGreen);
 
 	// Status icons - WiFi
 
 	if ((WiFi.status() != WL_CONNECTED)) {				// Update WiFi icon
 
-		drawBitmap(tft, WIFI_ICON_Y, WIFI_ICON_X, wiFiAmber, WIFI_ICON_W, WIFI_ICON_H); 
+		setStatusIcon(wiFiStatus, wiFiAmber);
 
 	}
 
-	else drawBitmap(tft, WIFI_ICON_Y, WIFI_ICON_X, wiFiGreen, WIFI_ICON_W, WIFI_ICON_H);
+	else setStatusIcon(wiFiStatus, wiFiGreen);
 
 	// Status icons - Sensor
 
-	drawBitmap(tft, PULSE_ICON_Y, PULSE_ICON_X, pulseGreen, PULSE_ICON_W, PULSE_ICON_H);
+	setStatusIcon(pulseStatus, pulseGreen);
 
 	// Main title
 
-	tft.setFreeFont(&FreeSans9pt7b);
-	tft.setTextSize(1);
-	tft.setTextColor(BLACK);
-	tft.setCursor(13, 26);
-	tft.print("Siren Monitor");
+	setTitle("Siren Monitor");
 
 	// Clear serial buffer
 
@@ -457,9 +476,13 @@ void setup() {
 
 	updateTable();
 
-	// Update webserver
+	// Number web page events from here, rows count from the end of the log
 
-	updateWebServer();
+#if BINARY_LOG
+	beginWebEvents(binaryLogReady() ? binaryLogCount() : 0);
+#else
+	beginWebEvents(0);
+#endif
 
 } // Close setup
 
@@ -471,384 +494,69 @@ void loop() {
 
 	if (screenMenu == true) {
 
-		drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, categoriseEvents, BUTTON1_W - 2, BUTTON1_H - 2);
-		tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-
-		drawBitmap(tft, BUTTON2_Y + 1, BUTTON2_X + 1, manualEntry, BUTTON2_W - 2, BUTTON2_H - 2);
-		tft.drawRect(BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, WHITE);
-
-		drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-		tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
+		showMainMenu();
 
 		screenMenu = false;
 
 	}
 
-	// TFT backlight sleep mode
-
-	if (millis() >= sleepT + sleepTime) {
+	// TFT backlight sleep mode, not while a dialog is open
 
-		digitalWrite(TFT_LED, HIGH);		// Output for LCD back light.
+	displayPoll(uiCurrentState() == uiIdle);
 
-	}
+	// Touch events, the controller is only read when PENIRQ says the screen is touched
 
-	// Check for touch data
+	pollTouchInput();
 
-	uint16_t x, y;		// variables for touch data.
+	touchEvent touch;
 
-	if (tft.getTouch(&x, &y)) {
+	while (nextTouchEvent(touch)) {
 
 		// Restart TFT backlight sleep timer.
 
-		sleepT = millis();
-
-		// Button one
-
-		if ((x > BUTTON1_X) && (x < (BUTTON1_X + BUTTON1_W))) {
-			if ((y > BUTTON1_Y) && (y <= (BUTTON1_Y + BUTTON1_H))) {
-
-				playTone(buzzerP, buzzerF, buzzerD);
-
-				outputDebug("Button 1 pressed ");
-				outputDebugLn("");
-
-				tft.fillRect(15, 60, 233, 40, LTRED);
-				tft.setFreeFont(&FreeSans12pt7b);
-				tft.setTextSize(1);
-				tft.setTextColor(DKBLUE);
-				tft.setCursor(25, 88);
-				tft.print("Update categories?");
-				
-				delay(1500);
-
-				// Check
-
-				bool response = areYouSure();
-
-				// Update screen layout
-
-				if (response == true) {
-
-					drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, policeCar, BUTTON1_W - 2, BUTTON1_H - 2);
-					tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-					drawBitmap(tft, BUTTON2_Y + 1, BUTTON2_X + 1, ambulance, BUTTON2_W - 2, BUTTON2_H - 2);
-					tft.drawRect(BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, WHITE);
-					drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, fireEngine, BUTTON3_W - 2, BUTTON3_H - 2);
-					tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-					drawBitmap(tft, BUTTON4_Y + 1, BUTTON4_X + 1, falsePositive, BUTTON4_W - 2, BUTTON4_H - 2);
-					tft.drawRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-					
-					categorizeEntries(SD, fileName);
-
-					drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, categoriseEvents, BUTTON1_W - 2, BUTTON1_H - 2);
-					tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-					
-					drawBitmap(tft, BUTTON2_Y + 1, BUTTON2_X + 1, manualEntry, BUTTON2_W - 2, BUTTON2_H - 2);
-					tft.drawRect(BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, WHITE);
-
-					drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-					tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-
-					tft.fillRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-
-					populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
-					updateTable();
-
-				}
-
-				else {
-
-					drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, categoriseEvents, BUTTON1_W - 2, BUTTON1_H - 2);
-					tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-					
-					populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
-					updateTable();
-				}
-	
-			}
-
-		}
-
-		// Button Two
-
-		if ((x > BUTTON2_X) && (x < (BUTTON2_X + BUTTON2_W))) {
-			if ((y > BUTTON2_Y) && (y <= (BUTTON2_Y + BUTTON2_H))) {
-
-				playTone(buzzerP, buzzerF, buzzerD);
-
-				outputDebug("Button 2 pressed ");
-				outputDebugLn("");
-
-				tft.fillRect(15, 60, 233, 40, LTRED);
-				tft.setFreeFont(&FreeSans12pt7b);
-				tft.setTextSize(1);
-				tft.setTextColor(DKBLUE);
-				tft.setCursor(33, 88);
-				tft.print("Add manual entry?");
-				
-				delay(1500);
-
-				// Check
-
-				bool response = areYouSure();
-
-				// Update screen layout
-
-				if (response == true) {
-
-					tft.fillRect(15, 60, 233, 40, LTRED);
-					tft.setFreeFont(&FreeSans12pt7b);
-					tft.setTextSize(1);
-					tft.setTextColor(DKBLUE);
-					tft.setCursor(50, 88);
-					tft.print("Select category");
-
-					drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, policeCar, BUTTON1_W - 2, BUTTON1_H - 2);
-					tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-					drawBitmap(tft, BUTTON2_Y + 1, BUTTON2_X + 1, ambulance, BUTTON2_W - 2, BUTTON2_H - 2);
-					tft.drawRect(BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, WHITE);
-					drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, fireEngine, BUTTON3_W - 2, BUTTON3_H - 2);
-					tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-					drawBitmap(tft, BUTTON4_Y + 1, BUTTON4_X + 1, falsePositive, BUTTON4_W - 2, BUTTON4_H - 2);
-					tft.drawRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-
-					addManualEntry(SD, fileName);
-
-					drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, categoriseEvents, BUTTON1_W - 2, BUTTON1_H - 2);
-					tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-
-					drawBitmap(tft, BUTTON2_Y + 1, BUTTON2_X + 1, manualEntry, BUTTON2_W - 2, BUTTON2_H - 2);
-					tft.drawRect(BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, WHITE);
-
-					drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-					tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-
-					tft.fillRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-
-					populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
-					updateTable();
-
-					tft.fillRect(15, 60, 233, 40, LTRED);
-					tft.setFreeFont(&FreeSans12pt7b);
-					tft.setTextSize(1);
-					tft.setTextColor(DKBLUE);
-					tft.setCursor(25, 88);
-					tft.print("Manual entry added");
+		displayActivity();
 
-					delay(1500);
+		if (touch.type != touchPress) continue;
 
-					populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
-					updateTable();
+		// A press on a dark screen only wakes it, so nothing is done blind
 
-				}
+		if (!displayAwake()) {
 
-			}
+			playTone(buzzerP, buzzerF, buzzerD);
+			displayWake();
 
-			else {
-
-				drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, categoriseEvents, BUTTON1_W - 2, BUTTON1_H - 2);
-				tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-
-				drawBitmap(tft, BUTTON2_Y + 1, BUTTON2_X + 1, manualEntry, BUTTON2_W - 2, BUTTON2_H - 2);
-				tft.drawRect(BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, WHITE);
-
-				drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-				tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-
-				populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
-				updateTable();
-			}
-
-		}
-
-		// Button three
-
-		if ((x > BUTTON3_X) && (x < (BUTTON3_X + BUTTON3_W))) {
-			if ((y > BUTTON3_Y) && (y <= (BUTTON3_Y + BUTTON3_H))) {
-
-				playTone(buzzerP, buzzerF, buzzerD);
-
-				outputDebug("Button 3 pressed ");
-				outputDebugLn("");
-
-				tft.fillRect(15, 60, 233, 40, LTRED);
-				tft.setFreeFont(&FreeSans12pt7b);
-				tft.setTextSize(1);
-				tft.setTextColor(DKBLUE);
-				tft.setCursor(40, 88);
-				tft.print("Delete last entry?");
-				
-				delay(1500);
-
-				// Check
-
-				bool response = areYouSure();
-
-				drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-				tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-
-				// Update screen layout
-
-				if (response == true) {
-
-					deleteLastEntry(SD, fileName);
-
-					tft.fillRect(15, 60, 233, 40, LTRED);
-					tft.setFreeFont(&FreeSans12pt7b);
-					tft.setTextSize(1);
-					tft.setTextColor(DKBLUE);
-					tft.setCursor(35, 88);
-					tft.print("Last entry deleted");
-
-					delay(1500);
-
-					drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, categoriseEvents, BUTTON1_W - 2, BUTTON1_H - 2);
-					tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-
-					drawBitmap(tft, BUTTON2_Y + 1, BUTTON2_X + 1, manualEntry, BUTTON2_W - 2, BUTTON2_H - 2);
-					tft.drawRect(BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, WHITE);
-
-					drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-					tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-
-					tft.fillRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-
-					for (int i = 0; i < maxEntries; i++) {
-						dataEntries[i].title = "";
-						dataEntries[i].date = "";
-						dataEntries[i].time = "";
-						dataEntries[i].category = "";
-						dataEntries[i].percentage = "";
-					}
-
-					populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
-					updateTable();
-
-				}
-
-				else {
-
-					drawBitmap(tft, BUTTON1_Y + 1, BUTTON1_X + 1, categoriseEvents, BUTTON1_W - 2, BUTTON1_H - 2);
-					tft.drawRect(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, WHITE);
-
-					drawBitmap(tft, BUTTON2_Y + 1, BUTTON2_X + 1, manualEntry, BUTTON2_W - 2, BUTTON2_H - 2);
-					tft.drawRect(BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, WHITE);
-
-					drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-					tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-
-					tft.fillRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-
-					for (int i = 0; i < maxEntries; i++) {
-						dataEntries[i].title = "";
-						dataEntries[i].date = "";
-						dataEntries[i].time = "";
-						dataEntries[i].category = "";
-						dataEntries[i].percentage = "";
-					}
-
-					populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
-					updateTable();
-				}
-
-			}
+			outputDebugLn("Display woken");
 
+			continue;
 		}
-                 
-		// Main area - Wake up TFT backlight
-
-		if ((x > FRAME2_X) && (x < (FRAME2_X + FRAME2_W))) {
-			if ((y > FRAME2_Y) && (y <= (FRAME2_Y + FRAME2_H))) {
-
-				playTone(buzzerP, buzzerF, buzzerD);
-				digitalWrite(TFT_LED, LOW);				// Turn TFT backlight on from sleep
-
-				outputDebug("Main frame pressed");
-				outputDebugLn("");
-
-			}
-
-		}
-
-		// SD Card
-
-		if ((x > SDCARD_ICON_X) && (x < (SDCARD_ICON_X + SDCARD_ICON_W))) {
-			if ((y > SDCARD_ICON_Y) && (y <= (SDCARD_ICON_Y + SDCARD_ICON_H))) {
-
-				playTone(buzzerP, buzzerF, buzzerD);
-
-				outputDebug("SD Icon Pressed");
-				outputDebugLn("");
-
-				tft.fillRect(15, 60, 233, 40, LTRED);
-				tft.setFreeFont(&FreeSans12pt7b);
-				tft.setTextSize(1);
-				tft.setTextColor(DKBLUE);
-				tft.setCursor(60, 88);
-				tft.print("Data file copy");
 
-				delay(1500);
+		uiTouch(touch.x, touch.y);
 
-				bool response = (createDataCopy(SD, fileName));
-
-				if  (response == true) { 	// Take a copy of the data file, incrementing number
-
-					drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-					tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-						
-					tft.fillRect(15, 60, 233, 40, LTRED);
-					tft.setFreeFont(&FreeSans12pt7b);
-					tft.setTextSize(1);
-					tft.setTextColor(DKBLUE);
-					tft.setCursor(50, 88);
-					tft.print("Data file copied");
-
-					delay(1500);
-
-				}
-
-				else {
-
-					drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, deleteLastLine, BUTTON3_W - 2, BUTTON3_H - 2);
-					tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-
-					tft.fillRect(15, 60, 233, 40, LTRED);
-					tft.setFreeFont(&FreeSans12pt7b);
-					tft.setTextSize(1);
-					tft.setTextColor(DKBLUE);
-					tft.setCursor(40, 88);
-					tft.print("Abort copy / error");
-
-					delay(1500);
-
-				}
+	}
 
-				populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
-				updateTable();
-			}
+	// Move any open dialog on, none of its steps wait so everything below keeps running
 
-		}
-
-	}
+	uiTick();
 
 	// Check for serial communication from Nano BLE
 
-	if (Serial2.available()) {
+	if (serialRingAvailable()) {
 
 		parseData();
 
 	}
 
-	// If event detected from Arduino Nano is received, update TFT table
+	// If event detected from Arduino Nano is received, update TFT table. The array already
+	// holds the new entry, so there is no need to wait for the persistence task to write it.
+	// An open dialog covers the table, it is redrawn when the dialog closes.
 
-	if (newDataReceived == true) {
+	if (newDataReceived == true && uiCurrentState() == uiIdle) {
 
-		populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
 		updateTable();
 
 	}
 
-	// Update time, date and refresh webserver
+	// Update time and date, the web page is sent each change as it happens
 
 	if (millis() - timeCheck >= timeCheckPeriod) {
 
@@ -856,10 +564,6 @@ void loop() {
 
 		timeCheck = millis();
 
-		// Update web server
-
-		updateWebServer();
-
 	}
 
 	// Check Arduino Nano BLE Sense is alive
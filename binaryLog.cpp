@@ -0,0 +1,823 @@
+//
+// binaryLog.cpp
+//
+
+// Main libraries
+
+#include <FS.h>						// Files system library
+
+// Local declarations
+
+#include "binaryLog.h"
+#include "fileOperations.h"
+#include "parseDataReceived.h"
+#include "statsRollup.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// File name
+
+const char* binaryLogName = "/data.bin";		// Fixed size records, record k is at sizeof(header) + k * 16
+
+// Variables
+
+static File binFile;							// Kept open for reading, appending and in place updates
+static fs::FS* binFs = nullptr;					// File system the log lives on
+static binaryLogHeader header;					// Copy of the header, holds the title table
+static uint32_t recordCount = 0;				// Whole records in the file
+static bool binDirty = false;					// Appended records not yet committed
+static uint32_t newestEpoch = 0;				// Time of the last record, an append before it clears header.ordered
+
+/*---------------------------------------------------------------- */
+
+// CRC32 (IEEE), half byte table to keep flash use small
+
+uint32_t crc32(const void* data, size_t length) {
+
+	static const uint32_t table[16] = {
+		0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+		0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+	};
+
+	const uint8_t* bytes = (const uint8_t*)data;
+	uint32_t crc = 0xFFFFFFFF;
+
+	while (length--) {
+		crc ^= *bytes++;
+		crc = (crc >> 4) ^ table[crc & 0x0F];
+		crc = (crc >> 4) ^ table[crc & 0x0F];
+	}
+
+	return ~crc;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Days since 1970-01-01 for a calendar date
+
+static int32_t daysFromCivil(int year, int month, int day) {
+
+	year -= month <= 2;
+
+	const int era = (year >= 0 ? year : year - 399) / 400;
+	const int yearOfEra = year - era * 400;
+	const int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+	const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+	return era * 146097 + dayOfEra - 719468;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Write the header back to the start of the file
+
+static bool writeHeader() {
+
+	header.crc = crc32(&header, offsetof(binaryLogHeader, crc));
+
+	binFile.seek(0);
+
+	return binFile.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Read record k as it is on the card, false if it couldnt be read
+
+static bool readRecordBytes(uint32_t index, binaryLogRecord& record) {
+
+	if (!binFile || index >= recordCount) return false;
+
+	binFile.seek(sizeof(header) + index * sizeof(binaryLogRecord));
+
+	return binFile.read((uint8_t*)&record, sizeof(record)) == sizeof(record);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Pick up the time of the last record, when it cant be read the next append counts as out of order
+
+static void readNewestEpoch() {
+
+	binaryLogRecord record;
+
+	if (recordCount == 0) newestEpoch = 0;
+	else if (readRecordBytes(recordCount - 1, record)) newestEpoch = record.epoch;
+	else newestEpoch = UINT32_MAX;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Find a title in the header table, adding it if there is room
+
+static uint16_t findTitleId(const char* title) {
+
+	for (uint16_t i = 0; i < maxLogTitles; i++) {
+
+		if (header.titles[i][0] == '\0') {
+
+			size_t length = strnlen(title, logTitleLength - 1);
+
+			memcpy(header.titles[i], title, length);
+			header.titles[i][length] = '\0';
+
+			writeHeader();
+
+			return i;
+		}
+
+		if (strncmp(header.titles[i], title, logTitleLength) == 0) {
+			return i;
+		}
+	}
+
+	return unknownTitleId;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Convert DD-MM-YYYY and HH:MM:SS to seconds since 1970, 0 if the date cannot be read
+
+uint32_t logEpoch(const char* date, const char* time) {
+
+	int day = 0, month = 0, year = 0, hour = 0, minute = 0, second = 0;
+
+	if (sscanf(date, "%d-%d-%d", &day, &month, &year) != 3) return 0;
+
+	sscanf(time, "%d:%d:%d", &hour, &minute, &second);
+
+	return (uint32_t)daysFromCivil(year, month, day) * 86400UL + hour * 3600UL + minute * 60UL + second;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Convert table entry to record
+
+void toBinaryRecord(const bleSignal& entry, binaryLogRecord& record) {
+
+	memset(&record, 0, sizeof(record));
+
+	record.epoch = logEpoch(entry.date, entry.time);
+
+	record.titleId = findTitleId(entry.title);
+
+	// Manual entries are stored as ME-x in the CSV file
+
+	if (strncmp(entry.category, "ME-", 3) == 0) {
+		record.flags |= logFlagManual;
+		record.category = entry.category[3];
+	}
+
+	else {
+		record.category = entry.category[0];
+	}
+
+	record.confidence = (uint8_t)constrain(atoi(entry.percentage), 0, 100);
+
+	record.crc = crc32(&record, offsetof(binaryLogRecord, crc));
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Convert record to table entry
+
+void fromBinaryRecord(const binaryLogRecord& record, bleSignal& entry) {
+
+	memset(&entry, 0, sizeof(entry));
+
+	if (record.titleId < maxLogTitles) {
+		strncpy(entry.title, header.titles[record.titleId], sizeof(entry.title) - 1);
+	}
+
+	else {
+		strcpy(entry.title, "Unknown");
+	}
+
+	time_t epoch = record.epoch;
+	struct tm timeinfo;
+
+	gmtime_r(&epoch, &timeinfo);
+
+	// A 32 bit epoch ends in 2106, the limits only let the compiler see each field fits its buffer
+
+	snprintf(entry.date, sizeof(entry.date), "%02u-%02u-%04u", (unsigned)timeinfo.tm_mday % 100, (unsigned)(timeinfo.tm_mon + 1) % 100,
+		(unsigned)(timeinfo.tm_year + 1900) % 10000);
+	snprintf(entry.time, sizeof(entry.time), "%02u:%02u:%02u", (unsigned)timeinfo.tm_hour % 100, (unsigned)timeinfo.tm_min % 100,
+		(unsigned)timeinfo.tm_sec % 100);
+
+	if (record.flags & logFlagManual) {
+		snprintf(entry.category, sizeof(entry.category), "ME-%c", record.category);
+	}
+
+	else {
+		snprintf(entry.category, sizeof(entry.category), "%c", record.category);
+	}
+
+	snprintf(entry.percentage, sizeof(entry.percentage), "%u%%", record.confidence);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Create an empty log
+
+static bool createLog(fs::FS& fs, const char* binPath) {
+
+	if (binFile) binFile.close();
+
+	File file = fs.open(binPath, FILE_WRITE);
+
+	if (!file) {
+		outputDebugLn("Failed to create binary log");
+		return false;
+	}
+
+	file.close();
+
+	binFile = fs.open(binPath, "r+");
+	binFs = &fs;
+
+	if (!binFile) return false;
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "SMRL", 4);
+	header.version = binaryLogVersion;
+	header.recordSize = sizeof(binaryLogRecord);
+	header.ordered = 1;
+
+	recordCount = 0;
+	newestEpoch = 0;
+
+	return writeHeader();
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Check a record holds the same row as a CSV line, field by field as toBinaryRecord() stores it
+
+static bool sameRow(const binaryLogRecord& record, const bleSignal& entry) {
+
+	bool manual = strncmp(entry.category, "ME-", 3) == 0;
+
+	return record.epoch == logEpoch(entry.date, entry.time)
+		&& record.category == (manual ? entry.category[3] : entry.category[0])
+		&& ((record.flags & logFlagManual) != 0) == manual
+		&& record.confidence == (uint8_t)constrain(atoi(entry.percentage), 0, 100)
+		&& (record.titleId >= maxLogTitles || strncmp(header.titles[record.titleId], entry.title, logTitleLength) == 0);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Compare the newest records with the newest CSV rows. The CSV file is held in RAM for up to
+// logFlushInterval and the log is not, so a power cut can leave either one short.
+
+static bool matchesCSV(fs::FS& fs, const char* csvPath) {
+
+	File csvFile = fs.open(csvPath, FILE_READ);
+
+	if (!csvFile) return true;					// Nothing to rebuild from, keep the log
+
+	int rows = 0;
+	size_t offset = findTailOffset(csvFile, reconcileRows, rows);
+
+	bool match = (uint32_t)rows == min(recordCount, (uint32_t)reconcileRows);
+
+	csvFile.seek(offset);
+
+	for (uint32_t index = recordCount - rows; match && index < recordCount; index++) {
+
+		String line;
+
+		// Blank lines are skipped, the same way findTailOffset does
+
+		do {
+			line = csvFile.readStringUntil('\n');
+			line.trim();
+		} while (line.length() == 0 && csvFile.available());
+
+		binaryLogRecord record;
+
+		match = binaryLogReadRecord(index, record) && sameRow(record, parseCSVLine(line.c_str(), line.length()));
+	}
+
+	csvFile.close();
+
+	return match;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Finish a category change a power cut interrupted. The CSV file is written first, so the record
+// only follows if the CSV byte was changed.
+
+static void finishCategory(fs::FS& fs, const char* csvPath) {
+
+	if (header.pendingOffset == 0) return;
+
+	File csvFile = fs.open(csvPath, FILE_READ);
+
+	bool written = csvFile && csvFile.seek(header.pendingOffset) && csvFile.read() == header.pendingCategory;
+
+	csvFile.close();
+
+	outputDebugLn(written ? "Finishing interrupted category change" : "Dropping interrupted category change");
+
+	if (!written || !binaryLogSetCategory(header.pendingIndex, header.pendingCategory)) {
+
+		header.pendingOffset = 0;
+
+		writeHeader();
+		binFile.flush();
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Open the log, converting the CSV file when there is no valid log yet or the two disagree
+
+bool binaryLogBegin(fs::FS& fs, const char* csvPath) {
+
+	binFile = fs.open(binaryLogName, "r+");
+	binFs = &fs;
+
+	if (binFile) {
+
+		bool valid = binFile.read((uint8_t*)&header, sizeof(header)) == sizeof(header)
+			&& memcmp(header.magic, "SMRL", 4) == 0
+			&& header.version == binaryLogVersion
+			&& header.recordSize == sizeof(binaryLogRecord)
+			&& header.crc == crc32(&header, offsetof(binaryLogHeader, crc));
+
+		if (valid) {
+
+			// A torn final record from a power cut is ignored and later overwritten
+
+			recordCount = (binFile.size() - sizeof(header)) / sizeof(binaryLogRecord);
+
+			readNewestEpoch();
+
+			outputDebug("Binary log records: ");
+			outputDebugLn(recordCount);
+
+			finishCategory(fs, csvPath);
+
+			if (matchesCSV(fs, csvPath)) return true;
+
+			outputDebugLn("Binary log and CSV file disagree");
+		}
+
+		binFile.close();
+	}
+
+	outputDebugLn("No valid binary log, converting CSV file");
+
+	return convertCSVToBinaryLog(fs, csvPath, binaryLogName);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Check the log is open
+
+bool binaryLogReady() {
+
+	return (bool)binFile;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Number of records
+
+uint32_t binaryLogCount() {
+
+	return recordCount;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Add a record
+
+uint32_t binaryLogAppend(const bleSignal& entry) {
+
+	if (!binFile) return noLogRecord;
+
+	binaryLogRecord record;
+
+	toBinaryRecord(entry, record);
+
+	// Time going backwards, from a clock reset, the hour repeated when the clocks go back or a date
+	// that couldnt be read, ends the binary search. The header is written first so a power cut
+	// never leaves the record in a log still marked ordered.
+
+	if (header.ordered && record.epoch < newestEpoch) {
+
+		outputDebugLn("Binary log out of time order");
+
+		header.ordered = 0;
+
+		if (!writeHeader()) {
+			header.ordered = 1;			// Still set on the card, the next append tries again
+			return noLogRecord;
+		}
+	}
+
+	binFile.seek(sizeof(header) + recordCount * sizeof(binaryLogRecord));
+
+	if (binFile.write((const uint8_t*)&record, sizeof(record)) != sizeof(record)) {
+		outputDebugLn("Binary log append failed");
+		return noLogRecord;
+	}
+
+	recordCount++;
+	binDirty = true;
+	newestEpoch = record.epoch;
+
+	statsAdd(recordCount - 1, record);
+
+	return recordCount - 1;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Drop every record from count onwards
+
+bool binaryLogTruncate(uint32_t count) {
+
+	if (!binFile || count >= recordCount) return false;
+
+	// Take the rows out of the stats first, newest first while they can still be read
+
+	for (uint32_t index = recordCount; index-- > count;) {
+
+		binaryLogRecord record = {};
+
+		binaryLogReadRecord(index, record);
+		statsRemove(index, record);
+	}
+
+	// The handle is reopened so it doesnt hold on to the old size
+
+	binFile.close();
+
+	bool truncated = truncateFile(binaryLogName, sizeof(header) + count * sizeof(binaryLogRecord));
+
+	binFile = binFs->open(binaryLogName, "r+");
+
+	if (truncated) {
+		recordCount = count;
+		readNewestEpoch();
+	}
+
+	if (binFile) {
+		header.edits++;
+		writeHeader();
+		binFile.flush();
+	}
+
+	binDirty = false;
+
+	return truncated && binFile;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Commit appended records to the card
+
+void binaryLogSync() {
+
+	if (binFile && binDirty) {
+		binFile.flush();
+		binDirty = false;
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Read record k
+
+bool binaryLogReadRecord(uint32_t index, binaryLogRecord& record) {
+
+	return readRecordBytes(index, record) && record.crc == crc32(&record, offsetof(binaryLogRecord, crc));
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Changes made to records already in the log
+
+uint32_t binaryLogEdits() {
+
+	return header.edits;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Records are in time order
+
+bool binaryLogOrdered() {
+
+	return binFile && header.ordered;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Find the first record at or after epoch. While the log is in time order the fixed record size
+// makes it its own index, and this costs one read per halving.
+
+bool binaryLogFind(uint32_t epoch, uint32_t& index) {
+
+	if (!binaryLogOrdered()) return false;
+
+	uint32_t low = 0;
+	uint32_t high = recordCount;
+
+	while (low < high) {
+
+		uint32_t middle = low + (high - low) / 2;
+		binaryLogRecord record;
+
+		// A record that fails its CRC still has its time, one the card didnt return would steer blind
+
+		if (!readRecordBytes(middle, record)) {
+			outputDebugLn("Binary log read failed");
+			return false;
+		}
+
+		if (record.epoch < epoch) low = middle + 1;
+		else high = middle;
+	}
+
+	index = low;
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Note a category change before the CSV file is written, the header is one write and a torn one
+// fails its CRC, which rebuilds the log from the CSV file
+
+bool binaryLogNoteCategory(uint32_t index, uint32_t csvOffset, char category) {
+
+	if (!binFile) return false;
+
+	header.pendingOffset = csvOffset;
+	header.pendingIndex = index;
+	header.pendingCategory = category;
+
+	if (!writeHeader()) return false;
+
+	binFile.flush();
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Change the category of record k in place, clears the note
+
+bool binaryLogSetCategory(uint32_t index, char category) {
+
+	binaryLogRecord record;
+
+	if (!binaryLogReadRecord(index, record)) return false;
+
+	binaryLogRecord previous = record;
+
+	record.category = category;
+	record.crc = crc32(&record, offsetof(binaryLogRecord, crc));
+
+	// One 16 byte write inside a single sector, a power cut leaves the old record or the new one
+
+	binFile.seek(sizeof(header) + index * sizeof(binaryLogRecord));
+
+	if (binFile.write((const uint8_t*)&record, sizeof(record)) != sizeof(record)) return false;
+
+	// The record is on the card before the note goes, a cut in between just does it again
+
+	binFile.flush();
+
+	// Clears the note and counts the change in the same write
+
+	header.pendingOffset = 0;
+	header.edits++;
+
+	writeHeader();
+	binFile.flush();
+
+	statsSetCategory(index, previous, category);
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Clear the note, left in place a later row at the same offset could be given the category at the next start
+
+bool binaryLogDropCategory() {
+
+	if (!binFile || header.pendingOffset == 0) return false;
+
+	header.pendingOffset = 0;
+
+	if (!writeHeader()) return false;
+
+	binFile.flush();
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Read record k as a table entry
+
+bool binaryLogRead(uint32_t index, bleSignal& entry) {
+
+	binaryLogRecord record;
+
+	if (!binaryLogReadRecord(index, record)) return false;
+
+	fromBinaryRecord(record, entry);
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Read the newest records, newest in position 0
+
+int binaryLogTail(bleSignal* entries, int maxEntries) {
+
+	int found = min((int)recordCount, maxEntries);
+
+	// One seek, then the records are read forwards, oldest goes in the highest position
+
+	binFile.seek(sizeof(header) + (recordCount - found) * sizeof(binaryLogRecord));
+
+	for (int i = found - 1; i >= 0; i--) {
+
+		binaryLogRecord record;
+
+		if (binFile.read((uint8_t*)&record, sizeof(record)) == sizeof(record)
+			&& record.crc == crc32(&record, offsetof(binaryLogRecord, crc))) {
+			fromBinaryRecord(record, entries[i]);
+		}
+
+		else {
+			entries[i] = bleSignal();
+		}
+	}
+
+	for (int i = found; i < maxEntries; i++) {
+		entries[i] = bleSignal();
+	}
+
+	return found;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Rebuild the log from the CSV file
+
+bool convertCSVToBinaryLog(fs::FS& fs, const char* csvPath, const char* binPath) {
+
+	File csvFile = fs.open(csvPath, FILE_READ);
+
+	if (!csvFile) {
+		outputDebugLn("Failed to open CSV file for conversion");
+		return false;
+	}
+
+	if (!createLog(fs, binPath)) {
+		csvFile.close();
+		return false;
+	}
+
+	char chunk[128];
+	char line[maxLineLength];
+	size_t lineLength = 0;
+	bool inLine = false;						// Seen something other than whitespace since the last line ending
+	bool more = true;
+
+	while (more) {
+
+		size_t length = csvFile.read((uint8_t*)chunk, sizeof(chunk));
+
+		// Treat the end of the file as a final line ending
+
+		if (length == 0) {
+			chunk[0] = '\n';
+			length = 1;
+			more = false;
+		}
+
+		for (size_t i = 0; i < length; i++) {
+
+			if (chunk[i] != '\n') {
+				if (!isspace((unsigned char)chunk[i])) inLine = true;
+				if (inLine && lineLength < sizeof(line)) line[lineLength++] = chunk[i];		// Leading whitespace would only be trimmed
+				continue;
+			}
+
+			// Blank lines are skipped so record k matches the k-th row the table sees
+
+			if (inLine) {
+				binaryLogAppend(parseCSVLine(line, lineLength));
+			}
+
+			lineLength = 0;
+			inLine = false;
+		}
+	}
+
+	csvFile.close();
+
+	binaryLogSync();
+
+	outputDebug("Binary log converted, records: ");
+	outputDebugLn(recordCount);
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Write records as CSV lines, carrying on from cursor. Returns the bytes written, 0 once every
+// record is sent. Any buffer size works, a line split across buffers is formatted again.
+
+size_t binaryLogExportCSV(char* buffer, size_t size, exportCursor& cursor) {
+
+	size_t used = 0;
+
+	while (used < size && cursor.next < recordCount) {
+
+		bleSignal entry;
+		char line[maxLineLength];
+
+		if (!binaryLogRead(cursor.next, entry)) {
+			cursor.next++;
+			cursor.offset = 0;
+			continue;
+		}
+
+		size_t length = formatCSVLine(entry, line, sizeof(line) - 2);
+
+		line[length++] = '\r';
+		line[length++] = '\n';
+
+		size_t count = min(length - cursor.offset, size - used);
+
+		memcpy(buffer + used, line + cursor.offset, count);
+
+		used += count;
+		cursor.offset += count;
+
+		if (cursor.offset >= length) {
+			cursor.next++;
+			cursor.offset = 0;
+		}
+	}
+
+	return used;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
@@ -0,0 +1,167 @@
+// binaryLog.h
+
+#ifndef _BINARYLOG_h
+#define _BINARYLOG_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Main libraries
+
+#include <FS.h>						// Files system library
+
+// Local declarations
+
+#include "fileOperations.h"
+
+/*---------------------------------------------------------------- */
+
+// Enable the binary event log alongside the CSV file
+
+#define BINARY_LOG 1
+
+// File name
+
+extern const char* binaryLogName;
+
+// Layout
+
+const uint16_t binaryLogVersion = 5;
+const uint8_t maxLogTitles = 64;			// Distinct titles the log can name, the transmitters send a fixed set
+const uint8_t logTitleLength = titleLength + 1;	// Same width as bleSignal.title
+const uint16_t unknownTitleId = 0xFFFF;		// Title table was full
+const uint32_t noLogRecord = 0xFFFFFFFF;	// Append failed, or there is no log
+
+const uint8_t logFlagManual = 0x01;			// Entry was added by hand, CSV category is ME-x
+
+struct binaryLogHeader {					// Start of the file
+	char magic[4];							// "SMRL"
+	uint16_t version;						// binaryLogVersion
+	uint16_t recordSize;					// sizeof(binaryLogRecord)
+	char titles[maxLogTitles][logTitleLength];	// Title table, records hold an index into it
+	uint32_t pendingOffset;					// CSV file offset of a category being changed, 0 for none
+	uint32_t pendingIndex;					// Record of that row
+	char pendingCategory;					// Category it is being changed to
+	uint8_t ordered;						// 1 while every record is at or after the one before, cleared for good otherwise
+	uint8_t reserved[2];
+	uint32_t edits;							// Category changes and truncations, a stats file that saw fewer is stale
+	uint8_t spare[4];
+	uint32_t crc;							// CRC32 of everything above
+};
+
+// Records start on a 16 byte boundary, so one never straddles an SD sector and is written whole
+
+static_assert(sizeof(binaryLogHeader) % 16 == 0, "binaryLogHeader must stay a multiple of 16 bytes");
+
+struct binaryLogRecord {					// One event, fixed size so record k is at a known offset
+	uint32_t epoch;							// Seconds since 1970, local time
+	uint16_t titleId;						// Index into the header title table
+	char category;							// U, P, A, F, O or M
+	uint8_t flags;							// logFlagManual
+	uint8_t confidence;						// 0 - 100 %
+	uint8_t reserved[3];
+	uint32_t crc;							// CRC32 of everything above
+};
+
+static_assert(sizeof(binaryLogRecord) == 16, "binaryLogRecord must stay 16 bytes");
+
+// Start up check against the CSV file
+
+const uint8_t reconcileRows = 4;			// Newest rows compared, the CSV file can be up to logFlushInterval behind
+
+// CSV export
+
+struct exportCursor {						// Where an export has got to, kept by the response between chunks
+	uint32_t next = 0;						// Next record to send
+	uint8_t offset = 0;						// Bytes of its line already sent
+};
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Open the log, converting the CSV file when there is no valid log yet or the two disagree
+
+bool binaryLogBegin(fs::FS& fs, const char* csvPath);
+
+// Check the log is open
+
+bool binaryLogReady();
+
+// Number of records
+
+uint32_t binaryLogCount();
+
+// Add a record, returns its number or noLogRecord
+
+uint32_t binaryLogAppend(const bleSignal& entry);
+
+// Drop every record from count onwards
+
+bool binaryLogTruncate(uint32_t count);
+
+// Commit appended records to the card
+
+void binaryLogSync();
+
+// Changes made to records already in the log, the stats file keeps the count it was saved at
+
+uint32_t binaryLogEdits();
+
+// Records are in time order, so binaryLogFind() can be used
+
+bool binaryLogOrdered();
+
+// First record at or after epoch, binaryLogCount() if there is none. False if the log isnt in
+// time order or a record couldnt be read.
+
+bool binaryLogFind(uint32_t epoch, uint32_t& index);
+
+// Note a category change before the CSV file is written, a power cut before the record follows is finished at the next start
+
+bool binaryLogNoteCategory(uint32_t index, uint32_t csvOffset, char category);
+
+// Change the category of record k in place, clears the note
+
+bool binaryLogSetCategory(uint32_t index, char category);
+
+// Clear the note of a category change the CSV file never took
+
+bool binaryLogDropCategory();
+
+// Read record k
+
+bool binaryLogReadRecord(uint32_t index, binaryLogRecord& record);
+
+// Read record k as a table entry
+
+bool binaryLogRead(uint32_t index, bleSignal& entry);
+
+// Read the newest records, newest in position 0
+
+int binaryLogTail(bleSignal* entries, int maxEntries);
+
+// Rebuild the log from the CSV file
+
+bool convertCSVToBinaryLog(fs::FS& fs, const char* csvPath, const char* binPath);
+
+// Write records as CSV lines, carrying on from cursor, returns bytes written
+
+size_t binaryLogExportCSV(char* buffer, size_t size, exportCursor& cursor);
+
+// Record conversion
+
+uint32_t logEpoch(const char* date, const char* time);
+
+void toBinaryRecord(const bleSignal& entry, binaryLogRecord& record);
+
+void fromBinaryRecord(const binaryLogRecord& record, bleSignal& entry);
+
+// CRC32
+
+uint32_t crc32(const void* data, size_t length);
+
+#endif
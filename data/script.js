@@ -1,6 +1,6 @@
-// Get current readings when the page loads.
+// Get current readings and listen for changes when the page loads.
 
-window.addEventListener('load', getReadings);
+window.addEventListener('load', startTable);
 
 // Get current date and time function.
 
@@ -14,12 +14,170 @@ function updateDateTime() {
         currentdate.getHours() + ":" +
         (currentdate.getMinutes() < 10 ? "0" : "") + currentdate.getMinutes() + ":" +
         (currentdate.getSeconds() < 10 ? "0" : "") + currentdate.getSeconds();
-    document.getElementById("update-time").innerHTML = datetime;
-    console.log(datetime);
+    document.getElementById("update-time").textContent = datetime;
 
 } // Close function.
 
-// Function to get current readings on the webpage when it loads for the first time.
+// Columns in the order they are shown.
+
+var columns = ["title", "date", "time", "category", "percentage"];
+
+// Rows held by the page, newest first. Each row keeps its log record number as its key.
+
+var readings = [];
+var rowsByKey = {};
+var rowCount = 0;            // Records in the log, the newest is rowCount - 1
+var lastEventId = 0;         // Newest event applied
+var historyCursor = null;    // Where the next /history page starts, null when there are no more
+var historyLoading = false;
+
+// Table elements, only the rows in view are in the page.
+
+var view, body, topSpacer, bottomSpacer;
+var rowHeight = 0;           // Measured from the first row drawn
+var overscan = 10;           // Rows drawn above and below the view so scrolling stays smooth
+var shownRows = {};          // Row element for each key drawn
+var freeRows = [];           // Row elements waiting to be reused
+var drawQueued = false;
+
+// Function to set up the table and load the newest rows.
+
+function startTable() {
+
+    view = document.getElementById("log-view");
+    body = document.getElementById("log-rows");
+    topSpacer = makeSpacer();
+    bottomSpacer = makeSpacer();
+    body.appendChild(topSpacer);
+    body.appendChild(bottomSpacer);
+
+    view.addEventListener('scroll', queueDraw);
+    window.addEventListener('resize', queueDraw);
+
+    getReadings();
+    startEvents();
+
+} // Close function.
+
+// Function to make an empty row that holds the height of the rows not drawn.
+
+function makeSpacer() {
+
+    var tr = document.createElement("tr");
+    var td = document.createElement("td");
+    tr.className = "spacer";
+    td.colSpan = columns.length;
+    tr.appendChild(td);
+    return tr;
+
+} // Close function.
+
+// Function to get a row element, reusing one that has scrolled out of view.
+
+function takeRow() {
+
+    if (freeRows.length) return freeRows.pop();
+
+    var tr = document.createElement("tr");
+    for (var i = 0; i < columns.length; i++) {
+        tr.appendChild(document.createElement("td"));
+    }
+    return tr;
+
+} // Close function.
+
+// Function to fill a row element, only cells that have changed are written.
+
+function fillRow(tr, row) {
+
+    for (var i = 0; i < columns.length; i++) {
+        var text = row[columns[i]];
+        if (tr.cells[i].textContent !== text) tr.cells[i].textContent = text;
+    }
+    tr.className = (row.row % 2) ? "shade" : "";
+
+} // Close function.
+
+// Function to draw once per frame, however many changes arrive.
+
+function queueDraw() {
+
+    if (drawQueued) return;
+    drawQueued = true;
+    window.requestAnimationFrame(drawTable);
+
+} // Close function.
+
+// Function to draw the rows in view. Rows already drawn keep their element, so a new row at the
+// top or a category change only touches the cells that differ.
+
+function drawTable() {
+
+    drawQueued = false;
+
+    var height = rowHeight || 36;
+    var first = Math.max(0, Math.floor(view.scrollTop / height) - overscan);
+    var last = Math.min(readings.length, Math.ceil((view.scrollTop + view.clientHeight) / height) + overscan);
+
+    // Rows that have left the view go back to the pool.
+
+    var wanted = {};
+    for (var i = first; i < last; i++) wanted[readings[i].row] = true;
+
+    for (var key in shownRows) {
+        if (!wanted[key]) {
+            body.removeChild(shownRows[key]);
+            freeRows.push(shownRows[key]);
+            delete shownRows[key];
+        }
+    }
+
+    // Rows in view are put in order, an element is only moved if it is out of place.
+
+    var previous = topSpacer;
+
+    for (var i = first; i < last; i++) {
+        var row = readings[i];
+        var tr = shownRows[row.row];
+        if (!tr) {
+            tr = takeRow();
+            shownRows[row.row] = tr;
+        }
+        fillRow(tr, row);
+        if (previous.nextSibling !== tr) body.insertBefore(tr, previous.nextSibling);
+        previous = tr;
+    }
+
+    // The first row drawn sets the height, the spacers are drawn again to match it.
+
+    if (!rowHeight && previous !== topSpacer) {
+        rowHeight = previous.offsetHeight;
+        queueDraw();
+    }
+
+    topSpacer.firstChild.style.height = (first * height) + "px";
+    bottomSpacer.firstChild.style.height = ((readings.length - last) * height) + "px";
+    topSpacer.style.display = first ? "" : "none";
+    bottomSpacer.style.display = (last < readings.length) ? "" : "none";
+
+    // Close to the end of what is held, fetch the next page of history.
+
+    if (last + overscan >= readings.length) getHistory();
+
+} // Close function.
+
+// Function to replace every row held, keyed by log record number.
+
+function setReadings(rows) {
+
+    readings = rows;
+    rowsByKey = {};
+    for (var i = 0; i < rows.length; i++) rowsByKey[rows[i].row] = rows[i];
+    queueDraw();
+
+} // Close function.
+
+// Function to get the newest readings, then older rows are paged in from /history as the table scrolls.
 
 function getReadings() {
 
@@ -28,14 +186,12 @@ function getReadings() {
     xhr.onreadystatechange = function () {
         if (this.readyState == 4 && this.status == 200) {
             var myObj = JSON.parse(this.responseText);
-            console.log(myObj);
-            for (var i = 0; i < myObj.readings.length; i++) {
-                document.getElementById("sessionTitleArray" + i).innerHTML = myObj.readings[i].title;
-                document.getElementById("sessionDateArray" + i).innerHTML = myObj.readings[i].date;
-                document.getElementById("sessionTimeArray" + i).innerHTML = myObj.readings[i].time;
-                document.getElementById("sessionCategory" + i).innerHTML = myObj.readings[i].category;
-                document.getElementById("sessionPercentageArray" + i).innerHTML = myObj.readings[i].percentage;
-            }
+            var rows = myObj.readings.filter(function (row) { return row.title != ""; });
+            for (var i = 0; i < rows.length; i++) rows[i].row = myObj.rows - 1 - i;
+            rowCount = myObj.rows;
+            lastEventId = myObj.eventId;
+            historyCursor = rowCount - rows.length;
+            setReadings(rows);
             updateDateTime();
         }
     };
@@ -45,9 +201,56 @@ function getReadings() {
 
 } // Close function.
 
-// Create an Event Source to listen for events.
+// Function to add the next page of older rows to the bottom of the table.
+
+function getHistory() {
+
+    if (historyLoading || !historyCursor) return;
+    historyLoading = true;
+
+    var xhr = new XMLHttpRequest();
+
+    xhr.onreadystatechange = function () {
+        if (this.readyState != 4) return;
+        historyLoading = false;
+        if (this.status != 200) {
+            historyCursor = null;                // No history on this unit, the newest rows are all there is
+            return;
+        }
+        var myObj = JSON.parse(this.responseText);
+        var oldest = readings.length ? readings[readings.length - 1].row : rowCount;
+        for (var i = 0; i < myObj.readings.length; i++) {
+            var row = myObj.readings[i];
+            if (row.row < oldest) {
+                readings.push(row);
+                rowsByKey[row.row] = row;
+            }
+        }
+        historyCursor = myObj.cursor;
+        queueDraw();
+    };
+
+    xhr.open("GET", "/history?limit=200&cursor=" + historyCursor, true);
+    xhr.send();
+
+} // Close function.
+
+// Function to check an event is new, a replayed or already loaded event is skipped.
+
+function isNewEvent(e) {
+
+    var id = Number(e.lastEventId);
+    if (id <= lastEventId) return false;
+    lastEventId = id;
+    return true;
+
+} // Close function.
+
+// Function to create an Event Source to listen for events, once the table is there for them to change.
 
-if (!!window.EventSource) {
+function startEvents() {
+
+    if (!window.EventSource) return;
 
     var source = new EventSource('/events');
 
@@ -61,18 +264,50 @@ if (!!window.EventSource) {
         }
     }, false);
 
-    source.addEventListener('new_readings', function (e) {
-        console.log("new_readings", e.data);
+    // A new row goes on the top of the table, a reader scrolled down keeps their place.
+
+    source.addEventListener('insert', function (e) {
+        if (!isNewEvent(e)) return;
+        var row = JSON.parse(e.data);
+        readings.unshift(row);
+        rowsByKey[row.row] = row;
+        rowCount = row.row + 1;
+        if (view.scrollTop > 0 && rowHeight) view.scrollTop += rowHeight;
+        queueDraw();
+        updateDateTime();
+    }, false);
+
+    // A row has been categorised.
+
+    source.addEventListener('category', function (e) {
+        if (!isNewEvent(e)) return;
         var obj = JSON.parse(e.data);
-        for (var i = 0; i < obj.readings.length; i++) {
-            document.getElementById("sessionTitleArray" + i).innerHTML = obj.readings[i].title;
-            document.getElementById("sessionDateArray" + i).innerHTML = obj.readings[i].date;
-            document.getElementById("sessionTimeArray" + i).innerHTML = obj.readings[i].time;
-            document.getElementById("sessionCategory" + i).innerHTML = obj.readings[i].category;
-            document.getElementById("sessionPercentageArray" + i).innerHTML = obj.readings[i].percentage;
+        var row = rowsByKey[obj.row];
+        if (row) {
+            row.category = obj.category;
+            queueDraw();
         }
         updateDateTime();
+    }, false);
+
+    // The newest rows have been deleted.
+
+    source.addEventListener('delete', function (e) {
+        if (!isNewEvent(e)) return;
+        var obj = JSON.parse(e.data);
+        rowCount -= obj.count;
+        while (readings.length && readings[0].row >= rowCount) {
+            delete rowsByKey[readings.shift().row];
+        }
+        queueDraw();
+        updateDateTime();
+    }, false);
+
+    // Missed too much to catch up, start again.
 
+    source.addEventListener('reset', function (e) {
+        lastEventId = 0;
+        getReadings();
     }, false);
 
 } // Close function.
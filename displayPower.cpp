@@ -0,0 +1,167 @@
+//
+// displayPower.cpp
+//
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "displayPower.h"
+#include "parseDataReceived.h"
+#include "screenWidgets.h"
+#include "spiBus.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+unsigned long displaySleepTime = 300000;			// 5 minutes
+
+static uint8_t backlight = 0;						// Backlight pin, LOW for on
+static bool awake = true;
+static unsigned long lastActivity = 0;				// When the screen was last touched
+static uint8_t dirtyParts = 0;						// displayPart bits changed while dark
+
+static uint32_t framesDrawn = 0;					// Draws that went to the panel
+static uint32_t framesSkipped = 0;					// Draws left until wake
+
+/*---------------------------------------------------------------- */
+
+// Start with the display on
+
+void beginDisplayPower(uint8_t backlightPin) {
+
+	backlight = backlightPin;
+	awake = true;
+	lastActivity = millis();
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Restart the sleep timer
+
+void displayActivity() {
+
+	lastActivity = millis();
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Turn the display off once the sleep time has passed
+
+void displayPoll(bool allowSleep) {
+
+	if (!awake || !allowSleep || millis() - lastActivity < displaySleepTime) return;
+
+	digitalWrite(backlight, HIGH);				// Backlight off
+
+#if PANEL_SLEEP
+	busAcquire(busTFT);
+	tft.writecommand(panelSleepIn);
+	busRelease(busTFT);
+#endif
+
+	awake = false;
+
+	outputDebugLn("Display asleep");
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Turn the display back on, repainting first so the backlight comes up on a current screen
+
+void displayWake() {
+
+	lastActivity = millis();
+
+	if (awake) return;
+
+#if PANEL_SLEEP
+	busAcquire(busTFT);
+	tft.writecommand(panelSleepOut);
+	busRelease(busTFT);
+	delay(panelWakeTime);
+#endif
+
+	awake = true;
+
+	uint8_t parts = dirtyParts;
+	dirtyParts = 0;
+
+	if (parts & displayWidgets) refreshWidgets();
+	if (parts & displayClock) printLocalTime();
+	if (parts & displayTable) updateTable();
+
+	digitalWrite(backlight, LOW);				// Backlight on
+
+	outputDebug("Display awake, frames drawn ");
+	outputDebug(framesDrawn);
+	outputDebug(" skipped ");
+	outputDebugLn(framesSkipped);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Display is on
+
+bool displayAwake() {
+
+	return awake;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Call before drawing part of the screen
+
+bool displayRender(displayPart part) {
+
+	if (awake) {
+
+		framesDrawn++;
+
+		return true;
+	}
+
+	dirtyParts |= part;
+	framesSkipped++;
+
+	return false;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Render counters
+
+uint32_t displayFramesDrawn() {
+
+	return framesDrawn;
+
+} // Close function
+
+uint32_t displayFramesSkipped() {
+
+	return framesSkipped;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
@@ -0,0 +1,78 @@
+// displayPower.h
+
+#ifndef _DISPLAYPOWER_h
+#define _DISPLAYPOWER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "global.h"
+
+/*---------------------------------------------------------------- */
+
+// Put the panel controller to sleep along with the backlight, set to 0 to only switch the backlight
+
+#define PANEL_SLEEP 1
+
+// ILI9341 commands, the frame memory is kept while the panel sleeps
+
+const uint8_t panelSleepIn = 0x10;					// SLPIN
+const uint8_t panelSleepOut = 0x11;					// SLPOUT
+const unsigned long panelWakeTime = 5;				// Time after SLPOUT before the panel takes commands, ms
+
+// Backlight sleep time
+
+extern unsigned long displaySleepTime;				// No touches for this long turns the display off, ms
+
+// Parts of the screen that are left until wake when they change in the dark
+
+enum displayPart : uint8_t {
+	displayTable = 0x01,
+	displayClock = 0x02,
+	displayWidgets = 0x04
+};
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Start with the display on, backlightPin is LOW for on
+
+void beginDisplayPower(uint8_t backlightPin);
+
+// Restart the sleep timer
+
+void displayActivity();
+
+// Turn the display off once the sleep time has passed, only while allowSleep
+
+void displayPoll(bool allowSleep);
+
+// Turn the display back on and repaint what changed in the dark
+
+void displayWake();
+
+// Display is on
+
+bool displayAwake();
+
+// Call before drawing part of the screen, false when it is dark and the part has been marked for wake
+
+bool displayRender(displayPart part);
+
+// Render counters
+
+uint32_t displayFramesDrawn();
+
+uint32_t displayFramesSkipped();
+
+#endif
@@ -9,28 +9,104 @@
 
 /*-----------------------------------------------------------------*/
 
-// Draw bitmap
+// Draw bitmap, x is the top row and y the left column
 
 void drawBitmap(TFT_eSPI& tft, int x, int y, const uint16_t* bitmap, int bw, int bh) {
 
-	//int h = 64, w = 64, row, col, buffidx = 0;
-	int buffidx = 0;
-	int row;
-	int col;
-	int w = bw + y;
-	int h = bh + x;
-
-	for (row = x; row < h; row++) {
-		
-		// For each scanline...
-		for (col = y; col < w; col++) { // For each pixel...
-		  //To read from Flash Memory, pgm_read_XXX is required.
-		  //Since image is stored as uint16_t, pgm_read_word is used as it uses 16bit address
-			tft.drawPixel(col, row, pgm_read_word(bitmap + buffidx));
-			buffidx++;
-		} // end pixel
+	// One address window and one burst for the whole image, rather than a window per pixel.
+	// The arrays hold each colour as a native 16 bit value, so the bytes are swapped on the way out.
+
+	bool swapBytes = tft.getSwapBytes();
+
+	tft.setSwapBytes(true);
+	tft.pushImage(y, x, bw, bh, bitmap);
+	tft.setSwapBytes(swapBytes);
+
+} // Close function.
+
+/*-----------------------------------------------------------------*/
+
+// Blend a colour towards the tint, alpha 0 - 15. Must match blend() in tools/convertIcons.py.
+
+static uint16_t blendTint(uint16_t colour, uint16_t tint, uint8_t alpha) {
+
+	if (alpha == 0) return colour;
+
+	int r = (colour >> 11) & 31, g = (colour >> 5) & 63, b = colour & 31;
+
+	r += ((((tint >> 11) & 31) - r) * alpha + 7) / 15;
+	g += ((((tint >> 5) & 63) - g) * alpha + 7) / 15;
+	b += (((tint & 31) - b) * alpha + 7) / 15;
+
+	return (r << 11) | (g << 5) | b;
+
+} // Close function.
+
+/*-----------------------------------------------------------------*/
+
+// Draw compressed icon, x is the top row and y the left column as for drawBitmap
+
+void drawIcon(TFT_eSPI& tft, int x, int y, const iconAsset& icon) {
+
+	uint16_t line[64];				// Literal pixels are gathered and sent together
+	size_t lineLength = 0;
+
+	const uint8_t* data = icon.data;
+	uint32_t remaining = (uint32_t)icon.width * icon.height;
+
+	bool swapBytes = tft.getSwapBytes();
+
+	tft.setSwapBytes(true);
+	tft.startWrite();
+	tft.setAddrWindow(y, x, icon.width, icon.height);
+
+	while (remaining > 0) {
+
+		uint8_t count = *data++;
+		uint16_t length = (count & 0x7F) + 1;
+		bool repeat = count & 0x80;
+
+		for (uint16_t i = 0; i < (repeat ? 1 : length); i++) {
+
+			uint16_t index = *data++;
+
+			if (icon.wideIndex) index = (index << 8) | *data++;
+
+			uint16_t colour = icon.tint ? blendTint(icon.palette[index], icon.tintColour, icon.tint[index]) : icon.palette[index];
+
+			if (repeat) {
+
+				// Runs go out as one block, after anything gathered before them
+
+				if (lineLength > 0) {
+					tft.pushPixels(line, lineLength);
+					lineLength = 0;
+				}
+
+				tft.pushBlock(colour, length);
+			}
+
+			else {
+
+				line[lineLength++] = colour;
+
+				if (lineLength == 64) {
+					tft.pushPixels(line, lineLength);
+					lineLength = 0;
+				}
+			}
+		}
+
+		remaining -= min((uint32_t)length, remaining);
+	}
+
+	if (lineLength > 0) {
+		tft.pushPixels(line, lineLength);
 	}
 
+	tft.endWrite();
+	tft.setSwapBytes(swapBytes);
+
 } // Close function.
 
 /*-----------------------------------------------------------------*/
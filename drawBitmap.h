@@ -9,7 +9,24 @@
 #include "WProgram.h"
 #endif
 
+#include <TFT_eSPI.h>
+
+// Compressed icon, see tools/convertIcons.py. The data is a stream of runs, each starting
+// with a count byte: 0x80 | (n - 1) is followed by one palette index repeated n times,
+// (n - 1) on its own is followed by n palette indices.
+
+struct iconAsset {
+	uint16_t width;
+	uint16_t height;
+	const uint16_t* palette;				// RGB565 colours
+	const uint8_t* tint;					// Tint strength 0 - 15 per palette entry, nullptr for untinted icons
+	const uint8_t* data;					// Runs of palette indices
+	bool wideIndex;							// Indices are 2 bytes, for palettes over 256 colours
+	uint16_t tintColour;					// Colour this variant blends towards
+};
+
 void drawBitmap(TFT_eSPI& tft, int x, int y, const uint16_t* bitmap, int bw, int bh);
 
-#endif
+void drawIcon(TFT_eSPI& tft, int x, int y, const iconAsset& icon);
 
+#endif
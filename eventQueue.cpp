@@ -0,0 +1,198 @@
+//
+// eventQueue.cpp
+//
+
+// Main libraries
+
+#include <atomic>
+#include <SD.h>						// SD Card library
+
+// Local declarations
+
+#include "eventQueue.h"
+#include "fileOperations.h"
+#include "logWriter.h"
+#include "binaryLog.h"
+#include "statsRollup.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+// Single producer (loop task ingest) / single consumer (whoever holds the storage lock, normally
+// the persistence task). Each index is only ever written by one side, so ingest needs no lock and
+// a slow SD card never blocks it.
+
+static bleSignal queueSlots[eventQueueSize];
+
+static const uint32_t queueMask = eventQueueSize - 1;
+
+static std::atomic<uint32_t> queueHead(0);			// Next slot to fill, only moved by ingest
+static std::atomic<uint32_t> queueTail(0);			// Next slot to drain, only moved by the persistence task
+static std::atomic<uint32_t> queueHighWater(0);		// Deepest the queue has been
+static std::atomic<uint32_t> queueDrops(0);			// Detections lost because the queue was full
+
+static TaskHandle_t persistenceTaskHandle = NULL;
+
+/*---------------------------------------------------------------- */
+
+// Add a detection to the queue
+
+bool pushEvent(const bleSignal& entry) {
+
+	uint32_t head = queueHead.load(std::memory_order_relaxed);
+	uint32_t tail = queueTail.load(std::memory_order_acquire);
+
+	if (head - tail >= eventQueueSize) {
+
+		queueDrops++;
+
+		outputDebugLn("Event queue full, detection dropped");
+
+		return false;
+	}
+
+	queueSlots[head & queueMask] = entry;
+	queueHead.store(head + 1, std::memory_order_release);
+
+	// Track the deepest point, only ingest writes this
+
+	uint32_t depth = head + 1 - tail;
+
+	if (depth > queueHighWater.load(std::memory_order_relaxed)) {
+		queueHighWater.store(depth, std::memory_order_relaxed);
+	}
+
+	// Wake the persistence task
+
+	if (persistenceTaskHandle != NULL) {
+		xTaskNotifyGive(persistenceTaskHandle);
+	}
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Take the oldest detection from the queue
+
+bool popEvent(bleSignal& entry) {
+
+	uint32_t tail = queueTail.load(std::memory_order_relaxed);
+	uint32_t head = queueHead.load(std::memory_order_acquire);
+
+	if (tail == head) return false;
+
+	entry = queueSlots[tail & queueMask];
+	queueTail.store(tail + 1, std::memory_order_release);
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Write every queued detection to SD now, so a reread of the file sees what is already in the table
+
+void drainEvents() {
+
+	bleSignal entry;
+
+	// Records are grouped in the log buffer, a busy spell costs one SD write per sector
+
+	while (popEvent(entry)) {
+		appendFile(SD, fileName, entry);
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Persistence task, drains the queue to SD whenever ingest adds to it
+
+static void persistenceTask(void* parameter) {
+
+	(void)parameter;					// Nothing is passed in
+
+	while (true) {
+
+		// Wake on a new detection, or often enough to honour the log durability window
+
+		ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(logFlushInterval));
+
+		lockStorage();
+
+		drainEvents();
+
+		logWriterPoll();
+
+#if BINARY_LOG
+		binaryLogSync();
+#endif
+
+		unlockStorage();
+
+#if BINARY_LOG
+
+		// A missing or stale rollup is rebuilt a slice at a time, new detections go first
+
+		while (eventQueueDepth() == 0 && !statsPoll()) {
+			vTaskDelay(1);
+		}
+
+#endif
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Start the task that writes queued detections to SD
+
+void startPersistenceTask() {
+
+	// Core 0 keeps SD writes off the loop() core
+
+	xTaskCreatePinnedToCore(persistenceTask, "persistence", 6144, NULL, 1, &persistenceTaskHandle, 0);
+
+	outputDebugLn("");
+	outputDebugLn("Persistence task started...");
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Queue statistics
+
+uint32_t eventQueueDepth() {
+
+	return queueHead.load(std::memory_order_acquire) - queueTail.load(std::memory_order_acquire);
+
+} // Close function
+
+uint32_t eventQueueHighWater() {
+
+	return queueHighWater.load(std::memory_order_relaxed);
+
+} // Close function
+
+uint32_t eventQueueDrops() {
+
+	return queueDrops.load(std::memory_order_relaxed);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
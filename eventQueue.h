@@ -0,0 +1,50 @@
+// eventQueue.h
+
+#ifndef _EVENTQUEUE_h
+#define _EVENTQUEUE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Local declarations
+
+#include "fileOperations.h"
+
+/*---------------------------------------------------------------- */
+
+// Queue size
+
+const size_t eventQueueSize = 16;			// Detections waiting to be written to SD, must be a power of two
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Add a detection to the queue, called by ingest only
+
+bool pushEvent(const bleSignal& entry);
+
+// Take the oldest detection from the queue, called with the storage lock held
+
+bool popEvent(bleSignal& entry);
+
+// Write every queued detection to SD now, called with the storage lock held
+
+void drainEvents();
+
+// Start the task that writes queued detections to SD
+
+void startPersistenceTask();
+
+// Queue statistics
+
+uint32_t eventQueueDepth();
+
+uint32_t eventQueueHighWater();
+
+uint32_t eventQueueDrops();
+
+#endif
@@ -7,12 +7,19 @@
 #include <FS.h>						// Files system library
 #include <SD.h>						// SD Card library
 #include <SPIFFS.h>					// Spiffs library
+#include <unistd.h>					// truncate()
 
 // Local declarations
 
 #include "global.h"
 #include "fileOperations.h"
 #include "mainDisplay.h"
+#include "logWriter.h"
+#include "binaryLog.h"
+#include "parseDataReceived.h"
+#include "screenWidgets.h"
+#include "spiBus.h"
+#include "wifiSystem.h"
 
 // Debug serial prints
 
@@ -34,10 +41,48 @@ const char* fileName = "/data.csv";			// File object to handle CSV file
 
 // Data array
 
-String dataReceived;						// Storing received data from Nano BLE
 bleSignal dataEntries[maxEntries];			// Array to store the last 10 entries
 boolean newDataReceived = false;			// Flag for each time serial data is received
 
+// Backup
+
+static char copyBuffer[copyBufferSize] __attribute__((aligned(4)));	// Whole sectors per SD transfer
+
+static File copySource;							// Open between copy steps
+static File copyTarget;
+static String copyName;							// Name of the copy being written
+static fs::FS* copyFs = nullptr;
+static size_t copyTotal = 0;					// Size of the CSV file when the copy started
+static size_t copied = 0;						// Offset reached so far
+
+// Categorise cursor, every row before it is already categorised
+
+static size_t categoryScanOffset = 0;			// File offset of the first row that may still be U
+static uint32_t categoryScanIndex = 0;			// Binary log record number of that row
+
+static size_t pendingCategoryOffset = 0;		// Where the U of the row on screen is
+static bleSignal pendingCategoryEntry;			// Row on screen waiting for a category
+
+/*-----------------------------------------------------------------*/
+
+// Take the storage lock, SD work holds the shared SPI bus so the display cant cut in mid transfer
+
+void lockStorage() {
+
+	busAcquire(busSD);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Release the storage lock
+
+void unlockStorage() {
+
+	busRelease(busSD);
+
+} // Close function
+
 /*-----------------------------------------------------------------*/
 
 // Read File
@@ -166,29 +211,29 @@ bool createCSVFile(const char* fileName) {
 
 /*-----------------------------------------------------------------*/
 
-// Update CSV file
+// Update CSV file, the record is buffered and reaches the card within logFlushInterval
 
 void appendFile(fs::FS& fs, const char* path, bleSignal newData) {
 
-	Serial.printf("Appending to file: %s\r\n", path);
+	// Construct the message from the bleSignal struct fields
 
-	// Open the file in append mode
+	char message[maxLineLength];
+	formatCSVLine(newData, message, sizeof(message));
 
-	File file = fs.open(path, FILE_APPEND);
+	// Append the message to the file
 
-	if (!file) {
-		outputDebugLn("Failed to open file for appending");
-		return;
-	}
+	if (logWriterAppend(fs, path, message)) {
 
-	// Construct the message from the bleSignal struct fields
+#if BINARY_LOG
+		uint32_t record = binaryLogAppend(newData);
+#else
+		uint32_t record = noLogRecord;
+#endif
 
-	String message = newData.title + "," + newData.date + "," + newData.time + "," + newData.category + "," + newData.percentage;
+		// Open pages are told once the row is stored, under the number the log gave it
 
-	// Append the message to the file
+		publishInsert(newData, record);
 
-	if (file.println(message)) {
-		
 		outputDebug("Message appended = ");
 		outputDebug(message);
 		outputDebugLn("");
@@ -199,9 +244,17 @@ void appendFile(fs::FS& fs, const char* path, bleSignal newData) {
 
 	}
 
-	// Close the file
+} // Close function
+
+/*-----------------------------------------------------------------*/
 
-	file.close();
+// Find the next comma in a line, or the end of the line if there isnt one
+
+static const char* nextComma(const char* start, const char* end) {
+
+	const char* comma = (const char*)memchr(start, ',', end - start);
+
+	return comma ? comma : end;
 
 } // Close function
 
@@ -209,34 +262,43 @@ void appendFile(fs::FS& fs, const char* path, bleSignal newData) {
 
 // Parse CSV line for reading into array
 
-bleSignal parseCSVLine(const String& line) {
+bleSignal parseCSVLine(const char* line, size_t length) {
 
-	bleSignal data;
-	int start = 0, end = line.indexOf(',');
+	bleSignal data = {};
+
+	const char* end = line + length;
+	const char* start = line;
+	const char* comma = nextComma(start, end);
+
+	// Extract and trim title, setField cleans up control characters and whitespace
 
-	// Extract and trim title
-	data.title = line.substring(start, end);
-	data.title.trim();  // Clean up the title to remove any control characters and whitespace
+	if (!setField(data.title, start, comma)) {
+		outputDebugLn("Title too long, truncated");
+	}
+
+	start = min(comma + 1, end); comma = nextComma(start, end);
 
-	start = end + 1; end = line.indexOf(',', start);
 	// Extract and trim date
-	data.date = line.substring(start, end);
-	data.date.trim();  // Also apply trim to ensure cleanliness
 
-	start = end + 1; end = line.indexOf(',', start);
+	setField(data.date, start, comma);
+
+	start = min(comma + 1, end); comma = nextComma(start, end);
+
 	// Extract and trim time
-	data.time = line.substring(start, end);
-	data.time.trim();  // Clean up time
 
-	start = end + 1; end = line.indexOf(',', start);
+	setField(data.time, start, comma);
+
+	start = min(comma + 1, end); comma = nextComma(start, end);
+
 	// Extract and trim category
-	data.category = line.substring(start, end);
-	data.category.trim();  // Clean up category
 
-	start = end + 1;
+	setField(data.category, start, comma);
+
+	start = min(comma + 1, end);
+
 	// Extract and trim percentage
-	data.percentage = line.substring(start);
-	data.percentage.trim();  // Ensure no trailing newlines or whitespace
+
+	setField(data.percentage, start, end);
 
 	return data;
 
@@ -244,266 +306,279 @@ bleSignal parseCSVLine(const String& line) {
 
 /*-----------------------------------------------------------------*/
 
-// Convert String to CSV line
+// Convert record to CSV line
+
+size_t formatCSVLine(const bleSignal& data, char* buffer, size_t size) {
 
-String toCSVLine(const bleSignal& data) {
+	int length = snprintf(buffer, size, "%s,%s,%s,%s,%s", data.title, data.date, data.time, data.category, data.percentage);
 
-	return data.title + "," + data.date + "," + data.time + "," + data.category + "," + data.percentage;
+	return (length < 0) ? 0 : min((size_t)length, size - 1);
 
 } // Close function
 
 /*-----------------------------------------------------------------*/
 
-// Wait for category selection
+// Find the first row still marked U, scanning forwards from lineStart
 
-String waitForCategorySelection() {
+static bool findUncategorised(File& file, size_t& lineStart, uint32_t& lineIndex, size_t& categoryOffset, bleSignal& data) {
 
-	// Implement this function to handle user input for category selection
+	char chunk[128];
+	char line[maxLineLength];
+	size_t lineLength = 0;
+	size_t leading = 0;							// Whitespace before the row, not kept in line
+	size_t position = lineStart;				// File offset of the byte being looked at
 
-	// Check for touch data
+	file.seek(lineStart);
 
-	uint16_t x, y;		// variables for touch data.
+	while (true) {
 
-	while (tft.getTouch(&x, &y)) {
+		size_t length = file.read((uint8_t*)chunk, sizeof(chunk));
 
-		// Button one
+		if (length == 0) return false;			// A final row without a line ending is looked at again next time
 
-		if ((x > BUTTON1_X) && (x < (BUTTON1_X + BUTTON1_W))) {
-			if ((y > BUTTON1_Y) && (y <= (BUTTON1_Y + BUTTON1_H))) {
+		for (size_t i = 0; i < length; i++, position++) {
 
-				playTone(buzzerP, buzzerF, buzzerD);
+			if (chunk[i] != '\n') {
+				if (lineLength == 0 && isspace((unsigned char)chunk[i])) leading++;
+				else if (lineLength < sizeof(line)) line[lineLength++] = chunk[i];
+				continue;
+			}
 
-				outputDebugLn("");
-				outputDebug("Button 1 pressed - P Returned");
-				outputDebugLn("");
+			// Blank lines have no binary log record, so they dont count towards the index
 
-				return "P";
+			if (lineLength > 0) {
 
-			}
+				data = parseCSVLine(line, lineLength);
 
-		}
+				if (strcmp(data.category, "U") == 0) {
 
-		// Button two
+					// Locate the U itself, the fourth field
 
-		if ((x > BUTTON2_X) && (x < (BUTTON2_X + BUTTON2_W))) {
-			if ((y > BUTTON2_Y) && (y <= (BUTTON2_Y + BUTTON2_H))) {
+					size_t field = 0;
+					int commas = 0;
 
-				playTone(buzzerP, buzzerF, buzzerD);
+					while (field < lineLength && commas < 3) {
+						if (line[field++] == ',') commas++;
+					}
 
-				outputDebugLn("");
-				outputDebug("Button 2 pressed - A Returned");
-				outputDebugLn("");
+					while (field < lineLength && line[field] == ' ') field++;
 
-				return "A";
+					if (field < lineLength && line[field] == 'U') {
+						categoryOffset = lineStart + leading + field;
+						return true;
+					}
+				}
 
+				lineIndex++;
 			}
 
+			// Everything before the next row is categorised, so later scans start there
 
+			lineStart = position + 1;
+			lineLength = 0;
+			leading = 0;
 		}
+	}
 
-		// Button three
-
-		if ((x > BUTTON3_X) && (x < (BUTTON3_X + BUTTON3_W))) {
-			if ((y > BUTTON3_Y) && (y <= (BUTTON3_Y + BUTTON3_H))) {
-
-				playTone(buzzerP, buzzerF, buzzerD);
+} // Close function
 
-				outputDebugLn("");
-				outputDebug("Button 3 hit - F Returned");
-				outputDebugLn("");
+/*-----------------------------------------------------------------*/
 
-				return "F";
+// Show the next row still marked U, false when every row is categorised
 
-			}
+bool beginCategorise(fs::FS& fs, const char* path) {
 
-		}
+	lockStorage();
+	logWriterClose();					// Buffered rows must reach the file, and no other handle may hold its last sector
 
-		// Button four
+	File file = fs.open(path, FILE_READ);
 
-		if ((x > BUTTON4_X) && (x < (BUTTON4_X + BUTTON4_W))) {
-			if ((y > BUTTON4_Y) && (y <= (BUTTON4_Y + BUTTON4_H))) {
+	if (!file) {
 
-				playTone(buzzerP, buzzerF, buzzerD);
+		Serial.println("Failed to open file for reading.");
+		unlockStorage();
+		return false;
 
-				outputDebugLn("");
-				outputDebug("Button 4 hit - O Returned");
-				outputDebugLn("");
+	}
 
-				return "O";
+	// Rows are only ever removed from the end, so a cursor past the end just means they were deleted
 
-			}
+	if (categoryScanOffset > file.size()) {
+		categoryScanOffset = file.size();
+	}
 
-		}
+	bleSignal data;
+	size_t categoryOffset = 0;
 
-	}
+	bool found = findUncategorised(file, categoryScanOffset, categoryScanIndex, categoryOffset, data);
 
-} // Close function
+	file.close();
 
-/*-----------------------------------------------------------------*/
+	unlockStorage();
 
-// Categorise entries
+	if (!found) {
 
-void categorizeEntries(fs::FS& fs, const char* path) {
+		// Display a message on the TFT saying no 'U' was found
 
-	String lineEnding = "\r\n";
+		drawWhiteBox();
+		setTitle("");
 
-	File readFile = fs.open(path, FILE_READ);
+		busAcquire(busTFT);
 
-	if (!readFile) {
+		tft.setFreeFont(&FreeSans12pt7b);
+		tft.setTextSize(1);
+		tft.setTextColor(DKBLUE);
+		tft.setCursor(40, 88);
+		tft.print("All Categories Set");
 
-		Serial.println("Failed to open file for reading.");
-		return;
+		busRelease(busTFT);
 
+		return false;
 	}
 
-	String tempPath = String(path) + ".tmp";
+	// Print the original data
+	outputDebugLn("");
+	outputDebug("Title:              ");
+	outputDebugLn(data.title);
+	outputDebug("Date:               ");
+	outputDebugLn(data.date);
+	outputDebug("Time:               ");
+	outputDebugLn(data.time);
+	outputDebug("Category:           ");
+	outputDebugLn(data.category);
+	outputDebug("Percentage:         ");
+	outputDebug(data.percentage);
+	outputDebugLn("");
+
+	// Print and display the original data
+
+	drawWhiteBox();
+	setTitle("Update Entry");
+
+	// The bus is held for the whole view, so it goes out as one TFT transaction
+
+	busAcquire(busTFT);
+
+	tft.setFreeFont(&FreeSans9pt7b);
+	tft.setTextSize(1);
+	tft.setTextColor(DKBLUE);
+	tft.setCursor(20, 88);
+	tft.print("Title:");
+	tft.setCursor(130, 88);
+	tft.println(data.title);
+	tft.setCursor(20, 108);
+	tft.print("Date:");
+	tft.setCursor(130, 108);
+	tft.println(data.date);
+	tft.setCursor(20, 128);
+	tft.print("Time:");
+	tft.setCursor(130, 128);
+	tft.println(data.time);
+	tft.setCursor(20, 148);
+	tft.print("Category:");
+	tft.setCursor(130, 148);
+	tft.println(data.category);
+	tft.setCursor(20, 168);
+	tft.print("Accuracy:");
+	tft.setCursor(130, 168);
+	tft.print(data.percentage);
+	tft.println("%");
+
+	busRelease(busTFT);
+
+	// The storage lock isnt held while waiting for a touch
+
+	pendingCategoryOffset = categoryOffset;
+	pendingCategoryEntry = data;
+
+	return true;
 
-	File writeFile = fs.open(tempPath.c_str(), FILE_WRITE);
+} // Close function
 
-	if (!writeFile) {
+/*-----------------------------------------------------------------*/
 
-		outputDebugLn("Failed to open temporary file for writing.");
-		readFile.close();
-		return;
+// Set the category of the row beginCategorise() showed, the U is overwritten in place so the cost doesnt grow with the file
 
-	}
+void applyCategory(fs::FS& fs, const char* path, char category) {
 
-	bool updated = false;
+	bleSignal& data = pendingCategoryEntry;
+	size_t categoryOffset = pendingCategoryOffset;
 
-	while (readFile.available()) {
+	data.category[0] = category;
+	data.category[1] = '\0';
 
-		String line = readFile.readStringUntil('%');
+	// Print the updated data
+	outputDebugLn("");
+	outputDebug("Updated Title:      ");
+	outputDebugLn(data.title);
+	outputDebug("Updated Date:       ");
+	outputDebugLn(data.date);
+	outputDebug("Updated Time:       ");
+	outputDebugLn(data.time);
+	outputDebug("Updated Category:   ");
+	outputDebugLn(data.category);
+	outputDebug("Updated Accuracy: ");
+	outputDebug(data.percentage);
+	outputDebugLn("");
 
-		if (!updated) {
+	// Overwrite the single U byte, a power cut leaves the row either U or categorised, never torn
 
-			bleSignal data = parseCSVLine(line);
-
-			if (data.category == "U") {
-
-				// Print the original data
-				outputDebugLn("");
-				outputDebug("Title:              ");
-				outputDebugLn(data.title);
-				outputDebug("Date:               ");
-				outputDebugLn(data.date);
-				outputDebug("Time:               ");
-				outputDebugLn(data.time);
-				outputDebug("Category:           ");
-				outputDebugLn(data.category);
-				outputDebug("Percentage:         ");
-				outputDebug(data.percentage);
-				outputDebugLn("");
-
-				// Print and display the original data
-
-				drawWhiteBox();
-
-				tft.setFreeFont(&FreeSans9pt7b);
-				tft.setTextSize(1);
-				tft.setTextColor(BLACK);
-				tft.setCursor(13, 26);
-				tft.print("Update Entry");
-
-				tft.fillRect(39, 60, 183, 40, WHITE);
-				tft.setFreeFont(&FreeSans9pt7b);
-				tft.setTextSize(1);
-				tft.setTextColor(DKBLUE);
-				tft.setCursor(20, 88);
-				tft.print("Title:");
-				tft.setCursor(130, 88);
-				tft.println(data.title);
-				tft.setCursor(20, 108);
-				tft.print("Date:");
-				tft.setCursor(130, 108);
-				tft.println(data.date);
-				tft.setCursor(20, 128);
-				tft.print("Time:");
-				tft.setCursor(130, 128);
-				tft.println(data.time);
-				tft.setCursor(20, 148);
-				tft.print("Category:");
-				tft.setCursor(130, 148);
-				tft.println(data.category);
-				tft.setCursor(20, 168);
-				tft.print("Accuracy:");
-				tft.setCursor(130, 168);
-				tft.print(data.percentage);
-				tft.println("%");
-
-				// Update the category
-				data.category = waitForCategorySelection();
-
-				// Print the updated data
-				outputDebugLn("");
-				outputDebug("Updated Title:      ");
-				outputDebugLn(data.title);
-				outputDebug("Updated Date:       ");
-				outputDebugLn(data.date);
-				outputDebug("Updated Time:       ");
-				outputDebugLn(data.time);
-				outputDebug("Updated Category:   ");
-				outputDebugLn(data.category);
-				outputDebug("Updated Accuracy: ");
-				outputDebug(data.percentage);
-				outputDebugLn("");
-					
-				line = lineEnding + toCSVLine(data);	// Convert the updated struct back to a CSV line
-				updated = true;							// Mark as updated
-			}
-		}
+	lockStorage();
+	logWriterClose();					// Rows may have been appended while waiting
 
-		writeFile.print(line + '%');
+#if BINARY_LOG
+	binaryLogNoteCategory(categoryScanIndex, categoryOffset, data.category[0]);		// A power cut before the log follows is finished at the next start
+#endif
 
-		if (updated) {
-			break;										// Exit the loop after updating the first 'U'
-		}
-	}
+	File file = fs.open(path, "r+");
 
-	// Copy the rest of the file if not at the end yet
+	bool updated = false;
 
-	while (readFile.available()) {
+	if (file && file.seek(categoryOffset) && file.read() == 'U') {
 
-		writeFile.write(readFile.read());
+		file.seek(categoryOffset);
+		updated = file.write((uint8_t)data.category[0]) == 1;
 
-	}
+		// The byte may or may not be on the card, the note stays for the next start to settle
 
-	readFile.close();
-	writeFile.close();
+		if (!updated) {
+			outputDebugLn("Failed to write category.");
+		}
+	}
 
-	// Replace the original file with the updated one
+	else {
 
-	if (updated) {
+		outputDebugLn("Failed to update category.");
 
-		fs.remove(path);
-		fs.rename(tempPath.c_str(), path);
+		// Nothing was written, the note goes so it cant be applied to another row later
 
+#if BINARY_LOG
+		binaryLogDropCategory();
+#endif
 	}
 
-	else {
-
-		fs.remove(tempPath.c_str());
-
-		// Display a message on the TFT saying no 'U' was found
+	file.close();
 
-		drawWhiteBox();
+	// The log and the browser only follow a byte that was really changed
 
-		tft.fillRect(39, 60, 183, 40, WHITE);
-		tft.setFreeFont(&FreeSans12pt7b);
-		tft.setTextSize(1);
-		tft.setTextColor(DKBLUE); tft.setCursor(40, 88);
-		tft.print("All Categories Set");
+	if (updated) {
 
-		delay(1500);
+#if BINARY_LOG
+		binaryLogSetCategory(categoryScanIndex, data.category[0]);
+#endif
 
+		publishCategory(categoryScanIndex, data.category);
 	}
 
+	unlockStorage();
+
 } // Close function
 
 /*-----------------------------------------------------------------*/
 
 // Function to add a manual entry to the CSV file
 
-void addManualEntry(fs::FS& fs, const char* path) {
+void addManualEntry(fs::FS& fs, const char* path, char category) {
 
 	// Get current time and date
 
@@ -513,25 +588,34 @@ void addManualEntry(fs::FS& fs, const char* path) {
 
 	// Construct the new entry with 'M' for manual and update the category
 
-	String tempCat = waitForCategorySelection();
-
-	String newEntry = "Manual," + String(timeBuffer) + ",ME-" + tempCat + ",100%";
+	String newEntry = "Manual," + String(timeBuffer) + ",ME-" + String(category) + ",100%";
 
-	// Open the file in append mode
+	// Append the new entry, synced straight away as the table is reread from the file next
 
-	File file = fs.open(path, FILE_APPEND);
+	lockStorage();
 
-	if (!file) {
+	if (!logWriterAppend(fs, path, newEntry.c_str())) {
 
 		Serial.println("Failed to open file for appending.");
+		unlockStorage();
 		return;
 
 	}
 
-	// Append the new entry
+	logWriterSync();
 
-	file.println(newEntry);
-	file.close();
+	bleSignal entry = parseCSVLine(newEntry.c_str(), newEntry.length());
+
+#if BINARY_LOG
+	uint32_t record = binaryLogAppend(entry);
+	binaryLogSync();
+#else
+	uint32_t record = noLogRecord;
+#endif
+
+	publishInsert(entry, record);
+
+	unlockStorage();
 
 	Serial.println("Manual entry added: " + newEntry);
 
@@ -539,124 +623,213 @@ void addManualEntry(fs::FS& fs, const char* path) {
 
 /*-----------------------------------------------------------------*/
 
-// Take a copy of the CSV file
+// Start a copy of the CSV file
 
-bool createDataCopy(fs::FS& fs, const char* path) {
+bool beginDataCopy(fs::FS& fs, const char* path) {
 
-	bool createCopy = areYouSure();
+	int counter = 1;
+	String baseFilename = path;
+	baseFilename.replace(".csv", "");  // Remove the .csv extension to append numbers
+	copyName = baseFilename + String(counter) + ".csv";
 
-	if (createCopy == true) {
+	lockStorage();
+	logWriterSync();				// Copy must include everything held in the log buffer
 
-		int counter = 1;
-		String baseFilename = path;
-		baseFilename.replace(".csv", "");  // Remove the .csv extension to append numbers
-		String newFilename = baseFilename + String(counter) + ".csv";
+	// Check for existing files and increment the counter to find a new filename
 
-		// Check for existing files and increment the counter to find a new filename
+	while (fs.exists(copyName.c_str())) {
+		counter++;
+		copyName = baseFilename + String(counter) + ".csv";
+	}
 
-		while (fs.exists(newFilename.c_str())) {
-			counter++;
-			newFilename = baseFilename + String(counter) + ".csv";
-		}
+	// Open the original file and the new file
 
-		// Open the original file and the new file
+	copySource = fs.open(path, FILE_READ);
 
-		File originalFile = fs.open(path, FILE_READ);
+	if (!copySource) {
+		outputDebugLn("Failed to open the original file for reading.");
+		unlockStorage();
+		return false;
+	}
 
-		if (!originalFile) {
-			outputDebugLn("Failed to open the original file for reading.");
-			return false;
-		}
+	copyTarget = fs.open(copyName.c_str(), FILE_WRITE);
 
-		File newFile = fs.open(newFilename.c_str(), FILE_WRITE);
+	if (!copyTarget) {
+		outputDebugLn("Failed to open the new file for writing.");
+		copySource.close();
+		unlockStorage();
+		return false;
+	}
 
-		if (!newFile) {
-			outputDebugLn("Failed to open the new file for writing.");
-			originalFile.close();
-			return false;
-		}
+	// Rows appended during the copy are left for the next backup
 
-		// Copy the content
+	copyFs = &fs;
+	copyTotal = copySource.size();
+	copied = 0;
 
-		while (originalFile.available()) {
-			newFile.write(originalFile.read());
-		}
+	unlockStorage();
 
-		// Close both files
+	drawCopyProgress(0, copyTotal);
 
-		originalFile.close();
-		newFile.close();
+	return true;
 
-		outputDebug("File copied to: ");
-		outputDebugLn(newFilename);
+} // Close function
 
-		return true;
+/*-----------------------------------------------------------------*/
 
+// Copy one buffer, called until it stops returning copyRunning. The lock is released between
+// buffers so detections keep being saved.
+
+copyStatus dataCopyStep() {
+
+	bool ok = true;
+
+	if (copied < copyTotal) {
+
+		size_t length = min(copyBufferSize, copyTotal - copied);
+
+		lockStorage();
+
+		ok = copySource.read((uint8_t*)copyBuffer, length) == length
+			&& copyTarget.write((const uint8_t*)copyBuffer, length) == length;
+
+		unlockStorage();
+
+		copied += length;
+
+		drawCopyProgress(copied, copyTotal);
+
+		if (ok && copied < copyTotal) return copyRunning;
 	}
 
-	else return false;
+	// Close both files
+
+	lockStorage();
+
+	copySource.close();
+	copyTarget.close();
+
+	if (!ok) {
+		copyFs->remove(copyName.c_str());
+	}
+
+	unlockStorage();
+
+	outputDebug("File copied to: ");
+	outputDebugLn(copyName);
+
+	return ok ? copyDone : copyFailed;
 
 } // Close function
 
 /*-----------------------------------------------------------------*/
 
-// Delete last entry
+// Cut a file on the SD card down to length bytes
 
-void deleteLastEntry(fs::FS& fs, const char* path) {
+bool truncateFile(const char* path, size_t length) {
 
-	File readFile = fs.open(path, FILE_READ);
+	// The FS wrapper has no truncate, so go through the VFS path SD.begin() mounted
 
-	if (!readFile) {
-		Serial.println("Failed to open file for reading.");
-		return;
-	}
+	String fullPath = String(sdMountPoint) + path;
 
-	String tempPath = String(path) + ".tmp";
+	return truncate(fullPath.c_str(), length) == 0;
 
-	File writeFile = fs.open(tempPath.c_str(), FILE_WRITE);
+} // Close function
 
-	if (!writeFile) {
-		Serial.println("Failed to open temporary file for writing.");
-		readFile.close();
-		return;
+/*-----------------------------------------------------------------*/
+
+// Count the rows between two offsets, from and to are both at the start of a row. Blank lines
+// dont count, the same as findUncategorised
+
+static uint32_t countRows(File& file, size_t from, size_t to) {
+
+	char chunk[128];
+	uint32_t rows = 0;
+	bool inLine = false;
+
+	file.seek(from);
+
+	while (from < to) {
+
+		size_t length = file.read((uint8_t*)chunk, min(sizeof(chunk), to - from));
+
+		if (length == 0) break;
+
+		for (size_t i = 0; i < length; i++) {
+
+			if (chunk[i] == '\n') {
+				if (inLine) rows++;
+				inLine = false;
+			}
+
+			else if (!isspace((unsigned char)chunk[i])) {
+				inLine = true;
+			}
+		}
+
+		from += length;
 	}
 
-	// Variables to track the current and previous lines
+	return rows;
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Delete the last count entries, the file is cut at the start of the first of them
+
+void deleteLastEntry(fs::FS& fs, const char* path, int count) {
 
-	String currentLine, lastLine;
+	lockStorage();
+	logWriterClose();					// Buffered rows must reach the file, and no handle may be open while it is cut
 
-	// Read first line outside of the loop to handle it separately
+	File file = fs.open(path, FILE_READ);
 
-	if (readFile.available()) {
-		lastLine = readFile.readStringUntil('\n');
-		lastLine.trim();								// Clean up the line
+	if (!file) {
+		Serial.println("Failed to open file for reading.");
+		unlockStorage();
+		return;
 	}
 
-	// Process all remaining lines
+	// Walk back from the end to the start of the last count rows, trailing blank lines go with them
 
-	while (readFile.available()) {
-		currentLine = readFile.readStringUntil('\n');
-		currentLine.trim();								// Clean up the line
+	int rowsFound = 0;
+	size_t length = findTailOffset(file, count, rowsFound);
 
-		if (!currentLine.isEmpty()) {
-			writeFile.println(lastLine);				// Write the previous line to the file
-			lastLine = currentLine;						// Update lastLine to current
-		}
+	// Rows before the cut keep their offsets, a category cursor past the cut moves back to it and
+	// loses the rows between
+
+	uint32_t rowsPassed = (categoryScanOffset > length) ? countRows(file, length, categoryScanOffset) : 0;
+
+	file.close();
+
+	if (rowsFound == 0) {
+		unlockStorage();
+		return;
 	}
 
-	// The loop ends with lastLine not being written to writeFile, effectively deleting it
+	if (!truncateFile(path, length)) {
+		Serial.println("Failed to truncate file.");
+		unlockStorage();
+		return;
+	}
 
-	readFile.close();
-	writeFile.close();
+#if BINARY_LOG
+	binaryLogTruncate(binaryLogCount() - min((uint32_t)rowsFound, binaryLogCount()));
+#endif
 
-	// Delete the original file and rename the temp file to the original file name
+	if (categoryScanOffset > length) {
 
-	if (fs.exists(path)) {
-		fs.remove(path);
-	
+		categoryScanOffset = length;
+		categoryScanIndex -= min(rowsPassed, categoryScanIndex);
 	}
 
-	fs.rename(tempPath.c_str(), path);
+	outputDebug("Entries deleted: ");
+	outputDebugLn(rowsFound);
+
+	publishDelete(rowsFound);
+
+	unlockStorage();
 
 } // Close function
 
@@ -11,27 +11,64 @@
 	#include "WProgram.h"
 #endif
 
+#include <type_traits>
+
 /*---------------------------------------------------------------- */
 
 // File name
 
 extern const char* fileName;
 
+// Where SD.begin() mounts the card, needed for calls the FS wrapper doesnt provide
+
+const char* const sdMountPoint = "/sd";
+
+// Backup
+
+const size_t copyBufferSize = 4096;		// Bytes per read and write when copying the data file
+
+enum copyStatus : uint8_t {				// Result of each dataCopyStep()
+	copyRunning,
+	copyDone,
+	copyFailed
+};
+
 // Data entry array
 
 const int maxEntries = 10; // Define maxEntries globally
 
 // Data array
 
-struct bleSignal {							// Storing received data from Nano BLE
-	String title;
-	String date;
-	String time;
-	String category;
-	String percentage;
+const size_t titleLength = 60;				// Longest title, all a Nano BLE frame has room for after ",U,0"
+
+struct bleSignal {							// Storing received data from Nano BLE, fixed width so copies never touch the heap
+	char title[titleLength + 1];			// Sound title
+	char date[11];							// DD-MM-YYYY
+	char time[9];							// HH:MM:SS
+	char category[5];						// U, P, A, F, O or ME-x for manual entries
+	char percentage[6];						// 0% - 100%
 };
 
-extern String dataReceived;						// Storing received data from Nano BLE
+static_assert(std::is_trivially_copyable<bleSignal>::value, "bleSignal must stay trivially copyable");
+
+// Copy a field into a record, trimming whitespace and control characters. False if it had to be
+// truncated to fit.
+
+template <size_t N>
+bool setField(char (&field)[N], const char* start, const char* end) {
+
+	while (start < end && isspace((unsigned char)*start)) start++;
+	while (end > start && isspace((unsigned char)*(end - 1))) end--;
+
+	size_t length = min((size_t)(end - start), N - 1);
+
+	memcpy(field, start, length);
+	field[length] = '\0';
+
+	return length == (size_t)(end - start);
+
+} // Close function
+
 extern bleSignal dataEntries[maxEntries];		// Array to store the last 10 entries
 extern boolean newDataReceived;					// Flag for each time serial data is received
 
@@ -49,6 +86,12 @@ extern boolean newDataReceived;					// Flag for each time serial data is receive
 
 // Functions
 
+// Storage lock
+
+void lockStorage();
+
+void unlockStorage();
+
 // Read file
 
 String readFile(fs::FS& fs, const char* path);
@@ -69,29 +112,39 @@ bool createCSVFile(const char* fileName);
 
 void appendFile(fs::FS& fs, const char* path, bleSignal newData);
 
-// Convert String to CSV line
+// Parse CSV line into a record
+
+bleSignal parseCSVLine(const char* line, size_t length);
+
+// Convert record to CSV line
 
-String toCSVLine(const bleSignal& data);
+size_t formatCSVLine(const bleSignal& data, char* buffer, size_t size);
 
-// Wait for category selection
+// Show the next uncategorised entry, false when there isnt one
 
-String waitForCategorySelection();
+bool beginCategorise(fs::FS& fs, const char* path);
 
-// Categorise entries
+// Set the category of the entry beginCategorise() showed
 
-void categorizeEntries(fs::FS& fs, const char* path);
+void applyCategory(fs::FS& fs, const char* path, char category);
 
 // Add manual entry
 
-void addManualEntry(fs::FS& fs, const char* path);
+void addManualEntry(fs::FS& fs, const char* path, char category);
+
+// Create CSV file copy, opened here and copied a buffer per dataCopyStep() call
+
+bool beginDataCopy(fs::FS& fs, const char* path);
+
+copyStatus dataCopyStep();
 
-// Create CSV file copy
+// Cut a file on the SD card down to length bytes
 
-bool createDataCopy(fs::FS& fs, const char* path);
+bool truncateFile(const char* path, size_t length);
 
-// Delete last entry
+// Delete the last count entries
 
-void deleteLastEntry(fs::FS& fs, const char* path);
+void deleteLastEntry(fs::FS& fs, const char* path, int count = 1);
 
 #endif
 
@@ -13,7 +13,10 @@
 #include "global.h"					// Global
 #include "colours.h"				// Colour pallette
 #include "screenLayout.h"			// Screen layout
-#include "icons.h"					// Icons
+#include "iconAssets.h"				// Icons
+#include "mainDisplay.h"			// Display layout
+#include "glyphCache.h"				// Cached font glyphs
+#include "displayPower.h"			// Display sleep
 
 // Debug serial prints
 
@@ -51,6 +54,8 @@ byte screenMenu = 1;				// Set screen menu
 
 ESP32Time rtc;						// Configure time settings
 
+static char lastShown[maxTextLength + 1] = "";	// Date & time on the status line now
+
 /*---------------------------------------------------------------- */
 
 // Functions
@@ -103,7 +108,11 @@ int min(int a, int b) {
 
 // Get and print time
 
-void printLocalTime() {
+void printLocalTime(bool redraw) {
+
+	// Left for wake while the display is dark
+
+	if (!displayRender(displayClock)) return;
 
 	// Set time zone
 
@@ -123,33 +132,31 @@ void printLocalTime() {
 
 		rtc.setTime(00, 00, 00, 01, 01, 2021);
 
-		tft.setTextColor(BLACK, WHITE);
-		tft.setFreeFont();
-		tft.setTextSize(1);
-		tft.setCursor(13, 220);
-		tft.println("Failed, time set to default.");
+		drawText(13, 220, "Failed, time set to default.", BLACK, WHITE, 39);
+
+		lastShown[0] = '\0';
 
 		return;
 	}
 
-	Serial.println(&timeinfo, "%A, %B %d %Y %H:%M");
+	// Only redraw when the minute has moved on, padding covers the tail of a longer date
+
+	char shown[maxTextLength + 1];
 
-	// Text block to over write characters from longer dates when date changes and unit has been running
+	strftime(shown, sizeof(shown), "%A, %B %d %Y %H:%M", &timeinfo);
 
-	tft.setTextColor(BLACK, WHITE);
-	tft.setFreeFont();
-	tft.setTextSize(1);
-	tft.setCursor(150, 220);
-	tft.println("                ");
+	if (!redraw && strcmp(shown, lastShown) == 0) return;
 
-	// Actual date time to display
+	Serial.println(shown);
 
-	tft.setTextColor(BLACK, WHITE);
-	tft.setFreeFont();
-	tft.setTextSize(1);
-	tft.setCursor(13, 220);
-	tft.println(&timeinfo, "%A, %B %d %Y %H:%M");
+	// Actual date time to display, usually only the minute has changed. Cleared or showing the
+	// failure message, the whole line is drawn
 
+	if (redraw || lastShown[0] == '\0') drawText(13, 220, shown, BLACK, WHITE, 39);
+
+	else drawTextOver(13, 220, shown, lastShown, BLACK, WHITE, 39);
+
+	strcpy(lastShown, shown);
 
 } // Close function
 
@@ -167,74 +174,3 @@ void printPadded(String str, int width) {
 } // Close function
 
 /*-----------------------------------------------------------------*/
-
-// Yes / No check
-
-bool areYouSure() {
-
-	tft.fillRect(15, 60, 233, 40, LTRED);
-	tft.setFreeFont(&FreeSans12pt7b);
-	tft.setTextSize(1);
-	tft.setTextColor(DKBLUE); tft.setCursor(60, 88);
-	tft.print("Are you sure?");
-	
-	// Draw buttons
-
-	drawBitmap(tft, BUTTON3_Y + 1, BUTTON3_X + 1, yesPlease, BUTTON3_W - 2, BUTTON3_H - 2);
-	tft.drawRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-	drawBitmap(tft, BUTTON4_Y + 1, BUTTON4_X + 1, noThanks, BUTTON4_W - 2, BUTTON4_H - 2);
-	tft.drawRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-
-	// Check for touch data
-
-	uint16_t x, y;		// variables for touch data.
-
-	while (tft.getTouch(&x, &y)) {
-
-		// Button three
-
-		if ((x > BUTTON3_X) && (x < (BUTTON3_X + BUTTON3_W))) {
-			if ((y > BUTTON3_Y) && (y <= (BUTTON3_Y + BUTTON3_H))) {
-
-				playTone(buzzerP, buzzerF, buzzerD);
-
-				outputDebug("Button 3 hit ");
-				outputDebugLn("");
-
-				// Hide buttons
-
-				tft.fillRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-				tft.fillRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-
-				return true;
-
-			}
-
-		}
-
-		// Button four
-
-		if ((x > BUTTON4_X) && (x < (BUTTON4_X + BUTTON4_W))) {
-			if ((y > BUTTON4_Y) && (y <= (BUTTON4_Y + BUTTON4_H))) {
-
-				playTone(buzzerP, buzzerF, buzzerD);
-
-				outputDebug("Button 4 hit ");
-				outputDebugLn("");
-
-				// Hide buttons
-
-				tft.fillRect(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, WHITE);
-				tft.fillRect(BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, WHITE);
-
-				return false;
-
-			}
-
-		}
-
-	}
-
-} // Close function
-
-/*-----------------------------------------------------------------*/
@@ -61,16 +61,12 @@ int min(int a, int b);
 
 // Time
 
-void printLocalTime();
+void printLocalTime(bool redraw = false);
 
 // Print padded table
 
 void printPadded(String str, int width);
 
-// Yes / No control
-
-bool areYouSure();
-
 /*---------------------------------------------------------------- */
 
 #endif
@@ -0,0 +1,178 @@
+//
+// glyphCache.cpp
+//
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "glyphCache.h"
+#include "spiBus.h"					// Shared SPI bus
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+static uint8_t glyphAtlas[lastGlyph - firstGlyph + 1][glyphHeight];		// One byte per glyph row, bit 5 is the left column
+static bool glyphsReady = false;
+
+static uint16_t textLine[maxTextLength * glyphWidth * glyphHeight];		// A whole string is built here and pushed in one window
+
+/*---------------------------------------------------------------- */
+
+// Rasterise the font once
+
+void beginGlyphCache() {
+
+	// The font tables are private to TFT_eSPI, so each glyph is drawn into a 1 bit sprite and read back
+
+	TFT_eSprite glyph = TFT_eSprite(&tft);
+
+	glyph.setColorDepth(1);
+
+	if (glyph.createSprite(glyphWidth, glyphHeight) == nullptr) {
+		outputDebugLn("Glyph cache not available, text drawn direct");
+		return;
+	}
+
+	for (char c = firstGlyph; c <= lastGlyph; c++) {
+
+		glyph.fillSprite(TFT_BLACK);
+		glyph.drawChar(0, 0, c, TFT_WHITE, TFT_BLACK, 1);
+
+		for (uint8_t row = 0; row < glyphHeight; row++) {
+
+			uint8_t bits = 0;
+
+			for (uint8_t col = 0; col < glyphWidth; col++) {
+				bits = (bits << 1) | (glyph.readPixel(col, row) != TFT_BLACK);
+			}
+
+			glyphAtlas[c - firstGlyph][row] = bits;
+		}
+	}
+
+	glyph.deleteSprite();
+
+	glyphsReady = true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Draw text as one block
+
+void drawText(int x, int y, const char* text, uint16_t colour, uint16_t background, uint8_t width) {
+
+	size_t length = strlen(text);
+
+	if (length > maxTextLength) length = maxTextLength;
+	if (width > maxTextLength) width = maxTextLength;
+	if (width < length) width = length;
+
+	if (!glyphsReady) {
+
+		char padded[maxTextLength + 1];
+
+		snprintf(padded, sizeof(padded), "%-*.*s", width, (int)length, text);
+
+		busAcquire(busTFT);
+
+		tft.setFreeFont();
+		tft.setTextSize(1);
+		tft.setTextColor(colour, background);
+		tft.setCursor(x, y);
+		tft.print(padded);
+
+		busRelease(busTFT);
+
+		return;
+	}
+
+	// Build the rows of every glyph side by side, so neighbouring characters go out as one run
+
+	const int lineWidth = width * glyphWidth;
+
+	for (uint8_t i = 0; i < width; i++) {
+
+		char c = (i < length) ? text[i] : ' ';
+
+		if (c < firstGlyph || c > lastGlyph) c = ' ';
+
+		const uint8_t* rows = glyphAtlas[c - firstGlyph];
+		uint16_t* pixel = &textLine[i * glyphWidth];
+
+		for (uint8_t row = 0; row < glyphHeight; row++, pixel += lineWidth) {
+
+			uint8_t bits = rows[row];
+
+			for (uint8_t col = 0; col < glyphWidth; col++) {
+				pixel[col] = (bits & (0x20 >> col)) ? colour : background;
+			}
+		}
+	}
+
+	busAcquire(busTFT);
+
+	bool swapBytes = tft.getSwapBytes();
+
+	tft.setSwapBytes(true);
+	tft.pushImage(x, y, lineWidth, glyphHeight, textLine);
+	tft.setSwapBytes(swapBytes);
+
+	busRelease(busTFT);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Draw over the text already on screen
+
+void drawTextOver(int x, int y, const char* text, const char* shown, uint16_t colour, uint16_t background, uint8_t width) {
+
+	size_t length = min(strlen(text), (size_t)maxTextLength);
+	size_t before = min(strlen(shown), (size_t)maxTextLength);
+
+	size_t cells = max((size_t)width, max(length, before));
+
+	if (cells > maxTextLength) cells = maxTextLength;
+
+	// Both strings read as padded with spaces, as drawText() put them on screen
+
+	auto textAt = [&](size_t i) { return (i < length) ? text[i] : ' '; };
+	auto shownAt = [&](size_t i) { return (i < before) ? shown[i] : ' '; };
+
+	size_t first = 0;
+	size_t last = cells;
+
+	while (first < cells && textAt(first) == shownAt(first)) first++;
+
+	if (first == cells) return;			// Nothing has changed
+
+	while (textAt(last - 1) == shownAt(last - 1)) last--;
+
+	char span[maxTextLength + 1];
+
+	for (size_t i = first; i < last; i++) span[i - first] = textAt(i);
+
+	span[last - first] = '\0';
+
+	drawText(x + first * glyphWidth, y, span, colour, background, last - first);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
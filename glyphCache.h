@@ -0,0 +1,48 @@
+// glyphCache.h
+
+#ifndef _GLYPHCACHE_h
+#define _GLYPHCACHE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "global.h"
+
+/*---------------------------------------------------------------- */
+
+// Glyph sizes, the built in 6 x 8 font at text size 1
+
+const uint8_t glyphWidth = 6;
+const uint8_t glyphHeight = 8;
+
+const char firstGlyph = ' ';				// Printable ASCII is cached, anything else draws as a space
+const char lastGlyph = '~';
+
+const uint8_t maxTextLength = 40;			// Longest string drawText() renders, the status line is the longest
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Rasterise the font once, call after tft.begin()
+
+void beginGlyphCache();
+
+// Draw text in the built in font, padded with spaces to width characters, as one block
+
+void drawText(int x, int y, const char* text, uint16_t colour, uint16_t background, uint8_t width = 0);
+
+// Draw over shown, the text already at x, y, sending only the characters between the first and last that differ
+
+void drawTextOver(int x, int y, const char* text, const char* shown, uint16_t colour, uint16_t background, uint8_t width = 0);
+
+#endif
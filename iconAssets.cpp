@@ -0,0 +1,1204 @@
+//
+// iconAssets.cpp
+//
+
+// Generated by tools/convertIcons.py from assets/, do not edit
+
+#include "iconAssets.h"
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t wiFiPalette[] = {
+	0xffff, 0xffff, 0xf7be, 0xffdf, 0x52ab, 0x4a6a, 0x4a8b, 0xb596, 0xf79e, 0xef5d, 0x0000, 0xef7d,
+	0xa534, 0x00e3, 0xdedb, 0x1040, 0xb5b6, 0x5aeb, 0xe73c, 0x4a23, 0xad55, 0xad96, 0xdefb, 0xbdf7,
+	0xa535, 0xbdd7, 0x4a08, 0x4b63, 0x9492, 0x0000, 0x528b, 0x4a08, 0xce59, 0x0840, 0x5269, 0x5aaa,
+	0x0863, 0x2180, 0x2966, 0xe71c, 0x4a28, 0x0040, 0x20e3, 0xa514, 0xd6ba, 0x0003, 0x0080, 0x94b2,
+	0x0000, 0x4a29, 0x5249, 0x5acb, 0x4a49, 0x41e8, 0x4a69, 0x1841, 0x528b, 0x18a1, 0xb5b7, 0x0061,
+	0x4249, 0x73ae, 0x9492, 0x1880, 0x0860, 0x73af, 0xa555, 0xce79, 0x18e1, 0x73cf, 0x738e, 0x39a6,
+	0x0001, 0xd69a, 0x3187, 0x2104, 0x5269, 0x632c, 0x0041, 0x528a, 0x7c10, 0x7bcf, 0xad75, 0x41e7,
+	0x4a48, 0x5b2d, 0x4a8a, 0x4ac3, 0x9cd3, 0x4a08, 0x7bf0, 0x4a4a, 0x9cf3, 0x5289, 0x6b6d, 0x6b6e,
+	0x9cd3, 0x4a89, 0x0000, 0x4a49,
+};
+
+static const uint8_t wiFiTint[] = {
+	0, 15, 0, 0, 1, 1, 1, 0, 0, 0, 11, 0, 0, 14, 0, 11, 0, 0, 0, 14, 0, 1, 0, 0,
+	1, 0, 5, 14, 0, 10, 1, 6, 0, 11, 1, 1, 10, 13, 10, 0, 6, 13, 9, 0, 0, 14, 13, 0,
+	13, 6, 3, 1, 4, 7, 1, 12, 3, 12, 1, 10, 1, 0, 1, 11, 9, 1, 1, 0, 12, 1, 0, 7,
+	12, 0, 8, 11, 2, 0, 10, 1, 1, 0, 0, 7, 5, 1, 1, 14, 1, 7, 1, 5, 0, 1, 0, 1,
+	0, 1, 12, 1,
+};
+
+static const uint8_t wiFiData[] = {
+	0xb2, 0x00, 0x05, 0x16, 0x5c, 0x14, 0x17, 0x0e, 0x02, 0x90, 0x00, 0x09, 0x02, 0x63, 0x3f, 0x21, 0x1d, 0x34, 0x04, 0x55, 0x19, 0x02, 0x8d, 0x00,
+	0x0b, 0x03, 0x05, 0x0a, 0x39, 0x0d, 0x01, 0x01, 0x0d, 0x4a, 0x06, 0x0c, 0x02, 0x8c, 0x00, 0x0b, 0x12, 0x15, 0x1c, 0x3d, 0x04, 0x23, 0x24, 0x13,
+	0x01, 0x59, 0x04, 0x0e, 0x8c, 0x00, 0x00, 0x08, 0x82, 0x00, 0x07, 0x12, 0x07, 0x04, 0x35, 0x01, 0x2d, 0x22, 0x07, 0x8a, 0x00, 0x0d, 0x45, 0x04,
+	0x1e, 0x04, 0x5a, 0x20, 0x02, 0x03, 0x3a, 0x05, 0x30, 0x01, 0x32, 0x18, 0x88, 0x00, 0x01, 0x08, 0x5d, 0x82, 0x01, 0x0a, 0x2e, 0x1a, 0x06, 0x07,
+	0x03, 0x09, 0x11, 0x26, 0x01, 0x32, 0x07, 0x88, 0x00, 0x0f, 0x2f, 0x05, 0x33, 0x38, 0x0a, 0x13, 0x1b, 0x28, 0x11, 0x09, 0x02, 0x46, 0x26, 0x01,
+	0x22, 0x0e, 0x89, 0x00, 0x0e, 0x08, 0x27, 0x14, 0x04, 0x31, 0x57, 0x29, 0x05, 0x0e, 0x02, 0x11, 0x30, 0x2d, 0x04, 0x03, 0x86, 0x00, 0x10, 0x2c,
+	0x1c, 0x18, 0x43, 0x02, 0x03, 0x10, 0x36, 0x25, 0x0d, 0x05, 0x09, 0x09, 0x56, 0x01, 0x53, 0x0c, 0x85, 0x00, 0x12, 0x02, 0x3c, 0x37, 0x0f, 0x1a,
+	0x06, 0x14, 0x03, 0x16, 0x05, 0x25, 0x29, 0x11, 0x03, 0x07, 0x35, 0x01, 0x06, 0x02, 0x84, 0x00, 0x12, 0x03, 0x05, 0x40, 0x62, 0x01, 0x01, 0x1f,
+	0x5e, 0x08, 0x16, 0x61, 0x1b, 0x28, 0x07, 0x03, 0x06, 0x13, 0x47, 0x19, 0x85, 0x00, 0x11, 0x0b, 0x17, 0x60, 0x04, 0x54, 0x01, 0x4b, 0x5f, 0x03,
+	0x10, 0x1f, 0x1b, 0x06, 0x02, 0x07, 0x24, 0x0d, 0x4d, 0x88, 0x00, 0x0f, 0x03, 0x52, 0x4c, 0x01, 0x1f, 0x15, 0x03, 0x04, 0x13, 0x1a, 0x20, 0x12,
+	0x23, 0x01, 0x1e, 0x02, 0x84, 0x00, 0x12, 0x0b, 0x0c, 0x18, 0x09, 0x00, 0x15, 0x31, 0x01, 0x06, 0x02, 0x42, 0x0a, 0x2e, 0x50, 0x00, 0x04, 0x01,
+	0x34, 0x0e, 0x83, 0x00, 0x13, 0x0b, 0x06, 0x0a, 0x0f, 0x05, 0x09, 0x03, 0x04, 0x01, 0x5b, 0x49, 0x27, 0x38, 0x01, 0x04, 0x00, 0x41, 0x0d, 0x1d,
+	0x17, 0x83, 0x00, 0x13, 0x07, 0x3b, 0x01, 0x01, 0x0f, 0x2b, 0x00, 0x58, 0x48, 0x0f, 0x0c, 0x08, 0x33, 0x01, 0x1e, 0x00, 0x3e, 0x44, 0x21, 0x14,
+	0x83, 0x00, 0x13, 0x10, 0x2a, 0x01, 0x01, 0x0a, 0x0c, 0x00, 0x19, 0x1d, 0x37, 0x1c, 0x00, 0x05, 0x01, 0x04, 0x02, 0x15, 0x0a, 0x0f, 0x2b, 0x83,
+	0x00, 0x13, 0x08, 0x04, 0x2a, 0x4e, 0x06, 0x0b, 0x00, 0x0b, 0x06, 0x36, 0x2c, 0x00, 0x2f, 0x4f, 0x51, 0x00, 0x12, 0x05, 0x05, 0x16, 0x84, 0x00,
+	0x03, 0x08, 0x10, 0x07, 0x0b, 0x82, 0x00, 0x01, 0x03, 0x02, 0x82, 0x00, 0x00, 0x08, 0x82, 0x00, 0x01, 0x03, 0x02, 0xb2, 0x00,
+};
+
+const iconAsset wiFiRed = { 24, 24, wiFiPalette, wiFiTint, wiFiData, false, 0xd861 };
+const iconAsset wiFiGreen = { 24, 24, wiFiPalette, wiFiTint, wiFiData, false, 0x1527 };
+const iconAsset wiFiAmber = { 24, 24, wiFiPalette, wiFiTint, wiFiData, false, 0xec80 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t pulsePalette[] = {
+	0xffff, 0xffff, 0xffff, 0xeefc, 0xffdf, 0xf79f, 0xddf7, 0xf71d, 0xf79d, 0xee9c, 0xff9f, 0xffdf,
+	0xf75c, 0xf77f, 0xde59, 0xeefe, 0xf77e, 0xffbf, 0xde39, 0xf75d, 0xf77e, 0xd618, 0xeedf, 0xeedc,
+	0xef1e, 0xeedb, 0xde5b, 0xee9c, 0xef1d, 0xf79e, 0xf6fc, 0xf73d, 0xef1b, 0xeedc, 0xe67a, 0xe679,
+	0xf75e, 0xde5a, 0xf79e, 0xf75d, 0xc4ad, 0xd594, 0xef1c, 0xffbe, 0xef3d, 0xeebb, 0xeefd, 0xde3a,
+	0xe69b,
+};
+
+static const uint8_t pulseTint[] = {
+	0, 15, 1, 5, 1, 4, 13, 5, 1, 8, 3, 2, 2, 5, 8, 8, 3, 2, 9, 2, 2, 10, 13, 8,
+	8, 6, 10, 14, 6, 2, 7, 5, 2, 7, 7, 5, 5, 10, 1, 3, 14, 11, 3, 1, 6, 6, 6, 11,
+	9,
+};
+
+static const uint8_t pulseData[] = {
+	0xe9, 0x00, 0x01, 0x04, 0x0a, 0x95, 0x00, 0x02, 0x2e, 0x01, 0x04, 0x94, 0x00, 0x02, 0x12, 0x01, 0x1d, 0x93, 0x00, 0x03, 0x02, 0x01, 0x01, 0x05,
+	0x93, 0x00, 0x03, 0x08, 0x01, 0x01, 0x03, 0x93, 0x00, 0x03, 0x10, 0x01, 0x01, 0x09, 0x90, 0x00, 0x06, 0x0d, 0x21, 0x00, 0x1f, 0x01, 0x2f, 0x06,
+	0x8f, 0x00, 0x08, 0x26, 0x28, 0x01, 0x04, 0x18, 0x06, 0x07, 0x01, 0x04, 0x8e, 0x00, 0x08, 0x22, 0x01, 0x01, 0x13, 0x29, 0x17, 0x20, 0x01, 0x14,
+	0x89, 0x00, 0x00, 0x05, 0x82, 0x03, 0x0a, 0x2d, 0x01, 0x0f, 0x01, 0x19, 0x01, 0x07, 0x0b, 0x01, 0x2a, 0x08, 0x87, 0x03, 0x01, 0x05, 0x0e, 0x83,
+	0x01, 0x09, 0x25, 0x02, 0x06, 0x1b, 0x01, 0x27, 0x02, 0x01, 0x2c, 0x09, 0x87, 0x01, 0x00, 0x0e, 0x85, 0x02, 0x09, 0x00, 0x0f, 0x01, 0x01, 0x11,
+	0x00, 0x15, 0x16, 0x01, 0x1c, 0x87, 0x02, 0x86, 0x00, 0x08, 0x24, 0x01, 0x01, 0x02, 0x00, 0x1e, 0x01, 0x01, 0x0b, 0x8e, 0x00, 0x07, 0x0c, 0x01,
+	0x1a, 0x00, 0x00, 0x0d, 0x01, 0x30, 0x8f, 0x00, 0x07, 0x04, 0x01, 0x23, 0x00, 0x00, 0x0a, 0x01, 0x05, 0x90, 0x00, 0x06, 0x10, 0x2b, 0x00, 0x00,
+	0x02, 0x0c, 0x02, 0xe8, 0x00,
+};
+
+const iconAsset pulseRed = { 24, 24, pulsePalette, pulseTint, pulseData, false, 0xd861 };
+const iconAsset pulseAmber = { 24, 24, pulsePalette, pulseTint, pulseData, false, 0xec80 };
+const iconAsset pulseGreen = { 24, 24, pulsePalette, pulseTint, pulseData, false, 0x1527 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t sdCardGreenPalette[] = {
+	0x63f1, 0xffff, 0x0000, 0x05fa, 0xcedb, 0x31e8, 0x05b9, 0x632c, 0xa514, 0xe73c, 0x29c8, 0x02cc,
+	0x3209, 0x02ac, 0x10a2, 0x29a7, 0x0082, 0x4aed, 0x0041, 0x0229, 0x636d, 0x6b8e, 0x022a, 0xad75,
+	0x0861, 0x39c7, 0x52aa, 0xef7d, 0x1904, 0x534e, 0x7cb4, 0x0020, 0x03f1, 0x39e7, 0x10e4, 0x3a8b,
+	0x3229, 0xf7be, 0x3a4a, 0x31a6, 0x10c3, 0x5bd1, 0x0062, 0x5acb, 0x536f, 0xffdf, 0x0516, 0xe71c,
+	0x10a3, 0x4249, 0x2124, 0xe73d, 0x2146, 0xc618, 0x00c3, 0x5bb0, 0x9cf3, 0x0537, 0x2965, 0x8410,
+	0x2145, 0x2187, 0xce59, 0x0104, 0x638f, 0x4a69, 0x8c51, 0x18e3, 0x8c71, 0x4a49, 0x10e3, 0x428b,
+	0x8471, 0x2986, 0x0166, 0xef5d, 0x0473, 0x04b5, 0x0557, 0x9d34, 0x9492, 0x8c72, 0x528a, 0x0412,
+};
+
+static const uint8_t sdCardGreenData[] = {
+	0x02, 0x2d, 0x08, 0x19, 0x88, 0x02, 0x02, 0x43, 0x44, 0x1b, 0x88, 0x01, 0x0f, 0x08, 0x0e, 0x0f, 0x0a, 0x02, 0x22, 0x0a, 0x34, 0x02, 0x34, 0x0a,
+	0x22, 0x02, 0x27, 0x2b, 0x1b, 0x87, 0x01, 0x10, 0x19, 0x0f, 0x00, 0x00, 0x02, 0x05, 0x00, 0x11, 0x02, 0x11, 0x00, 0x05, 0x02, 0x1d, 0x21, 0x2b,
+	0x1b, 0x86, 0x01, 0x11, 0x02, 0x05, 0x00, 0x00, 0x02, 0x05, 0x00, 0x11, 0x02, 0x11, 0x00, 0x05, 0x02, 0x00, 0x1d, 0x21, 0x52, 0x4b, 0x85, 0x01,
+	0x12, 0x02, 0x05, 0x00, 0x00, 0x30, 0x23, 0x00, 0x2c, 0x18, 0x2c, 0x00, 0x23, 0x30, 0x00, 0x00, 0x1d, 0x21, 0x1a, 0x1b, 0x84, 0x01, 0x01, 0x0e,
+	0x0a, 0x8d, 0x00, 0x02, 0x1d, 0x27, 0x50, 0x84, 0x01, 0x03, 0x3b, 0x02, 0x46, 0x37, 0x8c, 0x00, 0x01, 0x0a, 0x3a, 0x84, 0x01, 0x03, 0x25, 0x35,
+	0x02, 0x24, 0x8c, 0x00, 0x01, 0x05, 0x02, 0x86, 0x01, 0x01, 0x02, 0x05, 0x8c, 0x00, 0x01, 0x23, 0x07, 0x86, 0x01, 0x01, 0x02, 0x05, 0x8d, 0x00,
+	0x00, 0x33, 0x84, 0x01, 0x03, 0x25, 0x35, 0x02, 0x24, 0x8d, 0x00, 0x00, 0x33, 0x84, 0x01, 0x03, 0x3b, 0x18, 0x22, 0x37, 0x89, 0x00, 0x06, 0x11,
+	0x3c, 0x18, 0x02, 0x45, 0x38, 0x2f, 0x82, 0x01, 0x01, 0x0e, 0x0a, 0x89, 0x00, 0x10, 0x29, 0x3d, 0x02, 0x10, 0x16, 0x0b, 0x16, 0x1c, 0x02, 0x17,
+	0x01, 0x01, 0x02, 0x05, 0x00, 0x26, 0x12, 0x83, 0x02, 0x06, 0x28, 0x1e, 0x1e, 0x05, 0x02, 0x0b, 0x06, 0x82, 0x03, 0x09, 0x06, 0x0d, 0x02, 0x17,
+	0x01, 0x02, 0x05, 0x00, 0x12, 0x3a, 0x83, 0x07, 0x04, 0x48, 0x04, 0x4f, 0x02, 0x0b, 0x86, 0x03, 0x07, 0x0d, 0x02, 0x2f, 0x02, 0x05, 0x00, 0x02,
+	0x14, 0x85, 0x04, 0x02, 0x31, 0x10, 0x06, 0x83, 0x03, 0x0a, 0x2e, 0x36, 0x20, 0x06, 0x1c, 0x38, 0x02, 0x05, 0x00, 0x02, 0x14, 0x85, 0x04, 0x11,
+	0x0e, 0x16, 0x03, 0x39, 0x06, 0x03, 0x4e, 0x36, 0x2a, 0x2e, 0x03, 0x13, 0x1a, 0x02, 0x05, 0x00, 0x02, 0x14, 0x85, 0x04, 0x11, 0x1f, 0x0b, 0x03,
+	0x10, 0x4a, 0x39, 0x3f, 0x12, 0x4d, 0x03, 0x03, 0x0b, 0x32, 0x02, 0x05, 0x00, 0x02, 0x14, 0x85, 0x04, 0x07, 0x0e, 0x16, 0x03, 0x20, 0x02, 0x1f,
+	0x1f, 0x4c, 0x82, 0x03, 0x06, 0x13, 0x1a, 0x02, 0x05, 0x00, 0x12, 0x49, 0x83, 0x15, 0x08, 0x51, 0x04, 0x31, 0x10, 0x06, 0x03, 0x20, 0x10, 0x53,
+	0x82, 0x03, 0x07, 0x06, 0x1c, 0x08, 0x02, 0x05, 0x00, 0x26, 0x12, 0x83, 0x02, 0x04, 0x28, 0x1e, 0x40, 0x02, 0x0d, 0x86, 0x03, 0x04, 0x0d, 0x18,
+	0x09, 0x19, 0x0f, 0x89, 0x00, 0x03, 0x0f, 0x02, 0x0d, 0x06, 0x82, 0x03, 0x07, 0x06, 0x0d, 0x02, 0x17, 0x01, 0x08, 0x0e, 0x0f, 0x85, 0x0c, 0x11,
+	0x47, 0x00, 0x00, 0x29, 0x0f, 0x02, 0x2a, 0x13, 0x0b, 0x13, 0x1c, 0x02, 0x17, 0x01, 0x01, 0x2d, 0x08, 0x19, 0x85, 0x02, 0x00, 0x07, 0x83, 0x09,
+	0x06, 0x3e, 0x42, 0x41, 0x32, 0x1a, 0x08, 0x09, 0x82, 0x01,
+};
+
+const iconAsset sdCardGreen = { 24, 24, sdCardGreenPalette, nullptr, sdCardGreenData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t sdCardRedPalette[] = {
+	0x63f1, 0xffff, 0x0000, 0xf206, 0xcedb, 0x31e8, 0xea06, 0x70e3, 0x68e3, 0x58c2, 0x632c, 0xa514,
+	0xe73c, 0x29c8, 0x3209, 0x10a2, 0x29a7, 0x4aed, 0x636d, 0x6b8e, 0x20e3, 0xad75, 0x0861, 0x39c7,
+	0x52aa, 0xef7d, 0x0041, 0x534e, 0x0800, 0x7cb4, 0x39e7, 0x2861, 0x10e4, 0x3a8b, 0x3229, 0xf7be,
+	0x3a4a, 0x31a6, 0x7103, 0x10c3, 0x5bd1, 0x5acb, 0x536f, 0xffdf, 0xe71c, 0x10a3, 0x4249, 0x2124,
+	0xe73d, 0x1040, 0x2146, 0xc618, 0x5bb0, 0x1020, 0x9cf3, 0x2965, 0x8410, 0x2145, 0x2187, 0xce59,
+	0x638f, 0x4a69, 0x8c51, 0x18e3, 0x0020, 0x8c71, 0x4a49, 0x10e3, 0x428b, 0x8471, 0x2986, 0xef5d,
+	0x3061, 0x9d34, 0x9492, 0x8c72, 0x528a,
+};
+
+static const uint8_t sdCardRedData[] = {
+	0x02, 0x2b, 0x0b, 0x17, 0x88, 0x02, 0x02, 0x3f, 0x41, 0x19, 0x88, 0x01, 0x0f, 0x0b, 0x0f, 0x10, 0x0d, 0x02, 0x20, 0x0d, 0x32, 0x02, 0x32, 0x0d,
+	0x20, 0x02, 0x25, 0x29, 0x19, 0x87, 0x01, 0x10, 0x17, 0x10, 0x00, 0x00, 0x02, 0x05, 0x00, 0x11, 0x02, 0x11, 0x00, 0x05, 0x02, 0x1b, 0x1e, 0x29,
+	0x19, 0x86, 0x01, 0x11, 0x02, 0x05, 0x00, 0x00, 0x02, 0x05, 0x00, 0x11, 0x02, 0x11, 0x00, 0x05, 0x02, 0x00, 0x1b, 0x1e, 0x4c, 0x47, 0x85, 0x01,
+	0x12, 0x02, 0x05, 0x00, 0x00, 0x2d, 0x21, 0x00, 0x2a, 0x16, 0x2a, 0x00, 0x21, 0x2d, 0x00, 0x00, 0x1b, 0x1e, 0x18, 0x19, 0x84, 0x01, 0x01, 0x0f,
+	0x0d, 0x8d, 0x00, 0x02, 0x1b, 0x25, 0x4a, 0x84, 0x01, 0x03, 0x38, 0x02, 0x43, 0x34, 0x8c, 0x00, 0x01, 0x0d, 0x37, 0x84, 0x01, 0x03, 0x23, 0x33,
+	0x02, 0x22, 0x8c, 0x00, 0x01, 0x05, 0x02, 0x86, 0x01, 0x01, 0x02, 0x05, 0x8c, 0x00, 0x01, 0x21, 0x0a, 0x86, 0x01, 0x01, 0x02, 0x05, 0x8d, 0x00,
+	0x00, 0x30, 0x84, 0x01, 0x03, 0x23, 0x33, 0x02, 0x22, 0x8d, 0x00, 0x00, 0x30, 0x84, 0x01, 0x03, 0x38, 0x16, 0x20, 0x34, 0x89, 0x00, 0x06, 0x11,
+	0x39, 0x16, 0x02, 0x42, 0x36, 0x2c, 0x82, 0x01, 0x01, 0x0f, 0x0d, 0x89, 0x00, 0x10, 0x28, 0x3a, 0x02, 0x35, 0x09, 0x07, 0x09, 0x14, 0x02, 0x15,
+	0x01, 0x01, 0x02, 0x05, 0x00, 0x24, 0x1a, 0x83, 0x02, 0x06, 0x27, 0x1d, 0x1d, 0x05, 0x02, 0x07, 0x06, 0x82, 0x03, 0x09, 0x06, 0x07, 0x02, 0x15,
+	0x01, 0x02, 0x05, 0x00, 0x1a, 0x37, 0x83, 0x0a, 0x06, 0x45, 0x04, 0x49, 0x02, 0x07, 0x03, 0x06, 0x82, 0x03, 0x09, 0x06, 0x03, 0x07, 0x02, 0x2c,
+	0x02, 0x05, 0x00, 0x02, 0x12, 0x85, 0x04, 0x11, 0x2e, 0x31, 0x06, 0x06, 0x1c, 0x08, 0x03, 0x08, 0x1c, 0x06, 0x06, 0x14, 0x36, 0x02, 0x05, 0x00,
+	0x02, 0x12, 0x85, 0x04, 0x11, 0x0f, 0x09, 0x03, 0x03, 0x08, 0x02, 0x1f, 0x02, 0x08, 0x03, 0x03, 0x09, 0x18, 0x02, 0x05, 0x00, 0x02, 0x12, 0x85,
+	0x04, 0x01, 0x40, 0x26, 0x82, 0x03, 0x02, 0x48, 0x02, 0x1f, 0x82, 0x03, 0x06, 0x26, 0x2f, 0x02, 0x05, 0x00, 0x02, 0x12, 0x85, 0x04, 0x11, 0x0f,
+	0x09, 0x03, 0x03, 0x08, 0x02, 0x1f, 0x02, 0x08, 0x03, 0x03, 0x09, 0x18, 0x02, 0x05, 0x00, 0x1a, 0x46, 0x83, 0x13, 0x13, 0x4b, 0x04, 0x2e, 0x31,
+	0x06, 0x06, 0x1c, 0x08, 0x03, 0x08, 0x1c, 0x06, 0x06, 0x14, 0x0b, 0x02, 0x05, 0x00, 0x24, 0x1a, 0x83, 0x02, 0x06, 0x27, 0x1d, 0x3c, 0x02, 0x07,
+	0x03, 0x06, 0x82, 0x03, 0x06, 0x06, 0x03, 0x07, 0x16, 0x0c, 0x17, 0x10, 0x89, 0x00, 0x03, 0x10, 0x02, 0x07, 0x06, 0x82, 0x03, 0x07, 0x06, 0x08,
+	0x02, 0x15, 0x01, 0x0b, 0x0f, 0x10, 0x85, 0x0e, 0x11, 0x44, 0x00, 0x00, 0x28, 0x10, 0x02, 0x35, 0x09, 0x07, 0x09, 0x14, 0x02, 0x15, 0x01, 0x01,
+	0x2b, 0x0b, 0x17, 0x85, 0x02, 0x00, 0x0a, 0x83, 0x0c, 0x06, 0x3b, 0x3e, 0x3d, 0x2f, 0x18, 0x0b, 0x0c, 0x82, 0x01,
+};
+
+const iconAsset sdCardRed = { 24, 24, sdCardRedPalette, nullptr, sdCardRedData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t yesPleasePalette[] = {
+	0xcf2b, 0xffff, 0xcf2a, 0xcf0a, 0x0000, 0xd76b, 0xcf0b, 0xffdf, 0xcf4b, 0xd74b, 0xd78b, 0xc70a,
+	0x0861, 0xd6ba, 0xdedb, 0xc638, 0x10a2, 0xf7be, 0xa514, 0x4a69, 0x5b45, 0xe73c, 0xae09, 0xbe8a,
+	0xce59, 0x7bcf, 0x4245, 0xef7d, 0xc6ea, 0x52c4, 0x9508, 0xbeaa, 0x0860, 0x2965, 0x6b4d, 0x10a1,
+	0x18c3, 0x6365, 0xdfab, 0xad55, 0x31a4, 0xb596, 0x3a23, 0x73ae, 0x9d88, 0x6bc7, 0xa5a9, 0x18e3,
+	0x6b6d, 0x2945, 0x0840, 0xb649, 0x52e4, 0x4ac4, 0xa5a8, 0x5aeb, 0x7c46, 0x4aa4, 0x738e, 0x0020,
+	0x8ce8, 0x3186, 0x632c, 0x4a85, 0x9d89, 0x18e1, 0x73e6, 0x10c1, 0x1901, 0x4aa5, 0x39e7, 0x9492,
+	0x3a03, 0xdefb, 0x18e2, 0x8ce7, 0xc70b, 0x4208, 0x7427, 0x52e6, 0x9528, 0x1081, 0xe71c, 0xc6ca,
+	0x9509, 0xef5d, 0xc618, 0x4243, 0xb5b6, 0x10a0, 0x7407, 0x8d08, 0xa534, 0xa5e9, 0x2124, 0x3a07,
+	0x7bef, 0x52aa, 0x7426, 0x8cc7, 0xa5e8, 0x1082, 0x31c5, 0x3185, 0xd754, 0xad54, 0xf79e, 0xd7ab,
+	0x6bc5, 0x4228, 0x39c6, 0xdeda, 0xce79, 0x6be7, 0x6345, 0x6be5, 0x6ba5, 0x4a49, 0xae29, 0xbdd7,
+	0x2944, 0xad75, 0x2144, 0x7c26, 0x39c7, 0x7406, 0x6be6, 0x4207, 0x0841, 0xce58, 0x5b26, 0x4263,
+	0x5b46, 0x9cf3, 0x528a, 0x8d09, 0x5b06, 0xd734, 0x84c7, 0x5306, 0x5b07, 0xbdd6,
+};
+
+static const uint8_t yesPleaseData[] = {
+	0x90, 0x01, 0x0d, 0x1b, 0x0d, 0x29, 0x47, 0x22, 0x13, 0x31, 0x31, 0x13, 0x22, 0x47, 0x29, 0x0d, 0x1b, 0x9e, 0x01, 0x13, 0x07, 0x0d, 0x27, 0x3e,
+	0x04, 0x0c, 0x0c, 0x32, 0x23, 0x41, 0x41, 0x23, 0x32, 0x0c, 0x04, 0x0c, 0x3e, 0x27, 0x0d, 0x07, 0x99, 0x01, 0x17, 0x07, 0x56, 0x19, 0x04, 0x04,
+	0x59, 0x83, 0x42, 0x4b, 0x2c, 0x64, 0x16, 0x16, 0x64, 0x2c, 0x4b, 0x42, 0x57, 0x59, 0x04, 0x04, 0x19, 0x56, 0x07, 0x96, 0x01, 0x0a, 0x0d, 0x30,
+	0x04, 0x20, 0x1a, 0x3c, 0x17, 0x0b, 0x0a, 0x26, 0x0a, 0x83, 0x05, 0x0a, 0x0a, 0x26, 0x05, 0x4c, 0x17, 0x3c, 0x1a, 0x20, 0x04, 0x30, 0x0d, 0x93,
+	0x01, 0x0b, 0x11, 0x12, 0x04, 0x04, 0x3f, 0x40, 0x09, 0x08, 0x08, 0x00, 0x03, 0x0b, 0x85, 0x03, 0x0b, 0x0b, 0x03, 0x00, 0x08, 0x09, 0x09, 0x40,
+	0x45, 0x04, 0x04, 0x12, 0x6a, 0x90, 0x01, 0x08, 0x52, 0x3a, 0x04, 0x28, 0x5b, 0x08, 0x05, 0x06, 0x06, 0x82, 0x02, 0x07, 0x00, 0x02, 0x02, 0x00,
+	0x00, 0x02, 0x02, 0x00, 0x82, 0x02, 0x81, 0x06, 0x81, 0x05, 0x04, 0x50, 0x28, 0x04, 0x3a, 0x15, 0x8e, 0x01, 0x0a, 0x0e, 0x13, 0x04, 0x8b, 0x1f,
+	0x0a, 0x06, 0x03, 0x00, 0x02, 0x02, 0x8b, 0x00, 0x81, 0x02, 0x08, 0x00, 0x03, 0x06, 0x05, 0x1f, 0x8c, 0x04, 0x13, 0x0e, 0x8c, 0x01, 0x09, 0x49,
+	0x4d, 0x04, 0x2d, 0x05, 0x08, 0x06, 0x02, 0x00, 0x02, 0x8f, 0x00, 0x09, 0x02, 0x00, 0x02, 0x06, 0x08, 0x09, 0x2d, 0x04, 0x4d, 0x49, 0x8a, 0x01,
+	0x09, 0x52, 0x13, 0x04, 0x5a, 0x0a, 0x06, 0x06, 0x00, 0x02, 0x02, 0x91, 0x00, 0x81, 0x02, 0x07, 0x00, 0x06, 0x06, 0x0a, 0x4e, 0x04, 0x75, 0x15,
+	0x88, 0x01, 0x08, 0x11, 0x2b, 0x04, 0x2d, 0x0a, 0x06, 0x03, 0x02, 0x02, 0x95, 0x00, 0x81, 0x02, 0x06, 0x03, 0x06, 0x0a, 0x71, 0x04, 0x2b, 0x11,
+	0x87, 0x01, 0x05, 0x12, 0x04, 0x4f, 0x05, 0x03, 0x03, 0x90, 0x00, 0x02, 0x02, 0x00, 0x00, 0x83, 0x02, 0x09, 0x00, 0x02, 0x00, 0x00, 0x03, 0x03,
+	0x05, 0x4f, 0x04, 0x12, 0x86, 0x01, 0x08, 0x0d, 0x04, 0x28, 0x1f, 0x00, 0x06, 0x00, 0x02, 0x02, 0x90, 0x00, 0x0f, 0x03, 0x00, 0x09, 0x09, 0x00,
+	0x03, 0x00, 0x02, 0x02, 0x00, 0x06, 0x00, 0x1f, 0x28, 0x10, 0x0d, 0x84, 0x01, 0x07, 0x07, 0x22, 0x51, 0x1e, 0x0a, 0x0b, 0x02, 0x02, 0x8f, 0x00,
+	0x81, 0x02, 0x08, 0x03, 0x00, 0x03, 0x14, 0x14, 0x02, 0x08, 0x03, 0x00, 0x82, 0x02, 0x05, 0x0b, 0x0a, 0x50, 0x3b, 0x30, 0x07, 0x83, 0x01, 0x05,
+	0x56, 0x04, 0x45, 0x08, 0x06, 0x03, 0x92, 0x00, 0x12, 0x03, 0x00, 0x00, 0x35, 0x04, 0x04, 0x1d, 0x00, 0x08, 0x03, 0x00, 0x02, 0x00, 0x03, 0x06,
+	0x05, 0x45, 0x0c, 0x0f, 0x82, 0x01, 0x07, 0x11, 0x2b, 0x10, 0x40, 0x05, 0x0b, 0x00, 0x02, 0x8e, 0x00, 0x1f, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1d,
+	0x04, 0x3d, 0x78, 0x04, 0x34, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x05, 0x2e, 0x10, 0x19, 0x07, 0x01, 0x01, 0x0e, 0x0c, 0x1a, 0x09, 0x03,
+	0x02, 0x02, 0x8e, 0x00, 0x1e, 0x02, 0x00, 0x03, 0x02, 0x00, 0x1d, 0x04, 0x21, 0x0e, 0x49, 0x5e, 0x04, 0x1d, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00,
+	0x03, 0x05, 0x1a, 0x10, 0x0e, 0x01, 0x01, 0x5c, 0x0c, 0x3c, 0x09, 0x06, 0x85, 0x00, 0x08, 0x02, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 0x00, 0x02,
+	0x82, 0x00, 0x1e, 0x03, 0x02, 0x02, 0x1d, 0x04, 0x31, 0x0d, 0x01, 0x01, 0x0e, 0x7a, 0x04, 0x1d, 0x02, 0x08, 0x03, 0x00, 0x00, 0x06, 0x09, 0x54,
+	0x0c, 0x27, 0x01, 0x1b, 0x3e, 0x4a, 0x17, 0x08, 0x02, 0x02, 0x83, 0x00, 0x1b, 0x02, 0x00, 0x02, 0x03, 0x05, 0x05, 0x02, 0x02, 0x00, 0x00, 0x02,
+	0x00, 0x03, 0x00, 0x02, 0x1d, 0x04, 0x67, 0x0e, 0x01, 0x07, 0x01, 0x01, 0x6f, 0x3d, 0x04, 0x34, 0x0b, 0x83, 0x02, 0x0a, 0x08, 0x1f, 0x4a, 0x37,
+	0x01, 0x0d, 0x0c, 0x57, 0x4c, 0x02, 0x03, 0x83, 0x00, 0x2b, 0x02, 0x00, 0x02, 0x02, 0x05, 0x63, 0x8a, 0x05, 0x02, 0x03, 0x02, 0x00, 0x03, 0x00,
+	0x02, 0x35, 0x04, 0x21, 0x0d, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x69, 0x04, 0x04, 0x16, 0x05, 0x03, 0x00, 0x03, 0x02, 0x06, 0x39, 0x04, 0x1b,
+	0x29, 0x04, 0x7e, 0x05, 0x0b, 0x03, 0x82, 0x00, 0x09, 0x02, 0x00, 0x02, 0x03, 0x0a, 0x7b, 0x04, 0x04, 0x42, 0x05, 0x82, 0x03, 0x05, 0x00, 0x02,
+	0x35, 0x04, 0x31, 0x0e, 0x83, 0x01, 0x5b, 0x07, 0x01, 0x18, 0x2f, 0x04, 0x25, 0x02, 0x02, 0x03, 0x00, 0x03, 0x0b, 0x0a, 0x4e, 0x0c, 0x0f, 0x47,
+	0x0c, 0x4b, 0x26, 0x0b, 0x02, 0x00, 0x00, 0x02, 0x00, 0x03, 0x03, 0x05, 0x38, 0x04, 0x32, 0x51, 0x04, 0x7d, 0x0a, 0x0b, 0x02, 0x00, 0x1d, 0x04,
+	0x67, 0x0e, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x0f, 0x10, 0x04, 0x14, 0x09, 0x02, 0x03, 0x02, 0x00, 0x02, 0x0b, 0x0a, 0x1e, 0x0c, 0x12, 0x22,
+	0x3b, 0x2c, 0x05, 0x03, 0x00, 0x00, 0x02, 0x00, 0x02, 0x03, 0x05, 0x38, 0x04, 0x80, 0x58, 0x77, 0x0c, 0x04, 0x6c, 0x0a, 0x00, 0x35, 0x04, 0x21,
+	0x0d, 0x01, 0x07, 0x83, 0x01, 0x06, 0x18, 0x24, 0x04, 0x14, 0x08, 0x00, 0x03, 0x83, 0x00, 0x1d, 0x03, 0x05, 0x36, 0x32, 0x19, 0x13, 0x23, 0x5d,
+	0x05, 0x03, 0x02, 0x00, 0x00, 0x02, 0x02, 0x05, 0x38, 0x04, 0x65, 0x29, 0x01, 0x01, 0x8d, 0x0c, 0x04, 0x42, 0x34, 0x04, 0x21, 0x0e, 0x83, 0x01,
+	0x2a, 0x07, 0x01, 0x18, 0x24, 0x04, 0x25, 0x09, 0x02, 0x03, 0x00, 0x02, 0x02, 0x00, 0x02, 0x0b, 0x09, 0x16, 0x43, 0x86, 0x21, 0x41, 0x76, 0x09,
+	0x03, 0x00, 0x00, 0x02, 0x03, 0x08, 0x38, 0x04, 0x65, 0x79, 0x01, 0x07, 0x07, 0x01, 0x58, 0x0c, 0x04, 0x04, 0x21, 0x0e, 0x83, 0x01, 0x0a, 0x07,
+	0x01, 0x0f, 0x10, 0x04, 0x14, 0x05, 0x00, 0x03, 0x00, 0x02, 0x83, 0x00, 0x1d, 0x03, 0x09, 0x33, 0x44, 0x7c, 0x21, 0x41, 0x16, 0x05, 0x03, 0x00,
+	0x00, 0x03, 0x05, 0x16, 0x04, 0x04, 0x85, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x29, 0x24, 0x3d, 0x0d, 0x01, 0x07, 0x83, 0x01, 0x08, 0x81, 0x24,
+	0x04, 0x25, 0x08, 0x00, 0x03, 0x00, 0x02, 0x84, 0x00, 0x14, 0x03, 0x09, 0x33, 0x44, 0x3d, 0x13, 0x23, 0x5d, 0x05, 0x03, 0x02, 0x00, 0x03, 0x00,
+	0x53, 0x48, 0x04, 0x6d, 0x52, 0x01, 0x07, 0x83, 0x01, 0x01, 0x0d, 0x15, 0x83, 0x01, 0x08, 0x07, 0x01, 0x70, 0x24, 0x04, 0x72, 0x09, 0x02, 0x03,
+	0x86, 0x00, 0x16, 0x02, 0x0b, 0x09, 0x16, 0x43, 0x61, 0x22, 0x3b, 0x2c, 0x05, 0x03, 0x00, 0x00, 0x02, 0x03, 0x08, 0x1c, 0x2a, 0x04, 0x46, 0x15,
+	0x01, 0x07, 0x87, 0x01, 0x09, 0x07, 0x01, 0x0f, 0x10, 0x04, 0x14, 0x08, 0x00, 0x03, 0x02, 0x87, 0x00, 0x0a, 0x03, 0x05, 0x36, 0x20, 0x19, 0x47,
+	0x0c, 0x4b, 0x26, 0x0b, 0x02, 0x82, 0x00, 0x06, 0x03, 0x08, 0x1c, 0x2a, 0x04, 0x7f, 0x55, 0x89, 0x01, 0x06, 0x18, 0x2f, 0x04, 0x25, 0x08, 0x02,
+	0x03, 0x88, 0x00, 0x18, 0x02, 0x0b, 0x6b, 0x1e, 0x0c, 0x12, 0x29, 0x04, 0x73, 0x05, 0x0b, 0x03, 0x00, 0x02, 0x00, 0x00, 0x03, 0x08, 0x1c, 0x48,
+	0x04, 0x46, 0x15, 0x01, 0x07, 0x83, 0x01, 0x0b, 0x07, 0x01, 0x18, 0x24, 0x04, 0x14, 0x09, 0x02, 0x03, 0x00, 0x02, 0x02, 0x86, 0x00, 0x0b, 0x03,
+	0x0b, 0x0a, 0x4e, 0x0c, 0x0f, 0x0d, 0x0c, 0x57, 0x4c, 0x02, 0x03, 0x82, 0x00, 0x81, 0x02, 0x15, 0x03, 0x08, 0x1c, 0x2a, 0x04, 0x5f, 0x15, 0x01,
+	0x07, 0x01, 0x01, 0x07, 0x01, 0x0f, 0x10, 0x04, 0x14, 0x09, 0x00, 0x03, 0x02, 0x02, 0x88, 0x00, 0x0c, 0x03, 0x02, 0x06, 0x39, 0x04, 0x1b, 0x1b,
+	0x3e, 0x4a, 0x17, 0x08, 0x02, 0x02, 0x84, 0x00, 0x11, 0x03, 0x08, 0x1c, 0x2a, 0x04, 0x5f, 0x55, 0x01, 0x07, 0x01, 0x01, 0x18, 0x2f, 0x04, 0x25,
+	0x09, 0x02, 0x03, 0x8a, 0x00, 0x81, 0x02, 0x0a, 0x08, 0x17, 0x4a, 0x37, 0x01, 0x01, 0x5c, 0x0c, 0x3c, 0x09, 0x06, 0x83, 0x00, 0x15, 0x02, 0x00,
+	0x00, 0x03, 0x00, 0x1c, 0x48, 0x04, 0x46, 0x15, 0x01, 0x01, 0x18, 0x2f, 0x04, 0x14, 0x08, 0x02, 0x03, 0x00, 0x02, 0x02, 0x89, 0x00, 0x0d, 0x06,
+	0x09, 0x87, 0x0c, 0x27, 0x01, 0x01, 0x0e, 0x0c, 0x1a, 0x09, 0x03, 0x02, 0x02, 0x83, 0x00, 0x81, 0x02, 0x0f, 0x03, 0x08, 0x1c, 0x2a, 0x04, 0x46,
+	0x55, 0x18, 0x10, 0x04, 0x14, 0x08, 0x00, 0x03, 0x02, 0x02, 0x89, 0x00, 0x10, 0x02, 0x00, 0x03, 0x05, 0x1a, 0x10, 0x0e, 0x01, 0x01, 0x11, 0x2b,
+	0x10, 0x40, 0x05, 0x0b, 0x00, 0x02, 0x85, 0x00, 0x0b, 0x03, 0x00, 0x53, 0x2a, 0x04, 0x6e, 0x2f, 0x04, 0x25, 0x08, 0x02, 0x03, 0x8b, 0x00, 0x07,
+	0x02, 0x00, 0x0b, 0x05, 0x2e, 0x10, 0x19, 0x07, 0x82, 0x01, 0x05, 0x0f, 0x04, 0x3f, 0x08, 0x06, 0x03, 0x84, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x03,
+	0x08, 0x1c, 0x48, 0x04, 0x04, 0x14, 0x05, 0x02, 0x03, 0x00, 0x00, 0x02, 0x8a, 0x00, 0x05, 0x03, 0x06, 0x09, 0x3f, 0x0c, 0x0f, 0x83, 0x01, 0x07,
+	0x07, 0x22, 0x51, 0x5b, 0x0a, 0x0b, 0x02, 0x02, 0x84, 0x00, 0x81, 0x02, 0x08, 0x03, 0x08, 0x53, 0x34, 0x74, 0x09, 0x00, 0x03, 0x02, 0x8d, 0x00,
+	0x05, 0x03, 0x0a, 0x1e, 0x3b, 0x30, 0x07, 0x84, 0x01, 0x08, 0x0d, 0x04, 0x28, 0x1f, 0x00, 0x06, 0x00, 0x02, 0x02, 0x85, 0x00, 0x05, 0x03, 0x00,
+	0x08, 0x09, 0x00, 0x03, 0x8b, 0x00, 0x81, 0x02, 0x06, 0x00, 0x03, 0x00, 0x17, 0x66, 0x10, 0x0d, 0x86, 0x01, 0x05, 0x12, 0x04, 0x4f, 0x09, 0x03,
+	0x03, 0x85, 0x00, 0x81, 0x02, 0x00, 0x00, 0x83, 0x02, 0x02, 0x00, 0x02, 0x02, 0x8b, 0x00, 0x05, 0x02, 0x06, 0x09, 0x2c, 0x04, 0x12, 0x87, 0x01,
+	0x08, 0x11, 0x2b, 0x04, 0x2d, 0x0a, 0x06, 0x03, 0x02, 0x02, 0x97, 0x00, 0x06, 0x02, 0x00, 0x08, 0x09, 0x89, 0x15, 0x07, 0x88, 0x01, 0x09, 0x15,
+	0x13, 0x04, 0x5a, 0x0a, 0x06, 0x06, 0x00, 0x02, 0x02, 0x91, 0x00, 0x81, 0x02, 0x06, 0x00, 0x03, 0x03, 0x00, 0x63, 0x84, 0x11, 0x8b, 0x01, 0x09,
+	0x49, 0x4d, 0x04, 0x2d, 0x05, 0x08, 0x06, 0x02, 0x00, 0x02, 0x8f, 0x00, 0x09, 0x02, 0x00, 0x02, 0x03, 0x00, 0x09, 0x05, 0x82, 0x61, 0x11, 0x8c,
+	0x01, 0x0a, 0x0e, 0x13, 0x04, 0x88, 0x1f, 0x0a, 0x06, 0x03, 0x00, 0x02, 0x02, 0x8b, 0x00, 0x81, 0x02, 0x08, 0x00, 0x03, 0x06, 0x0a, 0x17, 0x2e,
+	0x68, 0x11, 0x11, 0x8e, 0x01, 0x08, 0x15, 0x3a, 0x04, 0x28, 0x50, 0x05, 0x05, 0x06, 0x06, 0x82, 0x02, 0x07, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02,
+	0x02, 0x00, 0x82, 0x02, 0x81, 0x06, 0x05, 0x05, 0x09, 0x1e, 0x66, 0x04, 0x15, 0x91, 0x01, 0x0b, 0x11, 0x12, 0x04, 0x04, 0x45, 0x2e, 0x05, 0x09,
+	0x08, 0x00, 0x03, 0x0b, 0x85, 0x03, 0x0b, 0x0b, 0x03, 0x00, 0x08, 0x08, 0x05, 0x2e, 0x3f, 0x04, 0x04, 0x12, 0x11, 0x93, 0x01, 0x19, 0x0d, 0x30,
+	0x04, 0x20, 0x1a, 0x54, 0x17, 0x03, 0x0a, 0x26, 0x05, 0x05, 0x09, 0x09, 0x05, 0x05, 0x26, 0x0a, 0x06, 0x17, 0x54, 0x1a, 0x20, 0x04, 0x3a, 0x0d,
+	0x97, 0x01, 0x16, 0x0f, 0x60, 0x04, 0x04, 0x23, 0x39, 0x62, 0x1e, 0x36, 0x16, 0x33, 0x33, 0x16, 0x36, 0x1e, 0x62, 0x39, 0x23, 0x04, 0x04, 0x60,
+	0x0f, 0x07, 0x99, 0x01, 0x03, 0x07, 0x0e, 0x27, 0x37, 0x82, 0x04, 0x05, 0x20, 0x43, 0x44, 0x44, 0x43, 0x20, 0x82, 0x04, 0x03, 0x37, 0x27, 0x0e,
+	0x07, 0x9f, 0x01, 0x0b, 0x1b, 0x0f, 0x12, 0x19, 0x13, 0x5e, 0x31, 0x13, 0x19, 0x12, 0x0f, 0x1b, 0x91, 0x01,
+};
+
+const iconAsset yesPlease = { 48, 48, yesPleasePalette, nullptr, yesPleaseData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t noThanksPalette[] = {
+	0xffff, 0xfb4e, 0xfb6f, 0x0000, 0xfb2e, 0xfb4f, 0x7bcf, 0xffdf, 0xa514, 0x1841, 0xcaab, 0x0861,
+	0x1861, 0x2062, 0xc28b, 0xca8b, 0x0020, 0xd6ba, 0xcaac, 0x7bef, 0xeb0d, 0x73ae, 0x4a69, 0xf7be,
+	0xa209, 0xdedb, 0x2061, 0x0820, 0xa229, 0x2082, 0xdacc, 0xef7d, 0xc638, 0x0800, 0x5986, 0x6b4d,
+	0xb26a, 0xfb8f, 0xe73c, 0xd2cc, 0xd2ac, 0xad55, 0xb28b, 0x8208, 0x1862, 0x0841, 0x6b6d, 0x3924,
+	0x5aeb, 0x8c51, 0x738e, 0xa534, 0x8c71, 0x632c, 0xad34, 0x5166, 0x5186, 0x5945, 0xc618, 0x9492,
+	0x10a2, 0x1082, 0xb596, 0xc2cc, 0xe2ed, 0x4208, 0xb24a, 0xaa2a, 0x9a09, 0x0821, 0x69c7, 0x9209,
+	0x61c7, 0xcacc, 0x2945, 0xdefb, 0x7bae, 0x9208, 0x3124, 0xc26b, 0xba6a, 0xe71c, 0x5104, 0xaa8a,
+	0x1061, 0x3965, 0x83ef, 0x20a2, 0x1882, 0xfb90, 0x52aa, 0x5105, 0xb26b, 0x91c8, 0xeb0e, 0xc2ac,
+	0xf535, 0x91e8, 0x89c8, 0xff9e, 0x2965, 0xf79e, 0x6186, 0xdaed, 0x8a08, 0xeb2e, 0x4a49, 0x3186,
+	0x2124, 0x39c7, 0xba6b, 0x69e7, 0x528a, 0x71c8,
+};
+
+static const uint8_t noThanksData[] = {
+	0x90, 0x00, 0x0d, 0x1f, 0x11, 0x3e, 0x3b, 0x23, 0x16, 0x4a, 0x4a, 0x16, 0x23, 0x3b, 0x3e, 0x11, 0x1f, 0x9e, 0x00, 0x13, 0x07, 0x11, 0x29, 0x35,
+	0x03, 0x0b, 0x0b, 0x1b, 0x09, 0x1a, 0x1a, 0x09, 0x1b, 0x0b, 0x03, 0x0b, 0x35, 0x29, 0x11, 0x07, 0x99, 0x00, 0x17, 0x07, 0x3a, 0x06, 0x03, 0x03,
+	0x09, 0x5b, 0x5d, 0x42, 0x0e, 0x28, 0x1e, 0x1e, 0x28, 0x0e, 0x42, 0x5d, 0x5b, 0x09, 0x03, 0x03, 0x06, 0x3a, 0x07, 0x96, 0x00, 0x09, 0x11, 0x2e,
+	0x03, 0x45, 0x38, 0x2a, 0x14, 0x04, 0x02, 0x59, 0x85, 0x02, 0x09, 0x59, 0x02, 0x01, 0x14, 0x2a, 0x38, 0x45, 0x03, 0x2e, 0x11, 0x93, 0x00, 0x09,
+	0x17, 0x08, 0x03, 0x03, 0x22, 0x3f, 0x02, 0x05, 0x05, 0x01, 0x89, 0x04, 0x09, 0x01, 0x05, 0x05, 0x02, 0x3f, 0x66, 0x03, 0x03, 0x08, 0x65, 0x90,
+	0x00, 0x06, 0x51, 0x32, 0x03, 0x2f, 0x24, 0x05, 0x02, 0x91, 0x01, 0x81, 0x02, 0x04, 0x6e, 0x2f, 0x03, 0x32, 0x26, 0x8e, 0x00, 0x07, 0x19, 0x16,
+	0x03, 0x46, 0x14, 0x02, 0x01, 0x04, 0x91, 0x01, 0x07, 0x04, 0x01, 0x02, 0x5e, 0x6f, 0x03, 0x16, 0x19, 0x8c, 0x00, 0x05, 0x4b, 0x41, 0x03, 0x2b,
+	0x02, 0x05, 0x97, 0x01, 0x81, 0x05, 0x03, 0x2b, 0x03, 0x41, 0x4b, 0x8a, 0x00, 0x04, 0x51, 0x16, 0x03, 0x47, 0x02, 0x85, 0x01, 0x81, 0x04, 0x8b,
+	0x01, 0x81, 0x04, 0x85, 0x01, 0x04, 0x02, 0x47, 0x03, 0x6a, 0x26, 0x88, 0x00, 0x06, 0x17, 0x15, 0x03, 0x2b, 0x02, 0x01, 0x04, 0x84, 0x01, 0x81,
+	0x02, 0x8b, 0x01, 0x81, 0x02, 0x84, 0x01, 0x06, 0x04, 0x01, 0x02, 0x68, 0x03, 0x15, 0x17, 0x87, 0x00, 0x03, 0x08, 0x03, 0x48, 0x02, 0x86, 0x01,
+	0x03, 0x05, 0x0e, 0x27, 0x02, 0x89, 0x01, 0x03, 0x02, 0x27, 0x0e, 0x02, 0x86, 0x01, 0x03, 0x02, 0x48, 0x03, 0x08, 0x86, 0x00, 0x03, 0x11, 0x03,
+	0x4e, 0x14, 0x85, 0x01, 0x07, 0x04, 0x02, 0x1c, 0x21, 0x09, 0x0f, 0x02, 0x04, 0x85, 0x01, 0x07, 0x04, 0x02, 0x0a, 0x09, 0x21, 0x18, 0x02, 0x04,
+	0x85, 0x01, 0x03, 0x14, 0x2f, 0x3c, 0x11, 0x84, 0x00, 0x05, 0x07, 0x23, 0x54, 0x50, 0x02, 0x04, 0x84, 0x01, 0x01, 0x02, 0x18, 0x82, 0x03, 0x03,
+	0x0c, 0x0f, 0x02, 0x04, 0x83, 0x01, 0x03, 0x04, 0x02, 0x0a, 0x0c, 0x82, 0x03, 0x01, 0x44, 0x02, 0x84, 0x01, 0x05, 0x04, 0x02, 0x50, 0x03, 0x2e,
+	0x07, 0x83, 0x00, 0x03, 0x3a, 0x03, 0x22, 0x02, 0x84, 0x01, 0x18, 0x04, 0x02, 0x1c, 0x03, 0x10, 0x08, 0x56, 0x03, 0x1a, 0x0a, 0x02, 0x04, 0x01,
+	0x01, 0x04, 0x02, 0x12, 0x1a, 0x03, 0x13, 0x33, 0x1b, 0x03, 0x18, 0x02, 0x85, 0x01, 0x03, 0x02, 0x22, 0x0b, 0x20, 0x82, 0x00, 0x05, 0x17, 0x15,
+	0x3d, 0x5f, 0x02, 0x04, 0x83, 0x01, 0x19, 0x02, 0x1c, 0x21, 0x10, 0x08, 0x00, 0x00, 0x06, 0x03, 0x0c, 0x0e, 0x02, 0x04, 0x04, 0x02, 0x0a, 0x0c,
+	0x03, 0x15, 0x00, 0x00, 0x36, 0x10, 0x03, 0x44, 0x02, 0x83, 0x01, 0x0c, 0x04, 0x02, 0x49, 0x3d, 0x06, 0x07, 0x00, 0x00, 0x19, 0x0b, 0x38, 0x02,
+	0x04, 0x83, 0x01, 0x1b, 0x02, 0x1c, 0x03, 0x10, 0x08, 0x00, 0x07, 0x00, 0x00, 0x13, 0x03, 0x2c, 0x0f, 0x02, 0x02, 0x0a, 0x1d, 0x03, 0x06, 0x00,
+	0x00, 0x07, 0x00, 0x36, 0x10, 0x03, 0x18, 0x05, 0x83, 0x01, 0x0a, 0x04, 0x02, 0x37, 0x3c, 0x19, 0x00, 0x00, 0x33, 0x0b, 0x53, 0x05, 0x82, 0x01,
+	0x07, 0x04, 0x02, 0x4f, 0x03, 0x2d, 0x08, 0x00, 0x07, 0x83, 0x00, 0x07, 0x06, 0x03, 0x0d, 0x12, 0x12, 0x0d, 0x03, 0x06, 0x83, 0x00, 0x07, 0x07,
+	0x00, 0x08, 0x2d, 0x03, 0x0e, 0x02, 0x04, 0x82, 0x01, 0x09, 0x05, 0x2a, 0x0b, 0x29, 0x00, 0x1f, 0x35, 0x58, 0x14, 0x05, 0x82, 0x01, 0x05, 0x04,
+	0x05, 0x28, 0x0d, 0x10, 0x13, 0x86, 0x00, 0x05, 0x06, 0x03, 0x2c, 0x2c, 0x03, 0x06, 0x86, 0x00, 0x05, 0x13, 0x10, 0x0d, 0x27, 0x05, 0x04, 0x82,
+	0x01, 0x07, 0x05, 0x69, 0x57, 0x30, 0x00, 0x11, 0x0b, 0x52, 0x85, 0x01, 0x05, 0x04, 0x02, 0x0a, 0x09, 0x03, 0x4c, 0x86, 0x00, 0x03, 0x13, 0x03,
+	0x03, 0x06, 0x86, 0x00, 0x05, 0x06, 0x03, 0x09, 0x0f, 0x02, 0x04, 0x85, 0x01, 0x08, 0x39, 0x03, 0x1f, 0x3e, 0x03, 0x62, 0x02, 0x04, 0x04, 0x83,
+	0x01, 0x05, 0x04, 0x02, 0x0f, 0x0c, 0x03, 0x06, 0x86, 0x00, 0x81, 0x31, 0x86, 0x00, 0x05, 0x06, 0x03, 0x0c, 0x0f, 0x02, 0x04, 0x83, 0x01, 0x81,
+	0x04, 0x08, 0x02, 0x4d, 0x0b, 0x20, 0x3b, 0x0b, 0x43, 0x25, 0x04, 0x85, 0x01, 0x05, 0x04, 0x02, 0x12, 0x1d, 0x03, 0x06, 0x8d, 0x00, 0x05, 0x13,
+	0x03, 0x0d, 0x0a, 0x02, 0x04, 0x85, 0x01, 0x09, 0x04, 0x25, 0x24, 0x0b, 0x08, 0x23, 0x21, 0x0e, 0x02, 0x04, 0x86, 0x01, 0x05, 0x04, 0x02, 0x0a,
+	0x0c, 0x03, 0x15, 0x84, 0x00, 0x81, 0x07, 0x84, 0x00, 0x05, 0x06, 0x03, 0x0c, 0x0e, 0x02, 0x04, 0x86, 0x01, 0x09, 0x04, 0x02, 0x0a, 0x1b, 0x06,
+	0x16, 0x09, 0x28, 0x02, 0x04, 0x87, 0x01, 0x05, 0x04, 0x02, 0x12, 0x0d, 0x03, 0x15, 0x89, 0x00, 0x05, 0x06, 0x03, 0x0c, 0x0f, 0x02, 0x04, 0x87,
+	0x01, 0x09, 0x04, 0x05, 0x1e, 0x09, 0x70, 0x64, 0x1a, 0x1e, 0x05, 0x04, 0x88, 0x01, 0x07, 0x04, 0x02, 0x12, 0x1d, 0x03, 0x34, 0x00, 0x07, 0x83,
+	0x00, 0x07, 0x07, 0x00, 0x34, 0x03, 0x1d, 0x12, 0x02, 0x04, 0x88, 0x01, 0x09, 0x04, 0x05, 0x67, 0x0d, 0x6d, 0x64, 0x1a, 0x1e, 0x05, 0x04, 0x88,
+	0x01, 0x07, 0x04, 0x02, 0x12, 0x1d, 0x03, 0x34, 0x00, 0x07, 0x83, 0x00, 0x07, 0x07, 0x00, 0x34, 0x03, 0x1d, 0x12, 0x02, 0x04, 0x88, 0x01, 0x09,
+	0x04, 0x05, 0x40, 0x0d, 0x6b, 0x16, 0x09, 0x28, 0x02, 0x04, 0x87, 0x01, 0x05, 0x04, 0x02, 0x12, 0x0d, 0x03, 0x15, 0x89, 0x00, 0x05, 0x06, 0x03,
+	0x0c, 0x0f, 0x02, 0x04, 0x87, 0x01, 0x09, 0x04, 0x05, 0x1e, 0x09, 0x5a, 0x23, 0x21, 0x0e, 0x02, 0x04, 0x86, 0x01, 0x05, 0x04, 0x02, 0x0a, 0x0c,
+	0x03, 0x15, 0x84, 0x00, 0x81, 0x07, 0x84, 0x00, 0x05, 0x06, 0x03, 0x0c, 0x0e, 0x02, 0x04, 0x86, 0x01, 0x09, 0x04, 0x02, 0x0a, 0x1b, 0x06, 0x3b,
+	0x0b, 0x43, 0x25, 0x04, 0x85, 0x01, 0x05, 0x04, 0x02, 0x12, 0x1d, 0x03, 0x06, 0x8d, 0x00, 0x05, 0x13, 0x03, 0x0d, 0x0a, 0x02, 0x04, 0x85, 0x01,
+	0x0a, 0x04, 0x25, 0x42, 0x0b, 0x08, 0x3e, 0x03, 0x62, 0x02, 0x04, 0x04, 0x83, 0x01, 0x05, 0x04, 0x02, 0x0f, 0x0c, 0x03, 0x06, 0x86, 0x00, 0x81,
+	0x31, 0x86, 0x00, 0x05, 0x06, 0x03, 0x1a, 0x0f, 0x02, 0x04, 0x83, 0x01, 0x81, 0x04, 0x06, 0x02, 0x4d, 0x0b, 0x20, 0x11, 0x0b, 0x52, 0x85, 0x01,
+	0x05, 0x04, 0x02, 0x0a, 0x09, 0x03, 0x4c, 0x86, 0x00, 0x03, 0x13, 0x03, 0x03, 0x06, 0x86, 0x00, 0x05, 0x06, 0x03, 0x09, 0x0f, 0x02, 0x04, 0x85,
+	0x01, 0x07, 0x39, 0x03, 0x1f, 0x1f, 0x35, 0x58, 0x14, 0x05, 0x82, 0x01, 0x05, 0x04, 0x05, 0x28, 0x0d, 0x10, 0x13, 0x86, 0x00, 0x05, 0x06, 0x03,
+	0x2c, 0x2c, 0x03, 0x06, 0x86, 0x00, 0x05, 0x13, 0x10, 0x0d, 0x27, 0x05, 0x04, 0x82, 0x01, 0x09, 0x05, 0x14, 0x57, 0x30, 0x00, 0x00, 0x33, 0x0b,
+	0x53, 0x05, 0x82, 0x01, 0x07, 0x04, 0x02, 0x4f, 0x03, 0x2d, 0x08, 0x00, 0x07, 0x83, 0x00, 0x07, 0x06, 0x03, 0x0d, 0x12, 0x12, 0x0d, 0x03, 0x06,
+	0x83, 0x00, 0x07, 0x07, 0x00, 0x08, 0x2d, 0x03, 0x0e, 0x02, 0x04, 0x82, 0x01, 0x0a, 0x05, 0x2a, 0x0b, 0x29, 0x00, 0x00, 0x19, 0x0b, 0x38, 0x02,
+	0x04, 0x83, 0x01, 0x1b, 0x02, 0x1c, 0x03, 0x10, 0x08, 0x00, 0x07, 0x00, 0x00, 0x06, 0x03, 0x0d, 0x0f, 0x02, 0x02, 0x0a, 0x1d, 0x03, 0x06, 0x00,
+	0x00, 0x07, 0x00, 0x36, 0x10, 0x03, 0x18, 0x05, 0x83, 0x01, 0x0c, 0x04, 0x02, 0x37, 0x3c, 0x19, 0x00, 0x00, 0x17, 0x15, 0x3d, 0x5f, 0x02, 0x04,
+	0x83, 0x01, 0x19, 0x02, 0x1c, 0x21, 0x10, 0x08, 0x00, 0x00, 0x06, 0x03, 0x0c, 0x0e, 0x02, 0x04, 0x04, 0x02, 0x0a, 0x0c, 0x03, 0x15, 0x00, 0x00,
+	0x36, 0x10, 0x03, 0x18, 0x02, 0x83, 0x01, 0x05, 0x04, 0x02, 0x49, 0x3d, 0x06, 0x07, 0x82, 0x00, 0x03, 0x20, 0x03, 0x22, 0x02, 0x84, 0x01, 0x18,
+	0x04, 0x02, 0x1c, 0x03, 0x10, 0x08, 0x56, 0x03, 0x1a, 0x0a, 0x02, 0x04, 0x01, 0x01, 0x04, 0x02, 0x12, 0x1a, 0x03, 0x13, 0x33, 0x1b, 0x03, 0x18,
+	0x02, 0x85, 0x01, 0x03, 0x02, 0x22, 0x0b, 0x20, 0x83, 0x00, 0x05, 0x07, 0x23, 0x54, 0x24, 0x02, 0x04, 0x84, 0x01, 0x01, 0x02, 0x18, 0x82, 0x03,
+	0x03, 0x0c, 0x0f, 0x02, 0x04, 0x83, 0x01, 0x03, 0x04, 0x02, 0x0a, 0x0c, 0x82, 0x03, 0x01, 0x44, 0x02, 0x84, 0x01, 0x05, 0x04, 0x02, 0x24, 0x03,
+	0x2e, 0x07, 0x84, 0x00, 0x04, 0x11, 0x03, 0x4e, 0x14, 0x05, 0x84, 0x01, 0x07, 0x04, 0x02, 0x1c, 0x21, 0x09, 0x0f, 0x02, 0x04, 0x85, 0x01, 0x07,
+	0x04, 0x02, 0x0a, 0x09, 0x21, 0x18, 0x02, 0x04, 0x82, 0x01, 0x06, 0x05, 0x04, 0x05, 0x14, 0x55, 0x3c, 0x11, 0x86, 0x00, 0x03, 0x08, 0x03, 0x48,
+	0x02, 0x86, 0x01, 0x03, 0x05, 0x0e, 0x27, 0x02, 0x89, 0x01, 0x03, 0x02, 0x27, 0x0e, 0x02, 0x86, 0x01, 0x03, 0x05, 0x0e, 0x03, 0x08, 0x87, 0x00,
+	0x06, 0x17, 0x15, 0x03, 0x2b, 0x02, 0x01, 0x04, 0x84, 0x01, 0x81, 0x02, 0x8b, 0x01, 0x81, 0x02, 0x85, 0x01, 0x05, 0x05, 0x02, 0x02, 0x60, 0x26,
+	0x07, 0x88, 0x00, 0x04, 0x26, 0x16, 0x03, 0x47, 0x02, 0x85, 0x01, 0x81, 0x04, 0x8b, 0x01, 0x81, 0x04, 0x83, 0x01, 0x81, 0x04, 0x03, 0x02, 0x43,
+	0x71, 0x63, 0x8b, 0x00, 0x05, 0x4b, 0x41, 0x03, 0x2b, 0x02, 0x05, 0x96, 0x01, 0x06, 0x04, 0x05, 0x05, 0x02, 0x46, 0x5a, 0x17, 0x8c, 0x00, 0x07,
+	0x19, 0x16, 0x03, 0x46, 0x14, 0x02, 0x01, 0x04, 0x91, 0x01, 0x07, 0x04, 0x01, 0x02, 0x14, 0x49, 0x60, 0x63, 0x17, 0x8e, 0x00, 0x06, 0x26, 0x32,
+	0x03, 0x2f, 0x5c, 0x02, 0x02, 0x91, 0x01, 0x81, 0x02, 0x03, 0x5c, 0x55, 0x03, 0x26, 0x91, 0x00, 0x09, 0x17, 0x08, 0x03, 0x03, 0x22, 0x3f, 0x02,
+	0x05, 0x05, 0x01, 0x83, 0x04, 0x81, 0x01, 0x83, 0x04, 0x09, 0x01, 0x05, 0x05, 0x02, 0x3f, 0x22, 0x03, 0x03, 0x08, 0x17, 0x93, 0x00, 0x19, 0x11,
+	0x2e, 0x03, 0x2d, 0x37, 0x2a, 0x5e, 0x04, 0x02, 0x25, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x25, 0x02, 0x01, 0x14, 0x2a, 0x37, 0x45, 0x03, 0x32,
+	0x11, 0x97, 0x00, 0x16, 0x20, 0x13, 0x03, 0x03, 0x09, 0x39, 0x61, 0x24, 0x0a, 0x1e, 0x40, 0x40, 0x1e, 0x0a, 0x24, 0x61, 0x39, 0x09, 0x03, 0x03,
+	0x13, 0x3a, 0x07, 0x99, 0x00, 0x03, 0x07, 0x19, 0x29, 0x30, 0x82, 0x03, 0x05, 0x1b, 0x09, 0x0d, 0x0d, 0x09, 0x1b, 0x82, 0x03, 0x03, 0x30, 0x29,
+	0x19, 0x07, 0x9f, 0x00, 0x0b, 0x1f, 0x20, 0x08, 0x06, 0x16, 0x6c, 0x4a, 0x16, 0x06, 0x08, 0x20, 0x1f, 0x91, 0x00,
+};
+
+const iconAsset noThanks = { 48, 48, noThanksPalette, nullptr, noThanksData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t policeCarPalette[] = {
+	0xffff, 0x0000, 0xf79e, 0xf7be, 0x7c72, 0x31a6, 0xffdf, 0x8c51, 0xe73c, 0x9cd3, 0x4a49, 0x0861,
+	0x0020, 0x42b7, 0x3a76, 0x0453, 0xef7d, 0x8410, 0x5acb, 0x10a2, 0x8430, 0x2124, 0x94b2, 0x3a96,
+	0x061b, 0x8c71, 0xd69a, 0x4297, 0x7c52, 0xd6ba, 0xef5d, 0x39c7, 0x0841, 0x8493, 0x063b, 0x6b4d,
+	0x52cb, 0xce79, 0xbdf7, 0x18e3, 0x3233, 0x52aa, 0x9492, 0xdedb, 0x4a8a, 0xb5b6, 0x3a54, 0x4a69,
+	0x214c, 0xe71c, 0xbdd7, 0x29ae, 0x7410, 0x216c, 0x267c, 0xc638, 0x1060, 0x9cf3, 0x8472, 0x42b8,
+	0x8492, 0xb596, 0x165c, 0x05b9, 0x0882, 0x4208, 0x73ae, 0xce59, 0x6bcf, 0x5aeb, 0x4228, 0x0862,
+	0x0474, 0x1909, 0xa534, 0x4295, 0x10c7, 0x636e, 0xa514, 0x84b3, 0x7bcf, 0x1908, 0x7bef, 0x2104,
+	0xad55, 0x31c7, 0x42d8, 0x0041, 0xdefb, 0x42b6, 0x528a, 0x29af, 0x2945, 0x2145, 0x0187, 0x31f0,
+	0x0cb4, 0x0884, 0x4aaa, 0x8cd4, 0x29f1, 0x063c, 0x0104, 0x1d37, 0x29b0, 0x2249, 0x2494, 0x00e4,
+	0x0c53, 0x0433, 0x0022, 0x3186, 0x10a3, 0x4249, 0x0082, 0x3a97, 0x3a55, 0x2986, 0x2473, 0x0001,
+	0x7c31, 0x3061, 0x10c6, 0x39e7, 0x18e8, 0x4296, 0x261a, 0x7c51, 0xffbe, 0xe77d, 0x10e8, 0x5220,
+	0x190a, 0xd5c0, 0x5b2d, 0x1082, 0x0599, 0x194b, 0xe75d, 0xac81, 0x49e0, 0x3187, 0x02cf, 0x15da,
+	0x0840, 0x214b, 0x0494, 0x218d, 0x9491, 0x3234, 0x39e8, 0x73f0, 0x0e5c, 0x2125, 0x03b5, 0x026d,
+	0x01a9, 0x1907, 0xcd60, 0x08e4, 0x10a5, 0x0820, 0x22ec, 0x3a08, 0x0885, 0x9471, 0x31e8, 0x159f,
+	0xfee0, 0x52ab, 0x1c74, 0x1925, 0x738e, 0x5b4d, 0x10c3, 0x7ebb, 0x5269, 0x0865, 0x18e5, 0x22ab,
+	0x3232, 0x216e, 0x4af9, 0x212c, 0x18e9, 0x1e3b, 0x40a1, 0x0cf5, 0x0881, 0x96dc, 0x0186, 0x18c3,
+	0x7300, 0xbd20, 0xfa68, 0x20e0, 0x0843, 0x31f1, 0x62a1, 0x10e7, 0xbf3d, 0x2e7c, 0xa480, 0x0dbf,
+	0x126a, 0xd5c1, 0x218e, 0xff62, 0xb595, 0xad75, 0x0166, 0x13b4, 0x630c, 0x18c4, 0x163f, 0x3211,
+	0xfea0, 0x7186, 0x0cd5, 0x0473, 0x84d3, 0x3a33, 0x638f, 0x03f1, 0xc73d, 0x56bc, 0x4229, 0x2966,
+	0x0e3b, 0x0e7d, 0x6baf, 0xffde, 0xc618, 0x52ec, 0x0394, 0x0125, 0x9c20, 0x86dc, 0x4294, 0x0d37,
+	0x0905, 0x7ebc, 0x0127, 0x1c94, 0x4af8, 0x10c8, 0xa6fc, 0x29d1, 0x638e, 0x00c3, 0x1904, 0x0105,
+	0x76bc, 0x0e1b, 0x4274, 0xb1a5, 0x7303, 0xfa88, 0x228a, 0x0412, 0x5e7b, 0xff80, 0x0863, 0x132d,
+	0x1e1a, 0x1186, 0x0bd5, 0x2100, 0x0b53, 0x6b6d, 0x9c40, 0xa71c, 0x18a2, 0xa9a5, 0x18e4, 0x634d,
+	0x28c3, 0x8185, 0x3a32, 0x00a3, 0x3212, 0x5240, 0x2965, 0x1166, 0x29d3,
+};
+
+static const uint8_t policeCarData[] = {
+	0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00, 0x07, 0xa8, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x31, 0x82, 0x00,
+	0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x82, 0x00, 0x00, 0x81, 0x00, 0x1e, 0xa3, 0x00, 0x00, 0x0b, 0x00, 0x2b, 0x00, 0x01, 0x00, 0xe8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x5a, 0x00, 0x39, 0xa3, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x19,
+	0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x31, 0xa4, 0x00, 0x00, 0x01,
+	0x00, 0x03, 0x00, 0x25, 0x85, 0x00, 0x00, 0x81, 0x00, 0x2b, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x02, 0x85, 0x00, 0x1a, 0x00, 0x00, 0x08, 0xa6, 0x00,
+	0x00, 0x03, 0x00, 0x26, 0x00, 0x15, 0x00, 0x0b, 0x00, 0x0b, 0x82, 0x00, 0x01, 0x81, 0x00, 0x0b, 0x01, 0x00, 0x11, 0x00, 0x02, 0xa3, 0x00, 0x00,
+	0x0b, 0x00, 0x08, 0x00, 0x27, 0x00, 0x9c, 0x00, 0xd3, 0x00, 0x9a, 0x00, 0x8e, 0x00, 0x57, 0x00, 0x79, 0x00, 0xff, 0x01, 0x15, 0x00, 0xa1, 0x00,
+	0x3d, 0xa3, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x0b, 0x01, 0x0a, 0x00, 0xd6, 0x00, 0xcb, 0x00, 0xa7, 0x00, 0xf0, 0x00, 0xba, 0x01, 0x01, 0x00,
+	0xc2, 0x01, 0x14, 0x00, 0x16, 0x9f, 0x00, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x2b, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x53, 0x00, 0xf2, 0x01,
+	0x0c, 0x00, 0xea, 0x00, 0x9b, 0x00, 0x0c, 0x00, 0x79, 0x01, 0x11, 0x00, 0xd9, 0x00, 0x0c, 0x00, 0x2d, 0x9e, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00,
+	0x41, 0x8a, 0x00, 0x01, 0x04, 0x00, 0x0b, 0x00, 0x27, 0x00, 0x13, 0x00, 0x11, 0x00, 0x10, 0x9c, 0x00, 0x00, 0x13, 0x00, 0x25, 0x00, 0x01, 0x01,
+	0x09, 0x00, 0x76, 0x00, 0x6a, 0x00, 0x76, 0x00, 0xaa, 0x00, 0x6c, 0x00, 0xeb, 0x00, 0x9f, 0x00, 0x48, 0x00, 0x92, 0x00, 0x48, 0x00, 0xdb, 0x00,
+	0x48, 0x00, 0xdf, 0x00, 0xcc, 0x00, 0x57, 0x00, 0x23, 0x00, 0x02, 0x9a, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x1f, 0x01, 0x1b, 0x00, 0x67, 0x00,
+	0x65, 0x00, 0x3e, 0x00, 0xc9, 0x00, 0x3e, 0x00, 0x18, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x22, 0x00, 0x65, 0x00, 0x18, 0x00, 0x22, 0x00, 0x36, 0x00,
+	0x36, 0x00, 0xef, 0x00, 0xa2, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x06, 0x98, 0x00, 0x00, 0x17, 0x00, 0x08, 0x00, 0x29, 0x00, 0xf9, 0x00, 0x67, 0x00,
+	0xe1, 0x00, 0xbd, 0x00, 0xe0, 0x00, 0x80, 0x00, 0xed, 0x00, 0x88, 0x00, 0xbe, 0x00, 0x6b, 0x00, 0x3f, 0x00, 0x7e, 0x00, 0xf1, 0x01, 0x0f, 0x00,
+	0x81, 0x00, 0x02, 0x01, 0x08, 0x00, 0xbb, 0x00, 0xb3, 0x00, 0x01, 0x00, 0x19, 0x00, 0x06, 0x96, 0x00, 0x00, 0x18, 0x00, 0x10, 0x00, 0x23, 0x00,
+	0x72, 0x00, 0xf3, 0x00, 0xb9, 0x00, 0x8a, 0x00, 0x80, 0x00, 0xc8, 0x00, 0xaf, 0x00, 0x7e, 0x00, 0x3f, 0x00, 0xd2, 0x00, 0x6b, 0x00, 0x88, 0x00,
+	0xfc, 0x00, 0xe7, 0x00, 0x81, 0x00, 0xf6, 0x01, 0x04, 0x00, 0x8f, 0x00, 0x3f, 0x00, 0x60, 0x00, 0x69, 0x00, 0x01, 0x00, 0x4a, 0x95, 0x00, 0x00,
+	0x11, 0x00, 0x06, 0x00, 0x11, 0x00, 0x72, 0x00, 0x6a, 0x00, 0xe5, 0x00, 0xfd, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x22, 0x00, 0x18, 0x00, 0x22, 0x00,
+	0x18, 0x00, 0x5e, 0x00, 0x66, 0x00, 0x18, 0x00, 0x98, 0x00, 0x36, 0x00, 0x22, 0x82, 0x00, 0x18, 0x05, 0x00, 0xe4, 0x00, 0x18, 0x00, 0xda, 0x00,
+	0x69, 0x00, 0x0c, 0x00, 0x2d, 0x92, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x08, 0x00, 0x2a, 0x00, 0x01, 0x01, 0x02, 0x00, 0x60, 0x00, 0x6d, 0x85,
+	0x00, 0x0f, 0x02, 0x00, 0x6d, 0x00, 0xfb, 0x01, 0x17, 0x87, 0x00, 0x0f, 0x07, 0x00, 0x6c, 0x01, 0x03, 0x01, 0x07, 0x00, 0xab, 0x00, 0x01, 0x00,
+	0x26, 0x00, 0x10, 0x00, 0x06, 0x8b, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x43, 0x00, 0x09, 0x00, 0x11, 0x01, 0x0d, 0x00, 0x2f, 0x00, 0x01, 0x00,
+	0x13, 0x00, 0x57, 0x00, 0x01, 0x00, 0x40, 0x83, 0x00, 0x0c, 0x01, 0x00, 0x01, 0x00, 0x0c, 0x84, 0x00, 0x01, 0x84, 0x00, 0x0c, 0x81, 0x00, 0x01,
+	0x0d, 0x00, 0x40, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0xac, 0x00, 0x14, 0x00, 0x39, 0x00, 0x32, 0x00, 0x25, 0x00,
+	0x58, 0x00, 0x10, 0x00, 0x06, 0x84, 0x00, 0x00, 0x08, 0x00, 0x54, 0x00, 0x01, 0x00, 0x6e, 0x00, 0xa0, 0x00, 0xc7, 0x00, 0x51, 0x00, 0x27, 0x00,
+	0x2f, 0x00, 0x94, 0x88, 0x00, 0x07, 0x81, 0x00, 0x19, 0x01, 0x00, 0x07, 0x00, 0xa5, 0x88, 0x00, 0x07, 0x18, 0x00, 0x2a, 0x00, 0x5a, 0x00, 0x0b,
+	0x00, 0x51, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x01, 0x00, 0x27, 0x00, 0x5c, 0x00, 0x0a, 0x00, 0x42, 0x00, 0x3d, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x1e, 0x00, 0x0a, 0x00, 0x51, 0x00, 0x4b, 0x00, 0x0d, 0x00, 0xf4, 0x00, 0x4b, 0x00, 0x47, 0x00, 0x29, 0x8c, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x89, 0x00, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x0b, 0x00, 0xfe, 0x00, 0xb6, 0x00, 0x59, 0x00, 0xee, 0x01, 0x16, 0x00, 0x5f, 0x00, 0x4c,
+	0x00, 0x90, 0x00, 0x83, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1f, 0x00, 0x30, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x0e,
+	0x00, 0x17, 0x00, 0x82, 0x00, 0x0c, 0x00, 0x58, 0x00, 0x03, 0x87, 0x00, 0x02, 0x81, 0x00, 0x06, 0x04, 0x00, 0xd4, 0x01, 0x12, 0x00, 0x14, 0x00,
+	0x00, 0x00, 0x06, 0x84, 0x00, 0x02, 0x1c, 0x00, 0x10, 0x00, 0x06, 0x00, 0x07, 0x00, 0x01, 0x00, 0x28, 0x00, 0x1b, 0x00, 0x0e, 0x00, 0x7d, 0x00,
+	0x1b, 0x00, 0x56, 0x00, 0x30, 0x00, 0x38, 0x00, 0xcd, 0x00, 0xcf, 0x01, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x7b, 0x00, 0x89, 0x00,
+	0x0d, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x3b, 0x00, 0x33, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x02, 0x86, 0x00, 0x03, 0x07, 0x00, 0x1d, 0x00,
+	0x16, 0x00, 0x01, 0x00, 0x01, 0x00, 0x20, 0x00, 0xd0, 0x00, 0x58, 0x00, 0x06, 0x83, 0x00, 0x03, 0x1d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00,
+	0x01, 0x00, 0xdd, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x73, 0x00, 0x33, 0x00, 0x01, 0x00, 0xc6, 0x00, 0x8b, 0x00, 0x83, 0x00,
+	0x0b, 0x00, 0x06, 0x00, 0x08, 0x00, 0x1f, 0x00, 0x89, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x73, 0x00, 0x28, 0x00, 0x77, 0x00, 0xb0, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x02, 0x82, 0x00, 0x03, 0x7f, 0x00, 0x02, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x13, 0x00, 0x01, 0x00, 0xc3, 0x00, 0xec, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x15, 0x00, 0x26, 0x00, 0x06, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+	0x28, 0x00, 0x1b, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x7c, 0x00, 0x01, 0x00, 0x13, 0x00, 0x0b, 0x00, 0x0b, 0x00,
+	0x06, 0x00, 0x1e, 0x00, 0x7b, 0x00, 0x30, 0x00, 0x56, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x0d, 0x00, 0xb1, 0x01, 0x10, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x06, 0x00, 0x5a, 0x00, 0x01, 0x00, 0xc0, 0x00, 0x85, 0x00, 0xa8, 0x00,
+	0x9e, 0x01, 0x19, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00,
+	0x2e, 0x00, 0x56, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x68, 0x00, 0xf5, 0x00, 0x01, 0x00,
+	0x06, 0x00, 0x08, 0x00, 0x1f, 0x00, 0xb8, 0x00, 0xb4, 0x00, 0x64, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0xce, 0x00, 0x0c, 0x00, 0x14, 0x00,
+	0x37, 0x00, 0x37, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x26, 0x00, 0xbf, 0x01, 0x0b, 0x00, 0xd8, 0x01, 0x05, 0x00,
+	0x85, 0x00, 0x38, 0x00, 0x5c, 0x00, 0x1d, 0x00, 0x06, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+	0x5f, 0x01, 0x18, 0x00, 0xd7, 0x00, 0x2e, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x2e, 0x00, 0xf7, 0x00, 0x68, 0x00, 0x7c, 0x00, 0x01, 0x00,
+	0x00, 0x08, 0x00, 0x4e, 0x00, 0x13, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x93, 0x00, 0x1b, 0x00, 0x84, 0x82, 0x00, 0x01, 0x0f,
+	0x00, 0x20, 0x00, 0x0a, 0x00, 0x32, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x01, 0x00, 0xc1, 0x00, 0xca, 0x01, 0x0e,
+	0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x82, 0x00, 0x03, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x83, 0x00, 0x01, 0x7e, 0x01, 0x06,
+	0x00, 0x30, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x49, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x01, 0x00, 0x2d, 0x00, 0x01, 0x00, 0x61, 0x00, 0x5b,
+	0x00, 0x33, 0x00, 0x33, 0x00, 0x5b, 0x00, 0x95, 0x00, 0x82, 0x00, 0x01, 0x00, 0xfa, 0x00, 0x2c, 0x00, 0x62, 0x00, 0x99, 0x00, 0x01, 0x00, 0x20,
+	0x00, 0x4a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x12, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x52, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x0b, 0x00, 0x20, 0x00, 0xa6, 0x00, 0x24, 0x00, 0x96, 0x00, 0xbc,
+	0x00, 0x01, 0x00, 0x4c, 0x00, 0x0e, 0x00, 0x28, 0x00, 0x5b, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x9d, 0x00, 0x3b,
+	0x00, 0x59, 0x00, 0x0d, 0x00, 0x3b, 0x00, 0x35, 0x00, 0x01, 0x00, 0xa3, 0x00, 0x04, 0x00, 0x21, 0x00, 0x21, 0x00, 0x34, 0x00, 0x2c, 0x00, 0x0c,
+	0x00, 0x13, 0x00, 0x1d, 0x00, 0x02, 0x00, 0x06, 0x00, 0x54, 0x01, 0x1a, 0x00, 0xe2, 0x00, 0x11, 0x00, 0x8d, 0x00, 0x05, 0x00, 0x37, 0x00, 0x06,
+	0x00, 0x10, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x13, 0x00, 0x20, 0x00, 0x44, 0x00, 0x21, 0x00, 0x3c, 0x00, 0x04, 0x00, 0xad,
+	0x00, 0x5d, 0x00, 0x01, 0x00, 0x91, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x74, 0x01, 0x1c, 0x00, 0x7a, 0x00, 0x0b, 0x00, 0x46, 0x00, 0xb2, 0x00, 0x4b,
+	0x00, 0x0d, 0x00, 0x0d, 0x00, 0x59, 0x00, 0x47, 0x00, 0x15, 0x00, 0x21, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x04, 0x00, 0xf8, 0x00, 0x71,
+	0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x34, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x4f, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x04, 0x00, 0x34, 0x00, 0xe9, 0x00, 0x13, 0x00, 0x47,
+	0x00, 0x7d, 0x00, 0x0d, 0x00, 0x74, 0x00, 0xc5, 0x00, 0xd5, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x01, 0x00, 0x7a, 0x00, 0x35, 0x00, 0x35, 0x00, 0x49,
+	0x00, 0x01, 0x00, 0x2c, 0x00, 0xdc, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x24, 0x00, 0x20, 0x00, 0x5c, 0x00, 0x14,
+	0x00, 0x11, 0x00, 0x11, 0x00, 0x14, 0x00, 0x11, 0x00, 0x11, 0x00, 0x14, 0x00, 0x14, 0x00, 0x11, 0x00, 0x14, 0x00, 0x14, 0x00, 0x11, 0x00, 0x11,
+	0x00, 0x14, 0x00, 0x15, 0x00, 0x40, 0x00, 0x3c, 0x83, 0x00, 0x04, 0x1a, 0x00, 0x7f, 0x00, 0x86, 0x00, 0x75, 0x00, 0x01, 0x00, 0x49, 0x00, 0x35,
+	0x00, 0x84, 0x00, 0xa4, 0x00, 0x01, 0x00, 0x37, 0x00, 0x00, 0x00, 0x32, 0x00, 0x23, 0x00, 0x0a, 0x00, 0x2f, 0x00, 0x1f, 0x00, 0x0b, 0x00, 0x24,
+	0x00, 0x4f, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x04, 0x00, 0x21, 0x00, 0x44, 0x00, 0x24, 0x00, 0x27, 0x00, 0x15, 0x8d, 0x00, 0x0a, 0x81, 0x00, 0x15,
+	0x00, 0x00, 0x3a, 0x83, 0x00, 0x04, 0x08, 0x00, 0x7f, 0x01, 0x13, 0x00, 0x55, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x0a, 0x00, 0x23, 0x00,
+	0x32, 0x82, 0x00, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x08, 0x00, 0x1e, 0x00, 0x1a, 0x00, 0x05, 0x00, 0x71, 0x00, 0x63, 0x00, 0x1c, 0x00, 0x04, 0x00,
+	0x04, 0x00, 0x3a, 0x00, 0xe6, 0x00, 0x24, 0x00, 0x13, 0x00, 0x2a, 0x8d, 0x00, 0x08, 0x01, 0x00, 0x2a, 0x00, 0x70, 0x84, 0x00, 0x04, 0x07, 0x00,
+	0x78, 0x00, 0x86, 0x00, 0x75, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x08, 0x00, 0x02, 0x87, 0x00, 0x00, 0x0a, 0x00, 0x42, 0x00, 0x70, 0x00,
+	0x34, 0x00, 0x4f, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x01, 0x00, 0x25, 0x8d, 0x00, 0x00, 0x0a, 0x00, 0x25, 0x00,
+	0x01, 0x00, 0x62, 0x00, 0x63, 0x00, 0x3a, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x97, 0x00, 0x2c, 0x00, 0x0b, 0x00, 0x42, 0x8b, 0x00, 0x00, 0x09, 0x00,
+	0x31, 0x00, 0x0a, 0x00, 0xe3, 0x00, 0xde, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x55, 0x00, 0x87, 0x00, 0x16, 0x8f, 0x00, 0x00, 0x09, 0x00,
+	0x16, 0x00, 0x87, 0x00, 0xa9, 0x00, 0x78, 0x00, 0x21, 0x00, 0x34, 0x00, 0x2c, 0x00, 0x15, 0x00, 0x0a, 0x00, 0x31, 0x85, 0x00, 0x00, 0x00, 0x00,
+	0xd1, 0x82, 0x00, 0x09, 0x0d, 0x00, 0x16, 0x00, 0x09, 0x00, 0x09, 0x00, 0x41, 0x00, 0x01, 0x00, 0x01, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x52, 0x00, 0x39, 0x00, 0x16, 0x8b, 0x00, 0x09, 0x12, 0x00, 0x16, 0x00, 0x39, 0x00, 0x50, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x13, 0x00, 0x5d, 0x00, 0xae, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x00, 0x09, 0x00, 0x09, 0x00, 0x16, 0x00, 0x09, 0x00, 0x09, 0x00, 0x16, 0x00,
+	0x2d, 0x00, 0x52, 0x85, 0x00, 0x05, 0x01, 0x00, 0x29, 0x00, 0x45, 0x85, 0x00, 0x12, 0x01, 0x00, 0x46, 0x00, 0x6f, 0x8d, 0x00, 0x05, 0x03, 0x00,
+	0x6f, 0x00, 0x46, 0x00, 0x12, 0x00, 0x45, 0x84, 0x00, 0x12, 0x00, 0x00, 0x29, 0x83, 0x00, 0x05, 0x02, 0x00, 0x1f, 0x00, 0x05, 0x00, 0x07, 0xff,
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x9f, 0x00, 0x00,
+};
+
+const iconAsset policeCar = { 48, 48, policeCarPalette, nullptr, policeCarData, true, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t ambulancePalette[] = {
+	0xffff, 0x0000, 0xf7be, 0xffdf, 0xf79e, 0x9cf3, 0x9cd3, 0x630c, 0x0800, 0x2945, 0x0861, 0xd9e6,
+	0x9492, 0xef7d, 0xdedb, 0xa164, 0x2124, 0xef5d, 0x634d, 0xc618, 0xd69a, 0xa514, 0x0020, 0xad75,
+	0xa534, 0x10a2, 0x6b4d, 0x7c72, 0x8c71, 0x7bcf, 0x94b2, 0xd6db, 0xd6fc, 0x528a, 0x6b6d, 0xb5b6,
+	0xce79, 0xe73c, 0x05da, 0x2104, 0x4a8a, 0x8492, 0x73ae, 0x8c51, 0x632c, 0xbdd7, 0x39c7, 0x52aa,
+	0x39e7, 0x1082, 0xdefb, 0xc5f7, 0x52cb, 0x4a69, 0x18e3, 0x5acb, 0xe71c, 0x5b0c, 0x7bef, 0xad55,
+	0x9944, 0x7c51, 0xb596, 0x8410, 0xce59, 0x0104, 0x5aeb, 0x0862, 0x31a6, 0x9123, 0x18c3, 0x4249,
+	0x0082, 0x8493, 0x0841, 0x20c3, 0x0882, 0xe1e6, 0x4228, 0x52ab, 0x3186, 0x05fa, 0x024a, 0x7c31,
+	0x20c2, 0xf206, 0xc638, 0x061b, 0xe206, 0x0558, 0x9144, 0x8cd4, 0xea06, 0x39e8, 0x6bcf, 0xbdf7,
+	0x738e, 0x4a49, 0x6b8e, 0x636e, 0xd6ba, 0x20a2, 0x3061, 0xe9e6, 0x0041, 0xa555, 0x8472, 0x2965,
+	0x2145, 0xc67a, 0x9943, 0x05b9, 0x7165, 0x0cb4, 0x0840, 0x530c, 0xbd21, 0x0229, 0x4208, 0x88a2,
+	0x73f0, 0x2125, 0x063c, 0xb164, 0x1578, 0x9164, 0x1493, 0x8944, 0x0c94, 0x9923, 0x1c73, 0x3a08,
+	0xef9e, 0xdf3d, 0x9471, 0x31e8, 0x58c2, 0x41c0, 0x2840, 0xca07, 0x0904, 0x18a1, 0x00e4, 0x5b4d,
+	0x10c3, 0x2b8f, 0x0598, 0xf77d, 0x0516, 0x19c7, 0xd1e6, 0xcedb, 0xda48, 0x20e3, 0x7c52, 0xa984,
+	0xa9c6, 0x1061, 0x4aab, 0xb8e3, 0x20e0, 0xe664, 0x84b3, 0x2986, 0xdf1c, 0x065c, 0x6b6e, 0xba07,
+	0xd71c, 0x2966, 0xce38, 0x0a09, 0x6baf, 0x0db9, 0x0557, 0x161b, 0x1820, 0x0061, 0x08c3, 0x2bf1,
+	0x39a1, 0x6bd0, 0xf7df, 0x230d, 0x31c7, 0x526a, 0x1a29, 0x18c0, 0xd206, 0x6b8f, 0x5a64, 0x3020,
+	0x10e4, 0x4020, 0x1020, 0x99a6, 0xffbe, 0x8430, 0x0a8b, 0x4a6a, 0x60c2, 0x3165, 0x31a7, 0x7411,
+	0x18e4, 0x5b2d, 0xa185, 0x2061, 0x0dfb, 0x1000, 0x0599, 0xe75d, 0xd1a5,
+};
+
+static const uint8_t ambulanceData[] = {
+	0xff, 0x00, 0xff, 0x00, 0xd1, 0x00, 0x01, 0x0d, 0x3e, 0x98, 0x05, 0x02, 0x15, 0x13, 0x03, 0x82, 0x00, 0x01, 0x13, 0x24, 0x8b, 0x00, 0x02, 0x02,
+	0x1d, 0x0a, 0x8a, 0x09, 0x00, 0x10, 0x8c, 0x09, 0x02, 0x27, 0x01, 0x23, 0x82, 0x00, 0x01, 0x2e, 0x1d, 0x82, 0x00, 0x00, 0x02, 0x87, 0x00, 0x04,
+	0x32, 0x01, 0x1e, 0x0d, 0x25, 0x88, 0x11, 0x00, 0x03, 0x82, 0x02, 0x00, 0x25, 0x87, 0x11, 0x0d, 0xa4, 0x6d, 0x35, 0x60, 0x03, 0x00, 0x00, 0x07,
+	0x2b, 0x00, 0x00, 0x25, 0x4e, 0x40, 0x86, 0x00, 0x04, 0x0e, 0x0a, 0x3e, 0x00, 0x02, 0x87, 0x03, 0x07, 0x04, 0x06, 0x1d, 0x3a, 0x2d, 0x00, 0x02,
+	0x02, 0x83, 0x03, 0x0f, 0x02, 0x03, 0x84, 0x20, 0x34, 0x1a, 0x02, 0x00, 0x00, 0x0e, 0x38, 0x00, 0x03, 0x37, 0x35, 0x0d, 0x86, 0x00, 0x04, 0x0e,
+	0x0a, 0x3b, 0x03, 0x04, 0x85, 0x02, 0x02, 0x04, 0x00, 0x0c, 0x82, 0x01, 0x03, 0x31, 0x24, 0x03, 0x04, 0x83, 0x02, 0x06, 0x04, 0x02, 0x0d, 0x1f,
+	0x2f, 0x1a, 0x02, 0x85, 0x00, 0x01, 0x17, 0x32, 0x87, 0x00, 0x04, 0x0e, 0x01, 0x17, 0x00, 0x04, 0x84, 0x02, 0x0b, 0x04, 0x0d, 0x03, 0x39, 0x08,
+	0xbc, 0x5a, 0x16, 0x3b, 0x03, 0x0d, 0x04, 0x84, 0x02, 0x09, 0x0d, 0x1f, 0x4f, 0x1a, 0x02, 0x00, 0x24, 0x1a, 0x2a, 0x0e, 0x8a, 0x00, 0x04, 0x0e,
+	0x01, 0x17, 0x00, 0x04, 0x84, 0x02, 0x82, 0x00, 0x05, 0xa6, 0x08, 0x58, 0x6e, 0x16, 0x2d, 0x82, 0x00, 0x84, 0x02, 0x0a, 0x0d, 0x1f, 0x2f, 0x2c,
+	0x03, 0x11, 0x27, 0x66, 0x8a, 0x61, 0x04, 0x89, 0x00, 0x04, 0x0e, 0x01, 0x17, 0x00, 0x04, 0x83, 0x02, 0x0e, 0x0d, 0x0c, 0x39, 0x22, 0x6c, 0x08,
+	0x0b, 0x45, 0x01, 0x47, 0x12, 0x07, 0x23, 0x03, 0x04, 0x82, 0x02, 0x0a, 0x0d, 0x1f, 0x4f, 0x1a, 0x00, 0x14, 0x01, 0x98, 0xa7, 0x01, 0x0e, 0x89,
+	0x00, 0x25, 0x0e, 0x01, 0x17, 0x00, 0x04, 0x02, 0x02, 0x04, 0x00, 0x06, 0x01, 0x08, 0x08, 0xd1, 0x66, 0x67, 0x7b, 0xb0, 0x08, 0x08, 0x01, 0x19,
+	0x14, 0x03, 0x04, 0x02, 0x02, 0x0d, 0x1f, 0x2f, 0x07, 0x0d, 0x13, 0x0a, 0x8b, 0x9c, 0x0a, 0x0e, 0x89, 0x00, 0x26, 0x0e, 0x01, 0x17, 0x00, 0x04,
+	0x02, 0x04, 0x04, 0x00, 0x2a, 0x01, 0x96, 0x58, 0x0b, 0x67, 0x55, 0x55, 0x4d, 0x0b, 0x5c, 0x7f, 0x01, 0x33, 0x00, 0x04, 0x02, 0x02, 0x0d, 0x1f,
+	0x2f, 0x10, 0x2c, 0x21, 0x01, 0xcf, 0x65, 0x0a, 0xc5, 0x25, 0x88, 0x00, 0x1f, 0x0e, 0x01, 0x17, 0x00, 0x04, 0x02, 0x02, 0x04, 0x00, 0x1d, 0x01,
+	0x5a, 0x3c, 0x45, 0x9b, 0x55, 0x4d, 0x3c, 0x45, 0x3c, 0x88, 0x01, 0x13, 0x00, 0x04, 0x02, 0x02, 0x0d, 0x1f, 0x21, 0x01, 0x75, 0x82, 0x52, 0x04,
+	0xab, 0x95, 0xb1, 0x3f, 0x03, 0x87, 0x00, 0x27, 0x0e, 0x01, 0x17, 0x00, 0x04, 0x02, 0x02, 0x04, 0x00, 0x23, 0x19, 0x16, 0x16, 0x01, 0xc2, 0x4d,
+	0x3c, 0x01, 0x01, 0x16, 0x16, 0x30, 0x38, 0x03, 0x04, 0x02, 0x02, 0x0d, 0x20, 0x21, 0xb2, 0x7c, 0xaf, 0x26, 0xd0, 0x92, 0x82, 0xba, 0x35, 0x11,
+	0x87, 0x00, 0x04, 0x0e, 0x01, 0x17, 0x00, 0x04, 0x82, 0x02, 0x0f, 0x04, 0x03, 0x24, 0x3b, 0x2d, 0x47, 0x08, 0x0b, 0x45, 0x01, 0x3a, 0x23, 0x17,
+	0x25, 0x03, 0x04, 0x82, 0x02, 0x0c, 0x0d, 0x20, 0x21, 0x48, 0x59, 0x57, 0x26, 0x51, 0xad, 0x7e, 0xc6, 0x10, 0x38, 0x87, 0x00, 0x04, 0x0e, 0x01,
+	0x17, 0x00, 0x04, 0x83, 0x02, 0x0d, 0x04, 0x03, 0x00, 0x00, 0x1a, 0x08, 0x5c, 0x3c, 0x16, 0x23, 0x00, 0x00, 0x02, 0x04, 0x83, 0x02, 0x0c, 0x0d,
+	0x1f, 0x21, 0x48, 0x59, 0x51, 0x26, 0x26, 0x6f, 0x80, 0xb7, 0x01, 0x64, 0x87, 0x00, 0x04, 0x0e, 0x01, 0x17, 0x00, 0x04, 0x84, 0x02, 0x0b, 0x04,
+	0x0d, 0x00, 0x07, 0x01, 0x7d, 0xc8, 0x01, 0x17, 0x03, 0x0d, 0x04, 0x84, 0x02, 0x05, 0x0d, 0x20, 0x21, 0x48, 0xae, 0x51, 0x82, 0x26, 0x03, 0x71,
+	0x91, 0x0a, 0x56, 0x87, 0x00, 0x03, 0x0e, 0x01, 0x3b, 0x03, 0x86, 0x04, 0x08, 0x0d, 0x03, 0x3e, 0x31, 0x01, 0x01, 0x2e, 0x38, 0x02, 0x86, 0x04,
+	0x0c, 0xd3, 0x97, 0xb9, 0x48, 0xd2, 0xa5, 0x57, 0x57, 0x7a, 0x94, 0xb3, 0x16, 0x5f, 0x87, 0x00, 0x02, 0x0e, 0x01, 0x23, 0x8a, 0x00, 0x03, 0x32,
+	0x40, 0x24, 0x0d, 0x88, 0x00, 0x04, 0xb6, 0x85, 0x34, 0x01, 0x8e, 0x83, 0x41, 0x05, 0x8c, 0xc0, 0x01, 0x60, 0x56, 0x11, 0x85, 0x00, 0x04, 0x0e,
+	0x01, 0x2b, 0xaa, 0x33, 0x87, 0x13, 0x05, 0x33, 0x40, 0x24, 0x24, 0x56, 0x33, 0x85, 0x13, 0x07, 0x33, 0x13, 0x2d, 0x69, 0x83, 0x01, 0x65, 0x4b,
+	0x82, 0x54, 0x81, 0x4b, 0x0d, 0x27, 0x19, 0x01, 0x10, 0x07, 0x15, 0x14, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x36, 0x0a, 0x99, 0x01, 0x02, 0x19, 0x1e,
+	0x69, 0x84, 0x18, 0x0d, 0x15, 0x1e, 0x30, 0x72, 0x89, 0xa0, 0x01, 0x17, 0x00, 0x00, 0x0e, 0x01, 0x70, 0xce, 0x96, 0x0f, 0x05, 0x81, 0x77, 0xbf,
+	0x19, 0x1c, 0x15, 0x82, 0x06, 0x81, 0x05, 0x0d, 0x06, 0x18, 0x4f, 0x16, 0x74, 0xa1, 0xbe, 0x2e, 0x00, 0x00, 0x0e, 0x01, 0xc3, 0x58, 0x96, 0x0b,
+	0x05, 0xd4, 0x9f, 0xc1, 0x4c, 0x1e, 0x1d, 0x82, 0x46, 0x0f, 0x36, 0x3f, 0x15, 0x05, 0x3a, 0x16, 0x8d, 0xb4, 0xbb, 0x0a, 0x03, 0x00, 0x0e, 0x01,
+	0x99, 0x9d, 0x98, 0x08, 0x03, 0x01, 0x19, 0x0c, 0x3a, 0x82, 0x09, 0x17, 0x6b, 0x3f, 0x15, 0x05, 0x15, 0x22, 0x50, 0x79, 0x43, 0x0a, 0x03, 0x00,
+	0x0e, 0x01, 0x28, 0x62, 0x1a, 0x22, 0x12, 0x12, 0x22, 0x22, 0x12, 0x12, 0x82, 0x22, 0x8c, 0x12, 0x04, 0x39, 0x27, 0x31, 0x1c, 0x18, 0x83, 0x06,
+	0x16, 0x15, 0x05, 0x06, 0x06, 0x18, 0x1e, 0x2a, 0x44, 0x01, 0x03, 0x00, 0x32, 0x01, 0x3e, 0x00, 0xc4, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00,
+	0x82, 0x03, 0x8b, 0x00, 0x23, 0x04, 0x20, 0x21, 0x4a, 0x0c, 0x15, 0x05, 0x05, 0x15, 0x3b, 0x06, 0x06, 0x18, 0x18, 0x06, 0x0c, 0x1d, 0x30, 0x01,
+	0x03, 0x00, 0x14, 0x01, 0x15, 0x00, 0x04, 0x03, 0x15, 0x2f, 0x2e, 0x61, 0x3f, 0x25, 0x03, 0x04, 0x0d, 0x8b, 0x14, 0x23, 0x38, 0x20, 0x28, 0x0a,
+	0x86, 0x15, 0x06, 0x15, 0x2b, 0x4e, 0x09, 0x10, 0x30, 0x2a, 0x18, 0x0c, 0x2a, 0x44, 0x01, 0x00, 0x2d, 0x2f, 0x01, 0x10, 0x32, 0x03, 0x2c, 0x01,
+	0x01, 0x43, 0x01, 0x01, 0x50, 0x64, 0x00, 0x07, 0x89, 0x0a, 0x26, 0x31, 0x0a, 0x39, 0x20, 0x28, 0x4a, 0x1c, 0x05, 0x15, 0x2a, 0x0a, 0x01, 0x0a,
+	0x0a, 0x01, 0x16, 0x37, 0x15, 0x42, 0x0a, 0x01, 0x40, 0x36, 0x27, 0x2c, 0x1d, 0x03, 0x1c, 0x01, 0xa3, 0x3d, 0x49, 0x62, 0xb8, 0x01, 0x4e, 0x04,
+	0x18, 0x37, 0x89, 0x07, 0x23, 0x37, 0x05, 0xa8, 0xc7, 0x4a, 0x1c, 0x15, 0x0c, 0x31, 0x68, 0x63, 0x49, 0xcb, 0x28, 0x4c, 0x01, 0x1d, 0x2b, 0x50,
+	0x19, 0x30, 0x01, 0x42, 0x00, 0x00, 0x04, 0xc9, 0x43, 0x29, 0x29, 0x6a, 0x53, 0x8f, 0xa9, 0x01, 0x5f, 0x8c, 0x00, 0x1b, 0x03, 0x20, 0x34, 0x10,
+	0x0c, 0x3e, 0x37, 0x01, 0x73, 0x5b, 0x1b, 0x29, 0xac, 0x28, 0x01, 0x76, 0x1e, 0x3f, 0x44, 0x01, 0x21, 0x16, 0x10, 0x09, 0x27, 0x16, 0x87, 0x49,
+	0x82, 0x1b, 0x04, 0x12, 0x47, 0x0a, 0x36, 0x09, 0x8d, 0x10, 0x22, 0x4c, 0x16, 0x46, 0x36, 0x4a, 0x31, 0x3d, 0x1b, 0x1b, 0x29, 0xb5, 0x34, 0x90,
+	0x16, 0x19, 0x19, 0x01, 0x2c, 0x32, 0x05, 0x1c, 0x0c, 0x2b, 0x2e, 0x5d, 0xa2, 0x9a, 0x1b, 0x1b, 0x63, 0x47, 0x01, 0x1d, 0x1e, 0x1c, 0x8e, 0x0c,
+	0x0f, 0x1c, 0x1e, 0x07, 0x68, 0x53, 0x6a, 0x1b, 0x29, 0x5e, 0x34, 0xcc, 0x35, 0x0c, 0x0c, 0x06, 0x11, 0x84, 0x00, 0x09, 0x1c, 0x19, 0x3d, 0x49,
+	0x29, 0x53, 0xcd, 0x6b, 0x30, 0x0d, 0x92, 0x00, 0x09, 0x14, 0x19, 0x9e, 0x5b, 0x1b, 0x29, 0xbd, 0x28, 0x01, 0x2d, 0x84, 0x00, 0x82, 0x03, 0x09,
+	0x00, 0x14, 0x44, 0xca, 0x78, 0x3d, 0x12, 0x5d, 0x27, 0x15, 0x94, 0x03, 0x08, 0x3a, 0x10, 0x39, 0x3d, 0x5e, 0x28, 0x09, 0x42, 0x25, 0x82, 0x03,
+	0x01, 0x00, 0x2b, 0x83, 0x07, 0x00, 0x2c, 0x82, 0x01, 0x05, 0x43, 0x16, 0x01, 0x01, 0x35, 0x1a, 0x92, 0x07, 0x0e, 0x1a, 0x2e, 0x01, 0x01, 0x0a,
+	0x0a, 0x01, 0x01, 0x0a, 0x1a, 0x07, 0x07, 0x42, 0x1e, 0x17, 0x84, 0x06, 0x86, 0x05, 0x96, 0x06, 0x86, 0x05, 0x83, 0x06, 0x00, 0x23, 0xff, 0x00,
+	0xff, 0x00, 0xcf, 0x00,
+};
+
+const iconAsset ambulance = { 48, 48, ambulancePalette, nullptr, ambulanceData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t fireEnginePalette[] = {
+	0xffff, 0x0000, 0xbdd7, 0xbdf7, 0x84b3, 0x638e, 0x39c7, 0xf206, 0xef7d, 0x7c72, 0x8cd3, 0xfa26,
+	0x0841, 0x6bcf, 0x636e, 0xe73c, 0x0861, 0x31c7, 0x63f1, 0x6baf, 0x7c52, 0x4249, 0x10a2, 0xffdf,
+	0x8cd4, 0xd6ba, 0x4269, 0x6411, 0x29a7, 0xef5d, 0x39e7, 0x061b, 0x4a8a, 0x0020, 0x6412, 0x3020,
+	0x05da, 0x8493, 0x426a, 0x39e8, 0x52cb, 0x0125, 0x8492, 0x9123, 0xe71c, 0x8472, 0x634d, 0xdefb,
+	0x5bf1, 0x10c3, 0x8c71, 0xc618, 0x7c51, 0xea06, 0x3a08, 0x31a6, 0x18e3, 0x7410, 0x2124, 0x3a29,
+	0xfa47, 0x8410, 0xf79e, 0x0882, 0x5aeb, 0x5bd1, 0xfa27, 0xd69a, 0x21a7, 0x05fa, 0x18c3, 0x0146,
+	0x2104, 0xc638, 0x0041, 0xdedb, 0x2945, 0xb596, 0x9cd3, 0x2145, 0x063b, 0x4228, 0xf7be, 0x8c51,
+	0x5b4d, 0xa534, 0x2966, 0x6bd0, 0x9492, 0x3209, 0x1904, 0x8430, 0x0412, 0x2186, 0x05d9, 0x5b2d,
+	0xb5b6, 0x6b4d, 0x4208, 0x73ae, 0x638f, 0xce79, 0x00e4, 0x738e, 0x3186, 0x10a3, 0xa514, 0x2986,
+	0x038f, 0x065c, 0x0166, 0x42ab, 0x52aa, 0x0453, 0x00c3, 0x1020, 0x9cf3, 0x0800, 0x6b6d, 0x7411,
+	0x1082, 0x7431, 0x2187, 0x1598, 0x9144, 0x73f0, 0x58a2, 0xce59, 0x2125, 0x31e7, 0x4a69, 0x31e8,
+	0x1800, 0x2452, 0x0433, 0x3a6a, 0x3208, 0x538f, 0x4aab, 0xa164, 0x428b, 0x2166, 0x6c32, 0x7bcf,
+	0x8123, 0x4b0d, 0x94b2, 0x48a2, 0x6432, 0x52ec, 0xad55, 0x1820, 0x3061, 0x6b8f, 0x5bb0, 0xf1e6,
+	0xd9e5, 0x5bd0, 0x1000, 0x0599, 0xea68, 0x2965, 0x067d, 0x0209, 0x49e0, 0x05b9, 0xfa67, 0x15da,
+	0xa0e3, 0x530c, 0x4aec, 0x42cc, 0xf268, 0x40a3, 0xe1e6, 0xb984, 0x0d98, 0x0924, 0x063c, 0x3104,
+	0x0578, 0xd207, 0x0040, 0x89c6, 0x1493, 0x42ec, 0x2000, 0x1c73, 0x0474, 0x3a4a, 0x7b40, 0xd9e6,
+	0x42ac, 0x58c2, 0xe9c5, 0x2840, 0xc9c5, 0x2882, 0xc1a5, 0x2020, 0x4041, 0x5acb, 0x536f, 0x5b8f,
+	0xb184, 0x52ab, 0x4a49, 0x29c7, 0xd1e6, 0xf9c6, 0x10e3, 0x5baf, 0xda48, 0x0cf5, 0x632c, 0x9441,
+	0x1905, 0x5b0c, 0x1061, 0x5b4e, 0x2b6f, 0x8164, 0x6965, 0x80c3, 0x0082, 0xda68, 0x0bf1, 0x50a2,
+	0xc9a6, 0xad75, 0x630c, 0x0d57, 0x3861, 0x7144, 0x0cd5, 0xa104, 0x84d3, 0xac80, 0x7bef, 0x8cb3,
+	0x4229, 0x29e8, 0x7c31, 0x5061, 0x2146, 0x0945, 0x0557, 0xd965, 0x1599, 0x9143, 0xd145, 0x0061,
+	0x2baf, 0x9944, 0x5103, 0x1432, 0x1aab, 0x4aed, 0xe9e6, 0x2122, 0xff01, 0x09a7, 0x2861, 0x63d0,
+	0x10e4, 0x0021, 0x136f, 0xf226, 0x534e, 0x52cc, 0x68e2, 0x0390, 0x5a80, 0x60c2, 0x15fa, 0x29a6,
+	0x40c2, 0xd1c5, 0x0860, 0x31a7, 0x7453, 0x4acc, 0x00a3, 0x4965, 0x8cf4, 0x03b0,
+};
+
+static const uint8_t fireEngineData[] = {
+	0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x01, 0x00, 0x65, 0x00, 0x03, 0x83, 0x00, 0x02, 0x00, 0x00, 0x03, 0x83, 0x00, 0x02, 0x00,
+	0x00, 0x03, 0x82, 0x00, 0x02, 0x81, 0x00, 0x03, 0x82, 0x00, 0x02, 0x81, 0x00, 0x03, 0x82, 0x00, 0x02, 0x00, 0x00, 0x03, 0x83, 0x00, 0x02, 0x00,
+	0x00, 0x03, 0x82, 0x00, 0x02, 0x81, 0x00, 0x03, 0x00, 0x00, 0x2f, 0x82, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00, 0x08, 0x85, 0x00, 0x00, 0x29, 0x00,
+	0x61, 0x00, 0x01, 0x00, 0x10, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x01, 0x00, 0x38, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x10, 0x00, 0x01, 0x00,
+	0x37, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x37, 0x00, 0x06, 0x00, 0x68, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62, 0x00, 0x1e, 0x00,
+	0x4c, 0x00, 0x01, 0x00, 0x38, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x10, 0x00, 0x01, 0x00, 0x3a, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x10, 0x00, 0x01, 0x00,
+	0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x3a, 0x00, 0x02, 0x85, 0x00, 0x00, 0x3b, 0x00, 0x2c, 0x00, 0x16, 0x00, 0xe5, 0x00, 0x1d, 0x00,
+	0x08, 0x00, 0x33, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x08, 0x00, 0x08, 0x00, 0x96, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x08, 0x00, 0x8f, 0x00,
+	0x63, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x2c, 0x00, 0x70, 0x00, 0x58, 0x00, 0x08, 0x00, 0x08, 0x00, 0x19, 0x00, 0x16, 0x00, 0x33, 0x00, 0x08, 0x00,
+	0x08, 0x00, 0x4d, 0x00, 0x37, 0x00, 0x43, 0x00, 0x08, 0x00, 0x1d, 0x00, 0x58, 0x00, 0x46, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+	0x48, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x49, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x2f, 0x00, 0x4c, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00, 0x5b, 0x82,
+	0x00, 0x00, 0x0f, 0x00, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00,
+	0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x16, 0x82, 0x00, 0x00, 0x2d, 0x00, 0x17, 0x00, 0x4d, 0x00, 0x2c, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x06, 0x00, 0xce, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x53, 0x00, 0x03, 0x00, 0x03, 0x00, 0x4e, 0x00, 0x16, 0x00,
+	0x4e, 0x00, 0x03, 0x00, 0x03, 0x00, 0x5b, 0x00, 0x01, 0x00, 0x60, 0x00, 0x02, 0x00, 0x02, 0x00, 0x40, 0x00, 0xc9, 0x00, 0x60, 0x00, 0x03, 0x00,
+	0x4d, 0x00, 0x62, 0x00, 0x67, 0x00, 0x03, 0x00, 0x03, 0x00, 0x55, 0x00, 0x01, 0x00, 0x92, 0x00, 0x03, 0x00, 0x03, 0x00, 0x32, 0x00, 0x38, 0x00,
+	0x6a, 0x00, 0x03, 0x00, 0x03, 0x00, 0x67, 0x00, 0x01, 0x00, 0x2f, 0x85, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x53, 0x00, 0x2c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0xa2, 0x00, 0x01, 0x06, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x92, 0x00, 0x4d, 0x00, 0x52, 0x85, 0x00, 0x00,
+	0x00, 0x00, 0x17, 0x83, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x48, 0x00, 0xd3, 0x00, 0xdb, 0x00, 0x38, 0x00, 0x2c, 0x87, 0x00, 0x00, 0x05, 0x00,
+	0x0f, 0x00, 0xa1, 0x00, 0x6f, 0x01, 0x18, 0x00, 0x80, 0x00, 0x4d, 0x82, 0x00, 0x00, 0x86, 0x00, 0x17, 0x81, 0x00, 0x00, 0x04, 0x00, 0x19, 0x00,
+	0x01, 0x00, 0x97, 0x00, 0x01, 0x00, 0x4e, 0x86, 0x00, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x19, 0x00, 0x19, 0x00, 0x4b, 0x00, 0x74, 0x00, 0x01, 0x00,
+	0xbd, 0x00, 0x59, 0x00, 0x01, 0x00, 0x02, 0x00, 0x4b, 0x85, 0x00, 0x19, 0x09, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x48, 0x00, 0x8d, 0x00, 0xaa, 0x00,
+	0x01, 0x00, 0x58, 0x00, 0x19, 0x00, 0x19, 0x00, 0x2f, 0x88, 0x00, 0x00, 0x05, 0x00, 0x6a, 0x00, 0x97, 0x00, 0xe1, 0x00, 0xde, 0x00, 0x70, 0x00,
+	0x08, 0x84, 0x00, 0x00, 0x01, 0x00, 0x7f, 0x00, 0x51, 0x84, 0x00, 0x01, 0x00, 0x00, 0x10, 0x93, 0x00, 0x01, 0x00, 0x00, 0x74, 0x87, 0x00, 0x00,
+	0x05, 0x00, 0x4e, 0x00, 0xc5, 0x00, 0xac, 0x00, 0xdd, 0x00, 0x82, 0x00, 0x1d, 0x83, 0x00, 0x00, 0x0a, 0x00, 0x08, 0x00, 0xe6, 0x00, 0x80, 0x00,
+	0x05, 0x00, 0x05, 0x00, 0x13, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x05, 0x00, 0x05, 0x00, 0x0e, 0x88, 0x00, 0x13, 0x0a, 0x00, 0x99, 0x00, 0x05, 0x00,
+	0x0e, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x05, 0x00, 0x05, 0x00, 0x28, 0x00, 0x56, 0x00, 0x01, 0x00, 0x3d, 0x85, 0x00, 0x32, 0x07, 0x00, 0x58, 0x00,
+	0x70, 0x00, 0x75, 0x01, 0x14, 0x00, 0xba, 0x00, 0x3a, 0x00, 0x53, 0x00, 0x19, 0x82, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x26, 0x00,
+	0x18, 0x00, 0x39, 0x00, 0x0e, 0x93, 0x00, 0x05, 0x05, 0x00, 0x0e, 0x00, 0x8a, 0x00, 0x11, 0x00, 0x16, 0x00, 0x72, 0x00, 0x6e, 0x82, 0x00, 0x47,
+	0x13, 0x00, 0x6e, 0x00, 0x66, 0x00, 0x01, 0x00, 0x66, 0x00, 0x6e, 0x00, 0x47, 0x00, 0x47, 0x00, 0xf5, 0x00, 0xe0, 0x00, 0x01, 0x00, 0x19, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x15, 0x00, 0x2d, 0x00, 0x4f, 0x00, 0x01, 0x00, 0x21, 0x93, 0x00, 0x01, 0x1b, 0x00, 0x10, 0x00,
+	0x01, 0x00, 0x10, 0x01, 0x0a, 0x00, 0xa7, 0x00, 0x7b, 0x00, 0xf8, 0x00, 0x7b, 0x01, 0x12, 0x00, 0xff, 0x00, 0x16, 0x00, 0xe2, 0x00, 0x24, 0x00,
+	0xb0, 0x00, 0x9f, 0x00, 0xea, 0x00, 0xfc, 0x00, 0xd2, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x15, 0x00, 0x04, 0x00,
+	0x5f, 0x00, 0x15, 0x00, 0x26, 0x83, 0x00, 0x1a, 0x02, 0x00, 0x15, 0x00, 0x1a, 0x00, 0x1a, 0x82, 0x00, 0x26, 0x01, 0x00, 0x1a, 0x00, 0x15, 0x83,
+	0x00, 0x1a, 0x1e, 0x00, 0x15, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x15, 0x00, 0x11, 0x00, 0x5a, 0x00, 0x01, 0x01, 0x0f, 0x00, 0x50, 0x00, 0x45, 0x00,
+	0x45, 0x00, 0x24, 0x00, 0x6d, 0x00, 0x71, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x50, 0x00, 0x45, 0x00, 0x1f, 0x00, 0xf6, 0x00, 0x85, 0x00, 0xb1, 0x00,
+	0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x15, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x04, 0x86, 0x00, 0x0a, 0x83, 0x00, 0x04, 0x87,
+	0x00, 0x0a, 0x1c, 0x00, 0x04, 0x00, 0x25, 0x00, 0x05, 0x00, 0x36, 0x00, 0x01, 0x00, 0x6c, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x24, 0x00, 0x5e, 0x00,
+	0x50, 0x00, 0x71, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x45, 0x00, 0xe7, 0x00, 0x85, 0x01, 0x05, 0x00, 0x76, 0x00, 0x3e, 0x00,
+	0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x15, 0x00, 0x04, 0x00, 0x14, 0x00, 0x13, 0x85, 0x00, 0x0e, 0x01, 0x00, 0x05, 0x00, 0x77, 0x82, 0x00, 0x09,
+	0x00, 0x00, 0x13, 0x85, 0x00, 0x0e, 0x1d, 0x00, 0x05, 0x00, 0x79, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x27, 0x00, 0x01, 0x00, 0x6c, 0x00, 0x1f, 0x00,
+	0x24, 0x00, 0x24, 0x00, 0x5e, 0x00, 0xb2, 0x00, 0x71, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x45, 0x00, 0xb4, 0x00, 0xbb, 0x00,
+	0xa3, 0x00, 0x51, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0xf0, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x3f, 0x86, 0x00, 0x01, 0x04, 0x00,
+	0x83, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x13, 0x00, 0x0c, 0x86, 0x00, 0x01, 0x1d, 0x00, 0x15, 0x00, 0x04, 0x00, 0x54, 0x00, 0x27, 0x00, 0x01, 0x00,
+	0x6c, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x24, 0x00, 0xa5, 0x00, 0x50, 0x00, 0x86, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x24, 0x00,
+	0x9f, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x10, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x15, 0x00, 0x04, 0x00, 0x34, 0x00, 0x95, 0x00,
+	0x26, 0x84, 0x00, 0x20, 0x06, 0x00, 0x26, 0x00, 0x64, 0x00, 0x25, 0x00, 0x09, 0x00, 0x34, 0x01, 0x0d, 0x00, 0x26, 0x84, 0x00, 0x20, 0x07, 0x00,
+	0x26, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x54, 0x00, 0x27, 0x00, 0x01, 0x01, 0x1d, 0x00, 0x6d, 0x82, 0x00, 0x1f, 0x04, 0x00, 0xa2, 0x00, 0xbc, 0x00,
+	0x01, 0x00, 0x86, 0x00, 0x6d, 0x82, 0x00, 0x1f, 0x09, 0x00, 0xd5, 0x00, 0xdc, 0x00, 0x01, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00,
+	0x15, 0x00, 0x25, 0x00, 0x09, 0x87, 0x00, 0x04, 0x03, 0x00, 0x25, 0x00, 0x09, 0x00, 0x09, 0x00, 0x2d, 0x87, 0x00, 0x04, 0x05, 0x00, 0x25, 0x00,
+	0x14, 0x00, 0x2e, 0x00, 0x27, 0x00, 0x01, 0x01, 0x1a, 0x84, 0x00, 0x29, 0x02, 0x00, 0x72, 0x00, 0x01, 0x00, 0x72, 0x83, 0x00, 0x29, 0x0a, 0x00,
+	0x66, 0x00, 0x6b, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x7d, 0x00, 0x3f, 0x86, 0x00, 0x01,
+	0x04, 0x00, 0x36, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x0c, 0x86, 0x00, 0x01, 0x05, 0x00, 0x1a, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x36, 0x00,
+	0x01, 0x00, 0x84, 0x85, 0x00, 0x23, 0x00, 0x00, 0x98, 0x84, 0x00, 0x23, 0x0a, 0x00, 0x98, 0x00, 0xb3, 0x00, 0x01, 0x00, 0x74, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x06, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x77, 0x00, 0x15, 0x86, 0x00, 0x11, 0x04, 0x00, 0xd9, 0x00, 0x2a, 0x00, 0x09, 0x00, 0x39, 0x00,
+	0x3b, 0x85, 0x00, 0x11, 0x0c, 0x00, 0x81, 0x00, 0x54, 0x00, 0x2a, 0x00, 0x2e, 0x00, 0x27, 0x00, 0x01, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0x0b, 0x00,
+	0x42, 0x00, 0x42, 0x00, 0x3c, 0x00, 0xa6, 0x82, 0x00, 0x3c, 0x0e, 0x00, 0x42, 0x00, 0x0b, 0x00, 0x3c, 0x00, 0xd1, 0x00, 0xf7, 0x00, 0xc8, 0x00,
+	0x3d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x15, 0x00, 0x0a, 0x00, 0x25, 0x00, 0x18, 0x00, 0x0a, 0x83, 0x00, 0x18, 0x07, 0x00, 0x0a, 0x00,
+	0x18, 0x00, 0x0a, 0x00, 0x2a, 0x00, 0x25, 0x00, 0x04, 0x00, 0x18, 0x00, 0x0a, 0x83, 0x00, 0x18, 0x81, 0x00, 0x04, 0x1a, 0x00, 0x25, 0x00, 0x14,
+	0x00, 0x2e, 0x00, 0x36, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x0b, 0x00, 0x35, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x90, 0x00, 0x93, 0x00, 0x93, 0x01, 0x0e,
+	0x00, 0x35, 0x00, 0x07, 0x00, 0x07, 0x00, 0xc6, 0x00, 0x7e, 0x00, 0xad, 0x00, 0x84, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x27,
+	0x00, 0x39, 0x89, 0x00, 0x0d, 0x82, 0x00, 0x57, 0x85, 0x00, 0x0d, 0x1c, 0x00, 0x14, 0x00, 0x09, 0x00, 0x14, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x36,
+	0x00, 0x01, 0x00, 0x2b, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0b, 0x00, 0xe3, 0x00, 0x73, 0x00, 0x73, 0x01, 0x06, 0x00, 0xbf, 0x00, 0x0b,
+	0x01, 0x15, 0x00, 0x73, 0x00, 0xb6, 0x01, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x21, 0x00, 0x78, 0x90, 0x00,
+	0x0c, 0x0a, 0x00, 0x4a, 0x00, 0x0c, 0x00, 0x56, 0x00, 0x39, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x2e, 0x00, 0x27, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x0b,
+	0x83, 0x00, 0x07, 0x81, 0x00, 0x9c, 0x13, 0x01, 0x02, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x90, 0x00, 0x21, 0x00, 0xed, 0x01, 0x04, 0x00, 0xbe, 0x00,
+	0x10, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x31, 0x00, 0xcf, 0x00, 0x44, 0x00, 0x44, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x44, 0x00, 0x44, 0x88,
+	0x00, 0x1c, 0x0c, 0x00, 0x44, 0x00, 0x7a, 0x00, 0x1c, 0x00, 0xf4, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x2d, 0x00, 0x09, 0x00, 0x2e, 0x00, 0x36, 0x00,
+	0x01, 0x00, 0x2b, 0x00, 0x0b, 0x83, 0x00, 0x07, 0x81, 0x00, 0x0b, 0x0d, 0x00, 0x07, 0x00, 0x35, 0x00, 0x0b, 0x00, 0x8b, 0x00, 0x01, 0x01, 0x10,
+	0x00, 0xd7, 0x00, 0xa4, 0x00, 0x01, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x59, 0x00, 0x94, 0x83, 0x00, 0x12, 0x81, 0x00, 0x22, 0x81, 0x00,
+	0x12, 0x84, 0x00, 0x1b, 0x81, 0x00, 0x12, 0x81, 0x00, 0x22, 0x0a, 0x00, 0x12, 0x00, 0x22, 0x00, 0x88, 0x00, 0x01, 0x00, 0x3b, 0x00, 0x34, 0x00,
+	0x5f, 0x00, 0x81, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x0b, 0x84, 0x00, 0x07, 0x00, 0x00, 0x35, 0x82, 0x00, 0x07, 0x13, 0x00, 0x35, 0x00, 0xc1, 0x00,
+	0x75, 0x00, 0xda, 0x00, 0x10, 0x00, 0x01, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x59, 0x00, 0x22, 0x00, 0x9d, 0x00, 0x41, 0x00, 0x22, 0x00,
+	0x12, 0x00, 0xca, 0x00, 0xcb, 0x00, 0x22, 0x00, 0x1b, 0x00, 0x41, 0x82, 0x00, 0x30, 0x0f, 0x00, 0x41, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x89, 0x00,
+	0x89, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x30, 0x00, 0xd8, 0x00, 0x01, 0x00, 0x31, 0x00, 0x69, 0x00, 0x10, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x0b, 0x83,
+	0x00, 0x07, 0x0e, 0x00, 0x0b, 0x00, 0x42, 0x00, 0xae, 0x00, 0xd0, 0x00, 0x07, 0x00, 0x0b, 0x01, 0x0b, 0x00, 0xaf, 0x00, 0xa8, 0x00, 0xf3, 0x00,
+	0x01, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x1c, 0x82, 0x00, 0x12, 0x19, 0x00, 0x87, 0x00, 0x3f, 0x00, 0x21, 0x00, 0x4a, 0x01, 0x08, 0x00,
+	0xb9, 0x00, 0x1b, 0x00, 0x41, 0x00, 0x41, 0x00, 0x30, 0x00, 0x12, 0x00, 0x6f, 0x00, 0x69, 0x00, 0x21, 0x00, 0x4a, 0x00, 0x69, 0x00, 0x8c, 0x00,
+	0x1b, 0x00, 0x9a, 0x00, 0xf1, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x4a, 0x00, 0x01, 0x00, 0x7c, 0x00, 0x0b, 0x82, 0x00, 0x07, 0x7f, 0x00, 0x0b, 0x00,
+	0xcc, 0x00, 0xe8, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0xc3, 0x00, 0xf9, 0x00, 0x07, 0x00, 0x9b, 0x00, 0xfa, 0x00, 0x7e, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x6a, 0x00, 0x10, 0x00, 0x01, 0x00, 0x91, 0x00, 0x1b, 0x00, 0x7a, 0x00, 0x01, 0x00, 0x16, 0x00, 0x6b, 0x00, 0x5a, 0x00, 0x21, 0x00, 0x01, 0x00,
+	0x87, 0x00, 0x1b, 0x00, 0x9d, 0x00, 0x12, 0x00, 0x59, 0x00, 0x01, 0x00, 0x10, 0x00, 0x56, 0x00, 0x3a, 0x00, 0x21, 0x00, 0x01, 0x00, 0x83, 0x00,
+	0x1b, 0x00, 0x12, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x5d, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x0b, 0x00, 0x35, 0x00, 0x07, 0x00, 0x0b, 0x00, 0xfd, 0x00,
+	0x01, 0x00, 0xfb, 0x00, 0x5d, 0x00, 0x4f, 0x00, 0x4a, 0x00, 0x01, 0x01, 0x11, 0x00, 0x9b, 0x00, 0xeb, 0x00, 0x16, 0x00, 0x01, 0x00, 0x60, 0x00,
+	0x10, 0x00, 0x31, 0x00, 0x6f, 0x00, 0x12, 0x00, 0x8c, 0x00, 0x01, 0x01, 0x13, 0x00, 0x14, 0x00, 0x18, 0x00, 0x79, 0x00, 0x20, 0x00, 0x3f, 0x00,
+	0x21, 0x01, 0x0c, 0x00, 0x94, 0x00, 0x91, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x77, 0x01, 0x1c, 0x00, 0x14, 0x00, 0x28, 0x00, 0x31, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x22, 0x00, 0x30, 0x00, 0xab, 0x00, 0x5d, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x42, 0x00, 0x07, 0x00, 0x0b, 0x00, 0xc4, 0x00, 0x75, 0x00,
+	0x31, 0x00, 0x7d, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x95, 0x00, 0x5a, 0x00, 0x01, 0x00, 0x8b, 0x00, 0xc2, 0x00, 0xdf, 0x00, 0xc7, 0x00, 0x10, 0x00,
+	0x01, 0x00, 0x11, 0x00, 0x8e, 0x01, 0x07, 0x00, 0x8d, 0x00, 0x0c, 0x00, 0xf2, 0x00, 0x25, 0x00, 0x14, 0x00, 0x14, 0x00, 0x05, 0x00, 0x3b, 0x00,
+	0x01, 0x00, 0x88, 0x00, 0x8e, 0x00, 0x11, 0x00, 0x21, 0x00, 0x13, 0x00, 0x04, 0x1d, 0x00, 0x34, 0x00, 0x09, 0x00, 0x99, 0x00, 0x26, 0x00, 0x21,
+	0x00, 0x5d, 0x00, 0x1b, 0x00, 0x9a, 0x01, 0x19, 0x00, 0x27, 0x00, 0x4c, 0x00, 0xb7, 0x00, 0xa0, 0x00, 0xd4, 0x00, 0xa0, 0x00, 0xe9, 0x00, 0x01,
+	0x00, 0x0e, 0x00, 0x0a, 0x00, 0x34, 0x00, 0x09, 0x00, 0x13, 0x00, 0xcd, 0x01, 0x09, 0x00, 0xfe, 0x00, 0xb5, 0x00, 0xe4, 0x01, 0x1b, 0x00, 0x01,
+	0x00, 0x63, 0x83, 0x00, 0x01, 0x01, 0x00, 0x6b, 0x00, 0x14, 0x82, 0x00, 0x09, 0x02, 0x00, 0x05, 0x00, 0x8a, 0x00, 0x78, 0x82, 0x00, 0x01, 0x07,
+	0x00, 0x3a, 0x00, 0x79, 0x00, 0x2d, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x46, 0x8a, 0x00, 0x01, 0x07, 0x00, 0x78, 0x00, 0x14,
+	0x00, 0x09, 0x00, 0x09, 0x00, 0x2a, 0x00, 0x57, 0x00, 0x28, 0x00, 0x48, 0x83, 0x00, 0x01, 0x1a, 0x00, 0x5b, 0x00, 0x08, 0x00, 0x33, 0x00, 0x02,
+	0x00, 0x02, 0x00, 0x61, 0x00, 0x5a, 0x00, 0x09, 0x00, 0x09, 0x00, 0x14, 0x00, 0x09, 0x00, 0x05, 0x00, 0x20, 0x00, 0x21, 0x00, 0x3d, 0x00, 0x49,
+	0x00, 0x63, 0x00, 0x16, 0x00, 0x39, 0x00, 0x2a, 0x00, 0x34, 0x00, 0x09, 0x00, 0x13, 0x00, 0x28, 0x00, 0x10, 0x00, 0x76, 0x00, 0x33, 0x86, 0x00,
+	0x02, 0x0e, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x21, 0x00, 0x39, 0x00, 0x2a, 0x00, 0x14, 0x00, 0x2d, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x16, 0x00, 0x61,
+	0x00, 0x02, 0x00, 0x02, 0x00, 0x33, 0x00, 0x52, 0x83, 0x00, 0x00, 0x14, 0x00, 0x49, 0x00, 0x16, 0x00, 0x2e, 0x00, 0xec, 0x00, 0x04, 0x00, 0x14,
+	0x00, 0x54, 0x00, 0x56, 0x00, 0x37, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x38, 0x00, 0x28, 0x00, 0x04, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x0e,
+	0x00, 0x11, 0x00, 0x16, 0x00, 0x43, 0x88, 0x00, 0x00, 0x09, 0x00, 0x2c, 0x00, 0x68, 0x00, 0x3b, 0x00, 0xef, 0x00, 0x04, 0x00, 0x25, 0x00, 0x05,
+	0x00, 0x15, 0x00, 0x16, 0x00, 0x49, 0x83, 0x00, 0x00, 0x18, 0x00, 0x52, 0x00, 0x08, 0x00, 0x1d, 0x00, 0x08, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x46,
+	0x00, 0x28, 0x00, 0x64, 0x00, 0x28, 0x00, 0x37, 0x00, 0x16, 0x00, 0x3d, 0x00, 0x1d, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x67, 0x00, 0x31, 0x00, 0x20,
+	0x00, 0x64, 0x00, 0xa9, 0x01, 0x17, 0x00, 0x46, 0x00, 0xd6, 0x00, 0x0f, 0x89, 0x00, 0x08, 0x0d, 0x00, 0xee, 0x00, 0x16, 0x00, 0x15, 0x00, 0x05,
+	0x00, 0x5f, 0x00, 0x27, 0x00, 0x46, 0x00, 0x40, 0x00, 0x2f, 0x00, 0x08, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x52, 0x00, 0x76, 0x82, 0x00, 0x06, 0x01,
+	0x00, 0x51, 0x00, 0x10, 0x85, 0x00, 0x01, 0x04, 0x00, 0x4c, 0x00, 0x1e, 0x00, 0x37, 0x00, 0x62, 0x00, 0x3a, 0x85, 0x00, 0x01, 0x01, 0x00, 0x48,
+	0x00, 0x1e, 0x88, 0x00, 0x06, 0x01, 0x00, 0x1e, 0x00, 0xa1, 0x85, 0x00, 0x01, 0x06, 0x00, 0x10, 0x00, 0x51, 0x00, 0x06, 0x00, 0x06, 0x00, 0x68,
+	0x00, 0x8f, 0x00, 0x65, 0x84, 0x00, 0x02, 0x85, 0x00, 0x03, 0x84, 0x00, 0x02, 0x85, 0x00, 0x03, 0x8c, 0x00, 0x02, 0x85, 0x00, 0x03, 0x84, 0x00,
+	0x02, 0x00, 0x00, 0x43, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x9f, 0x00, 0x00,
+};
+
+const iconAsset fireEngine = { 48, 48, fireEnginePalette, nullptr, fireEngineData, true, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t falsePositivePalette[] = {
+	0xffff, 0xefdf, 0xdfbf, 0xefbf, 0xf7ff, 0x0000, 0xfef9, 0x8430, 0xd79f, 0xfbd1, 0xfe77, 0x1082,
+	0xdf9f, 0xe7ff, 0xfed9, 0xb65a, 0xdfdf, 0x6987, 0xfcb4, 0xc67a, 0xff1a, 0xe7df, 0x0861, 0xfcd4,
+	0xa209, 0xa2ab, 0xefff, 0xfc94, 0xff7b, 0xfe57, 0xa22a, 0xff5b, 0x69e8, 0x10a2, 0xfbb0, 0xfb90,
+	0xfbb1, 0xdefb, 0x630c, 0xfc73, 0x0841, 0xb596, 0x6966, 0x1061, 0xff3a, 0x9cf3, 0x0820, 0x1000,
+	0xf7be, 0x7bcf, 0xffbc, 0xbdf7, 0x3186, 0xeb4f, 0xfeb8, 0xd77e, 0x20e3, 0xef7d, 0x31c7, 0xfe98,
+	0x18a2, 0xb4f2, 0x4a69, 0xce79, 0xfc93, 0x18c3, 0x5166, 0xd553, 0x1841, 0x41c6, 0x62aa, 0x0020,
+	0x2966, 0x0041, 0xffdf, 0xfbf1, 0xd69a, 0x20a2, 0x9a8b, 0x3985, 0x5a69, 0x2882, 0xef5d, 0x5a28,
+	0x9492, 0x5125, 0x2903, 0xa534, 0x69c7, 0x4a49, 0x81e8, 0x2986, 0xef9f, 0xa2cc, 0x3904, 0xf452,
+	0x636e, 0xbb2d, 0xbb4e, 0x31a6, 0xc34e, 0x1081, 0x5a89, 0xddf6, 0x10e3, 0x9bee, 0xf7df, 0x5145,
+	0xad96, 0x1861, 0xf79e, 0xcf1d, 0x52cb, 0x6aea, 0xe79e, 0x9a09, 0x2082, 0x4acb, 0xdbd0, 0x6b6d,
+	0xc2ac, 0xff9c, 0xe3f1, 0xbaac, 0x28a3, 0xce59, 0x4249, 0xc659, 0x8cb3, 0xdb0d, 0xddf5, 0xf36f,
+	0xba8b, 0x426a, 0x0882, 0xde16, 0x5b0c, 0xec11, 0x0800, 0xdedb, 0x69c8, 0xb5b6, 0x632d, 0xe411,
+	0xf432, 0xd73d, 0xb512, 0xdf3d, 0xe30e, 0xaa2a, 0x30a3, 0x826a, 0x5986, 0x8a6a, 0xf453, 0x73cf,
+	0x52ec, 0x1904, 0xb5d7, 0xa24a, 0xdf1d, 0xff5a, 0x9a4a, 0xc2cc, 0x5966, 0xdaed, 0x1925, 0x10c3,
+	0xff19, 0xb5f8, 0x89e8, 0x9d96, 0x1882, 0xfcf5, 0xfe78, 0xad55, 0x08c3, 0xc638, 0xa2ec, 0xa5b7,
+	0x4a8a, 0xfbf2, 0x8492, 0xa470, 0xcacd, 0x2165, 0x2924, 0xcb8f, 0x84b3, 0xbebb, 0xcebb, 0x2062,
+	0xaacc, 0xc618, 0x0061, 0x61c7, 0xbd12, 0xd79e, 0x4269, 0xffdc, 0x2186, 0x79a7, 0x2145, 0x6b4d,
+	0xe75e, 0xc36e, 0xd5f5, 0xa28b, 0x4228, 0xf390, 0x63af, 0x5b4d, 0x1041, 0xe71c, 0xe32e, 0x4125,
+	0x38c3, 0x1945, 0x30c3, 0x2166, 0x81c8, 0xbe9b, 0xb639, 0x9d76, 0x40e4, 0x9c2f, 0xe34f, 0xf370,
+	0x3a49, 0x38e4, 0xf6b8, 0x8249, 0xbe5a, 0x7a49, 0xa3ee, 0x39a6, 0xec32, 0x7187, 0xfc32, 0x3a08,
+	0x9c50, 0x93ee, 0xd30d, 0xbe19, 0xe5b5, 0x3208, 0xadb6, 0x5a48, 0x3965, 0xcf3d, 0x5aec, 0xff9b,
+	0xe677, 0x7c31, 0x5945, 0x39c7, 0x928b, 0xf636, 0x52aa, 0xacd1, 0xfc53, 0xd6fc, 0xae39, 0x6269,
+	0x94f4, 0xa40f, 0xdd74, 0x28c3, 0x5207, 0x7431, 0xfd77, 0x8229, 0x530c, 0x4aaa, 0x4945, 0xec12,
+	0x5104, 0x3144, 0xadf8, 0x9209, 0x5228, 0xe3d0, 0xf657, 0xacb1, 0xffdd, 0xd3d0, 0x6187, 0x5925,
+	0xe7bf, 0x8c92, 0x29a6, 0x18e4, 0xb4d2, 0xfe37, 0x2965, 0xad76, 0xc6fc, 0x738e, 0x52ab, 0x8451,
+	0xd38f, 0x6b8e, 0xbe59, 0xa5d8, 0x10a3, 0x4aab, 0xdbb0, 0x41a5, 0x8bce, 0x8b6c, 0x28e3, 0x5105,
+	0xa555, 0xf71a, 0xd3b0, 0xd533, 0xc6dc, 0x6986, 0x62a9, 0x4a28, 0xd6fb, 0x8cd4, 0x838d, 0xddb4,
+	0x39c6, 0x61e8, 0x4185, 0x8b8d, 0x61a7, 0x7a09, 0xf34f, 0xd7bf, 0x428a, 0xa514, 0xd6ba, 0x69a7,
+	0xe5d5, 0x6b6e, 0x41e7, 0xba6b, 0x9c70, 0x9514, 0x39e7, 0xde37, 0x834c, 0x18c2, 0x61c8, 0x5a27,
+	0xdd94,
+};
+
+static const uint8_t falsePositiveData[] = {
+	0xec, 0x00, 0x00, 0x02, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x54, 0x8f, 0x00, 0x07, 0x02, 0x00, 0x54, 0x00, 0x57, 0x00, 0x4c, 0x97, 0x00, 0x00, 0x05,
+	0x01, 0x4e, 0x00, 0x77, 0x00, 0x21, 0x00, 0x51, 0x00, 0xfe, 0x00, 0x2a, 0x83, 0x00, 0x11, 0x02, 0x00, 0xed, 0x01, 0x3d, 0x00, 0x8c, 0x86, 0x00,
+	0x20, 0x05, 0x00, 0x8c, 0x00, 0x98, 0x01, 0x0b, 0x00, 0x21, 0x00, 0x77, 0x00, 0x8b, 0x94, 0x00, 0x00, 0x04, 0x00, 0x33, 0x00, 0x05, 0x01, 0x37,
+	0x00, 0x78, 0x00, 0x22, 0x83, 0x00, 0x09, 0x81, 0x00, 0x4b, 0x01, 0x00, 0x09, 0x01, 0x04, 0x87, 0x00, 0x17, 0x81, 0x00, 0x12, 0x04, 0x00, 0x40,
+	0x00, 0x64, 0x00, 0x6b, 0x00, 0x05, 0x00, 0x33, 0x92, 0x00, 0x00, 0x0d, 0x00, 0x7d, 0x00, 0x05, 0x00, 0x5a, 0x00, 0x23, 0x00, 0x09, 0x01, 0x4a,
+	0x01, 0x53, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x18, 0x00, 0xcf, 0x88, 0x00, 0x19, 0x06, 0x00, 0x61, 0x00, 0x90,
+	0x00, 0x12, 0x00, 0x27, 0x00, 0xe7, 0x00, 0x05, 0x00, 0x7d, 0x90, 0x00, 0x00, 0x07, 0x00, 0x39, 0x00, 0x59, 0x00, 0x11, 0x00, 0x22, 0x00, 0x23,
+	0x01, 0x17, 0x00, 0x6d, 0x00, 0x28, 0x83, 0x00, 0x0b, 0x05, 0x00, 0x41, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x41, 0x00, 0x0b, 0x00, 0x41, 0x85, 0x00,
+	0x0b, 0x07, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x4e, 0x00, 0x27, 0x00, 0x1b, 0x01, 0x45, 0x00, 0x59, 0x00, 0x39, 0x8f, 0x00, 0x00, 0x07, 0x00, 0x2d,
+	0x00, 0x74, 0x00, 0xe2, 0x00, 0x24, 0x00, 0xdc, 0x00, 0x05, 0x00, 0x75, 0x00, 0xab, 0x84, 0x00, 0x0f, 0x00, 0x01, 0x2e, 0x89, 0x00, 0x13, 0x07,
+	0x00, 0xf6, 0x00, 0x70, 0x00, 0x05, 0x01, 0x0f, 0x00, 0x1b, 0x00, 0x8f, 0x00, 0x4d, 0x00, 0x2d, 0x8e, 0x00, 0x00, 0x0e, 0x00, 0x25, 0x00, 0x34,
+	0x00, 0xa2, 0x00, 0x09, 0x00, 0x78, 0x00, 0x16, 0x00, 0x60, 0x00, 0x1a, 0x00, 0x0d, 0x00, 0x10, 0x00, 0x15, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x10,
+	0x00, 0x1a, 0x89, 0x00, 0x04, 0x81, 0x00, 0x00, 0x06, 0x01, 0x2d, 0x00, 0x16, 0x00, 0x64, 0x00, 0x17, 0x00, 0x5d, 0x00, 0x34, 0x00, 0x25, 0x8d,
+	0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0x23, 0x00, 0xe5, 0x00, 0xd9, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x08, 0x82, 0x00, 0x0c,
+	0x05, 0x00, 0x08, 0x00, 0x0c, 0x01, 0x20, 0x00, 0x03, 0x00, 0x72, 0x00, 0x5c, 0x86, 0x00, 0x03, 0x08, 0x00, 0x5c, 0x00, 0x03, 0x00, 0x03, 0x00,
+	0xca, 0x00, 0x5e, 0x00, 0x27, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x07, 0x8c, 0x00, 0x00, 0x08, 0x00, 0x3f, 0x00, 0x8a, 0x00, 0x7b, 0x00, 0x09, 0x00,
+	0x1e, 0x00, 0x05, 0x00, 0xdf, 0x00, 0x0d, 0x00, 0x08, 0x85, 0x00, 0x02, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x87, 0x00, 0x01,
+	0x08, 0x00, 0x03, 0x00, 0x04, 0x00, 0x6c, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x17, 0x00, 0x62, 0x00, 0x2e, 0x00, 0x3f, 0x8a, 0x00, 0x00, 0x07, 0x00,
+	0x30, 0x00, 0x26, 0x00, 0xa4, 0x00, 0x24, 0x00, 0x35, 0x00, 0x44, 0x00, 0xe4, 0x00, 0x15, 0x85, 0x00, 0x02, 0x08, 0x00, 0x0c, 0x00, 0x02, 0x00,
+	0x04, 0x01, 0x38, 0x00, 0xb4, 0x00, 0xfd, 0x00, 0x72, 0x00, 0x1a, 0x00, 0x03, 0x86, 0x00, 0x01, 0x07, 0x00, 0x04, 0x00, 0xc6, 0x00, 0x2f, 0x00,
+	0x7a, 0x00, 0x1b, 0x00, 0xc3, 0x00, 0x26, 0x00, 0x30, 0x89, 0x00, 0x00, 0x08, 0x00, 0x8d, 0x00, 0xd4, 0x00, 0x81, 0x00, 0x09, 0x00, 0xc9, 0x00,
+	0x86, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x08, 0x83, 0x00, 0x02, 0x0a, 0x00, 0x0c, 0x00, 0x37, 0x00, 0x15, 0x01, 0x08, 0x00, 0x47, 0x00, 0x38, 0x00,
+	0x2e, 0x00, 0xfa, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x84, 0x00, 0x01, 0x08, 0x00, 0x03, 0x00, 0x04, 0x00, 0x13, 0x00, 0xca, 0x01, 0x2c, 0x00,
+	0x1b, 0x01, 0x1d, 0x00, 0x2b, 0x00, 0x29, 0x88, 0x00, 0x00, 0x08, 0x00, 0x52, 0x00, 0x3e, 0x00, 0x5a, 0x00, 0x09, 0x00, 0xa5, 0x00, 0x05, 0x00,
+	0xd3, 0x00, 0x0d, 0x00, 0x08, 0x83, 0x00, 0x02, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x45, 0x00, 0x79, 0x00,
+	0xf1, 0x00, 0x47, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x01, 0x08, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x01, 0x0e, 0x00, 0x27, 0x00,
+	0x1b, 0x00, 0x97, 0x00, 0x3e, 0x00, 0x52, 0x87, 0x00, 0x00, 0x08, 0x00, 0x2d, 0x00, 0x51, 0x00, 0x35, 0x00, 0x22, 0x00, 0x55, 0x00, 0xb0, 0x00,
+	0x6f, 0x00, 0x02, 0x00, 0x08, 0x82, 0x00, 0x02, 0x0c, 0x00, 0x08, 0x00, 0x10, 0x01, 0x16, 0x00, 0xf5, 0x00, 0x3a, 0x00, 0x49, 0x00, 0x71, 0x00,
+	0x32, 0x00, 0x92, 0x00, 0x05, 0x00, 0x63, 0x00, 0x3a, 0x00, 0x80, 0x86, 0x00, 0x01, 0x07, 0x00, 0x03, 0x00, 0x04, 0x00, 0x29, 0x01, 0x00, 0x00,
+	0x27, 0x00, 0xec, 0x00, 0x7c, 0x00, 0x2d, 0x86, 0x00, 0x00, 0x08, 0x00, 0x25, 0x00, 0x05, 0x00, 0x9f, 0x00, 0x09, 0x00, 0x84, 0x00, 0x05, 0x00,
+	0xb6, 0x00, 0x0d, 0x00, 0x08, 0x82, 0x00, 0x02, 0x10, 0x00, 0x08, 0x00, 0x10, 0x00, 0x6f, 0x01, 0x30, 0x00, 0x4d, 0x00, 0x45, 0x00, 0x05, 0x00,
+	0x71, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x05, 0x00, 0xba, 0x01, 0x33, 0x00, 0x05, 0x00, 0x6c, 0x00, 0x04, 0x00, 0x03, 0x83, 0x00, 0x01, 0x08, 0x00,
+	0x03, 0x00, 0x04, 0x01, 0x55, 0x00, 0x05, 0x00, 0x61, 0x00, 0x12, 0x00, 0xb2, 0x00, 0x16, 0x00, 0x25, 0x84, 0x00, 0x00, 0x07, 0x00, 0x4a, 0x00,
+	0x31, 0x00, 0xe0, 0x00, 0xd1, 0x00, 0x83, 0x00, 0x96, 0x00, 0xc8, 0x00, 0x0c, 0x83, 0x00, 0x02, 0x81, 0x00, 0x10, 0x0f, 0x00, 0xf9, 0x01, 0x41,
+	0x00, 0x28, 0x01, 0x3b, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x46, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x05, 0x00, 0x87, 0x00, 0x1f, 0x00, 0xba, 0x00, 0x88,
+	0x00, 0x04, 0x00, 0x03, 0x85, 0x00, 0x01, 0x07, 0x00, 0x03, 0x01, 0x22, 0x00, 0xda, 0x00, 0x5f, 0x00, 0x9a, 0x00, 0xd7, 0x00, 0x31, 0x00, 0x4a,
+	0x83, 0x00, 0x00, 0x1d, 0x00, 0xb1, 0x00, 0x2e, 0x00, 0xa3, 0x00, 0x09, 0x00, 0x73, 0x00, 0x16, 0x00, 0xb3, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x02,
+	0x00, 0x02, 0x00, 0x10, 0x01, 0x28, 0x00, 0x85, 0x01, 0x23, 0x00, 0x21, 0x00, 0x0b, 0x00, 0x43, 0x00, 0x06, 0x00, 0x38, 0x01, 0x3e, 0x00, 0xc7,
+	0x01, 0x24, 0x00, 0x05, 0x00, 0x82, 0x00, 0x14, 0x00, 0x4f, 0x01, 0x31, 0x00, 0x6a, 0x00, 0x03, 0x84, 0x00, 0x01, 0x08, 0x00, 0x03, 0x00, 0x04,
+	0x00, 0x9e, 0x00, 0x16, 0x00, 0x4e, 0x00, 0x12, 0x00, 0xcd, 0x00, 0x2e, 0x00, 0xc1, 0x82, 0x00, 0x00, 0x1e, 0x00, 0x39, 0x00, 0x26, 0x01, 0x48,
+	0x00, 0x22, 0x00, 0x35, 0x00, 0x2f, 0x01, 0x11, 0x00, 0x15, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x02, 0x00, 0x08, 0x00, 0x1a, 0x00, 0x9c, 0x00, 0x05,
+	0x01, 0x58, 0x00, 0x56, 0x00, 0x28, 0x00, 0x43, 0x00, 0xa8, 0x00, 0x38, 0x00, 0x46, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x05, 0x00, 0x82, 0x00, 0x14,
+	0x00, 0x4f, 0x00, 0x70, 0x00, 0x00, 0x00, 0x04, 0x85, 0x00, 0x01, 0x2b, 0x00, 0x03, 0x00, 0x04, 0x01, 0x2a, 0x00, 0x8a, 0x00, 0x89, 0x00, 0x1b,
+	0x00, 0x20, 0x00, 0x26, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x44, 0x00, 0xd6, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x49, 0x00, 0xdd,
+	0x00, 0x15, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x10, 0x00, 0xb9, 0x01, 0x0c, 0x00, 0x79, 0x00, 0x69, 0x00, 0x2b, 0x00, 0x43,
+	0x00, 0x14, 0x00, 0x38, 0x00, 0x46, 0x00, 0xc7, 0x00, 0x3d, 0x00, 0x05, 0x00, 0x67, 0x00, 0x14, 0x00, 0x4f, 0x00, 0xb4, 0x00, 0x7f, 0x00, 0xa9,
+	0x00, 0x01, 0x00, 0x04, 0x83, 0x00, 0x01, 0x12, 0x00, 0x03, 0x00, 0x04, 0x00, 0xbe, 0x00, 0x49, 0x00, 0x8c, 0x00, 0x12, 0x00, 0x7a, 0x00, 0x6d,
+	0x00, 0x29, 0x00, 0x00, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xaa, 0x00, 0x09, 0x00, 0xb8, 0x00, 0x2b, 0x00, 0xd2, 0x00, 0x0d, 0x00, 0x08, 0x84, 0x00,
+	0x02, 0x14, 0x00, 0xdb, 0x00, 0x53, 0x00, 0x14, 0x00, 0x69, 0x00, 0x3c, 0x00, 0x43, 0x00, 0xa8, 0x00, 0x38, 0x00, 0x46, 0x00, 0x32, 0x00, 0x3d,
+	0x00, 0x05, 0x00, 0x67, 0x00, 0x14, 0x00, 0x45, 0x00, 0x28, 0x00, 0x0b, 0x00, 0x28, 0x00, 0x59, 0x00, 0x93, 0x00, 0x6a, 0x83, 0x00, 0x01, 0x0f,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x05, 0x00, 0xbb, 0x00, 0x12, 0x00, 0x99, 0x00, 0x63, 0x00, 0x30, 0x00, 0xaf, 0x00, 0xbf, 0x00, 0x94,
+	0x00, 0x23, 0x00, 0x55, 0x00, 0x68, 0x00, 0x91, 0x84, 0x00, 0x02, 0x17, 0x00, 0x0c, 0x00, 0x02, 0x00, 0xdb, 0x00, 0x53, 0x00, 0x2c, 0x00, 0x69,
+	0x00, 0x47, 0x00, 0x43, 0x00, 0x06, 0x00, 0x21, 0x00, 0x66, 0x01, 0x1c, 0x01, 0x03, 0x00, 0x05, 0x00, 0x82, 0x00, 0x14, 0x00, 0x45, 0x00, 0x47,
+	0x00, 0xb7, 0x01, 0x54, 0x00, 0x05, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x01, 0x40, 0x00, 0x03, 0x00, 0x01, 0x00, 0xcc, 0x00, 0x9d,
+	0x00, 0x42, 0x00, 0x40, 0x01, 0x19, 0x00, 0x74, 0x00, 0x33, 0x00, 0xcb, 0x00, 0x6b, 0x00, 0x24, 0x00, 0x81, 0x00, 0x05, 0x00, 0xbc, 0x00, 0x0d,
+	0x00, 0x08, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x02, 0x00, 0xb9, 0x00, 0x53, 0x00, 0x06, 0x01, 0x0a, 0x01, 0x47,
+	0x01, 0x01, 0x00, 0x36, 0x00, 0xf0, 0x00, 0xc4, 0x00, 0x1c, 0x00, 0x87, 0x01, 0x34, 0x00, 0xe6, 0x00, 0x0e, 0x00, 0xeb, 0x01, 0x3f, 0x00, 0x1f,
+	0x00, 0x32, 0x01, 0x18, 0x01, 0x26, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80,
+	0x00, 0x05, 0x00, 0x76, 0x00, 0x12, 0x00, 0x42, 0x00, 0x31, 0x00, 0x34, 0x00, 0x2a, 0x00, 0xb5, 0x00, 0x95, 0x00, 0xc2, 0x00, 0xde, 0x00, 0x0d,
+	0x00, 0x08, 0x83, 0x00, 0x02, 0x15, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x5b, 0x01, 0x07, 0x00, 0x0e, 0x00, 0xae, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x0a,
+	0x00, 0x1f, 0x00, 0xa1, 0x00, 0x06, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x14, 0x01, 0x44, 0x00, 0x50, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x66,
+	0x00, 0x48, 0x85, 0x00, 0x01, 0x0f, 0x00, 0x03, 0x00, 0x04, 0x00, 0x7f, 0x00, 0x16, 0x00, 0xc0, 0x00, 0xad, 0x00, 0x58, 0x00, 0xff, 0x00, 0x34,
+	0x00, 0x2a, 0x00, 0xb5, 0x00, 0x95, 0x00, 0xc2, 0x00, 0xde, 0x00, 0x0d, 0x00, 0x08, 0x83, 0x00, 0x02, 0x09, 0x00, 0x0c, 0x00, 0x10, 0x00, 0xa9,
+	0x01, 0x43, 0x00, 0x3b, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0e, 0x82, 0x00, 0x06, 0x0a, 0x00, 0x0e, 0x00, 0x2c, 0x00, 0xc4,
+	0x00, 0x47, 0x00, 0x46, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x50, 0x00, 0x48, 0x00, 0x01, 0x00, 0x03, 0x83, 0x00, 0x01, 0x10, 0x00, 0x03, 0x00, 0x04,
+	0x00, 0x7f, 0x00, 0x16, 0x00, 0xc0, 0x00, 0xad, 0x00, 0x58, 0x01, 0x56, 0x00, 0xcb, 0x00, 0x6b, 0x00, 0x24, 0x00, 0x81, 0x00, 0x05, 0x00, 0xbc,
+	0x00, 0x0d, 0x00, 0x08, 0x00, 0x0c, 0x83, 0x00, 0x02, 0x03, 0x01, 0x4b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x1d, 0x83, 0x00, 0x0a, 0x00, 0x00, 0x0e,
+	0x82, 0x00, 0x06, 0x08, 0x00, 0x1f, 0x01, 0x1b, 0x00, 0x05, 0x00, 0x45, 0x00, 0xce, 0x00, 0x06, 0x00, 0x1f, 0x00, 0x50, 0x00, 0x48, 0x84, 0x00,
+	0x01, 0x81, 0x00, 0x03, 0x0d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x76, 0x00, 0x12, 0x00, 0x42, 0x00, 0x31, 0x00, 0xaf, 0x00, 0xbf, 0x00,
+	0x94, 0x00, 0x23, 0x00, 0x55, 0x00, 0x68, 0x00, 0x91, 0x84, 0x00, 0x02, 0x04, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x60, 0x00, 0xea, 0x00, 0x36, 0x83,
+	0x00, 0x0a, 0x0e, 0x00, 0x36, 0x00, 0x06, 0x00, 0x06, 0x00, 0x14, 0x00, 0xfc, 0x00, 0x3c, 0x01, 0x52, 0x01, 0x39, 0x00, 0x2c, 0x00, 0x0e, 0x00,
+	0x1c, 0x00, 0x50, 0x00, 0x48, 0x00, 0x01, 0x00, 0x03, 0x82, 0x00, 0x01, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x00, 0xcc, 0x00, 0x68, 0x00, 0x42, 0x00,
+	0x40, 0x00, 0x76, 0x00, 0xac, 0x00, 0x33, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xaa, 0x00, 0x09, 0x00, 0xb8, 0x00, 0x2b, 0x00, 0xd2, 0x00, 0x0d, 0x00,
+	0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x02, 0x00, 0xa6, 0x01, 0x5b, 0x00, 0x0e, 0x00, 0x1d, 0x82, 0x00, 0x0a, 0x0c, 0x00,
+	0x3b, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0xe1, 0x00, 0x05, 0x00, 0x67, 0x00, 0x2c, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x1c, 0x00, 0x66, 0x00,
+	0x48, 0x84, 0x00, 0x01, 0x1a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x16, 0x00, 0xbb, 0x00, 0x12, 0x00, 0x99, 0x00, 0x63, 0x00, 0x30, 0x00,
+	0x00, 0x00, 0x29, 0x00, 0x44, 0x00, 0xd6, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x49, 0x00, 0xdd, 0x00, 0x15, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x10, 0x00, 0x5b, 0x00, 0x53, 0x00, 0x0e, 0x00, 0x1d, 0x82, 0x00, 0x0a, 0x06, 0x00, 0xae, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x79, 0x00,
+	0x71, 0x00, 0x28, 0x00, 0x2c, 0x82, 0x00, 0x06, 0x22, 0x00, 0x1c, 0x00, 0xf7, 0x00, 0x5b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00,
+	0x03, 0x00, 0x04, 0x00, 0xbe, 0x00, 0x49, 0x00, 0x58, 0x00, 0x12, 0x00, 0x7a, 0x00, 0x6d, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00,
+	0x26, 0x01, 0x1e, 0x00, 0x22, 0x00, 0x35, 0x00, 0x2f, 0x01, 0x4c, 0x00, 0x15, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x02, 0x00, 0x08, 0x00, 0x1a, 0x00,
+	0x3a, 0x01, 0x46, 0x00, 0x06, 0x00, 0x1d, 0x83, 0x00, 0x0a, 0x18, 0x00, 0x0e, 0x00, 0x06, 0x00, 0xa1, 0x00, 0x92, 0x00, 0xb7, 0x00, 0x14, 0x00,
+	0x06, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x4f, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x01,
+	0x02, 0x00, 0x2f, 0x00, 0x89, 0x00, 0x1b, 0x00, 0x20, 0x00, 0x26, 0x00, 0x6e, 0x82, 0x00, 0x00, 0x0e, 0x00, 0xb1, 0x00, 0x2e, 0x00, 0xa3, 0x00,
+	0x09, 0x00, 0x73, 0x00, 0x16, 0x00, 0xb3, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x02, 0x00, 0x08, 0x00, 0x1a, 0x01, 0x10, 0x00, 0x3c, 0x01, 0x1a, 0x83,
+	0x00, 0x0a, 0x05, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x06, 0x00, 0x06, 0x00, 0x14, 0x00, 0x2c, 0x83, 0x00, 0x06, 0x0e, 0x00, 0xe6, 0x00, 0x3c, 0x00,
+	0x8e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x9e, 0x00, 0x16, 0x00, 0x4e, 0x00, 0x12, 0x00, 0xcd, 0x00, 0x2e, 0x00,
+	0xc1, 0x83, 0x00, 0x00, 0x10, 0x00, 0x4a, 0x00, 0x31, 0x00, 0xe0, 0x00, 0xd1, 0x00, 0x83, 0x00, 0x96, 0x00, 0xc8, 0x00, 0x0c, 0x00, 0x02, 0x00,
+	0x02, 0x00, 0x0c, 0x00, 0x0d, 0x01, 0x2f, 0x00, 0x05, 0x01, 0x09, 0x00, 0x06, 0x01, 0x25, 0x82, 0x00, 0x0a, 0x00, 0x00, 0x3b, 0x85, 0x00, 0x06,
+	0x10, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0xe1, 0x00, 0x05, 0x00, 0xf3, 0x00, 0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x5b, 0x00,
+	0xda, 0x00, 0x5f, 0x00, 0x9a, 0x00, 0xd7, 0x00, 0x31, 0x00, 0x4a, 0x84, 0x00, 0x00, 0x10, 0x00, 0x25, 0x00, 0x05, 0x00, 0x9f, 0x00, 0x09, 0x00,
+	0x84, 0x00, 0x05, 0x00, 0xb6, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x10, 0x00, 0xef, 0x00, 0x3c, 0x01, 0x50, 0x00, 0x36, 0x00,
+	0x1d, 0x82, 0x00, 0x0a, 0x00, 0x00, 0x0e, 0x83, 0x00, 0x06, 0x10, 0x00, 0x0e, 0x00, 0x1f, 0x01, 0x57, 0x00, 0x65, 0x00, 0x7e, 0x00, 0x04, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x21, 0x00, 0x05, 0x00, 0x61, 0x00, 0x12, 0x00, 0xb2, 0x00, 0x16, 0x00, 0x25, 0x86, 0x00, 0x00,
+	0x27, 0x00, 0x2d, 0x00, 0x51, 0x00, 0x35, 0x00, 0x22, 0x00, 0x55, 0x00, 0xb0, 0x00, 0x6f, 0x00, 0x02, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+	0xbd, 0x00, 0x0b, 0x00, 0xf8, 0x00, 0xf4, 0x00, 0x06, 0x00, 0x3b, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x3b, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x06, 0x00,
+	0x2c, 0x00, 0xfb, 0x00, 0x87, 0x01, 0x15, 0x00, 0x21, 0x01, 0x40, 0x00, 0x6a, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x93, 0x00, 0xa7, 0x00,
+	0x42, 0x00, 0x1b, 0x01, 0x13, 0x00, 0x7c, 0x00, 0x2d, 0x87, 0x00, 0x00, 0x27, 0x00, 0x52, 0x00, 0x3e, 0x00, 0x5a, 0x00, 0x09, 0x00, 0xa5, 0x00,
+	0x05, 0x00, 0xd3, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x02, 0x00, 0x08, 0x00, 0x0d, 0x01, 0x06, 0x00, 0xa7, 0x00, 0xac, 0x01, 0x35, 0x01, 0x5c, 0x00,
+	0x36, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x1f, 0x00, 0x1c, 0x00, 0x14, 0x00, 0xce, 0x01, 0x42, 0x00, 0x65, 0x00, 0x9d, 0x00, 0x13, 0x00, 0x04, 0x00,
+	0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x05, 0x01, 0x32, 0x00, 0x12, 0x00, 0x97, 0x00, 0x3e, 0x00, 0x52, 0x88, 0x00, 0x00,
+	0x11, 0x00, 0x8d, 0x00, 0xd4, 0x00, 0xf2, 0x00, 0x09, 0x00, 0xc9, 0x00, 0x86, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x02, 0x00, 0x08, 0x00,
+	0x0d, 0x01, 0x3c, 0x00, 0x75, 0x00, 0x05, 0x00, 0x2b, 0x00, 0x4d, 0x01, 0x36, 0x82, 0x00, 0x56, 0x10, 0x01, 0x59, 0x00, 0x65, 0x00, 0x05, 0x00,
+	0x88, 0x00, 0xa0, 0x00, 0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x13, 0x00, 0x86, 0x01, 0x49, 0x00, 0x12, 0x01, 0x3a, 0x00,
+	0x2b, 0x00, 0x29, 0x89, 0x00, 0x00, 0x07, 0x00, 0x30, 0x00, 0x26, 0x00, 0xa4, 0x00, 0x24, 0x00, 0x35, 0x00, 0x44, 0x00, 0xe4, 0x00, 0x10, 0x82,
+	0x00, 0x02, 0x0f, 0x00, 0x08, 0x00, 0x10, 0x00, 0x0d, 0x00, 0xbd, 0x01, 0x0d, 0x00, 0x9c, 0x00, 0x85, 0x00, 0xc6, 0x00, 0x7e, 0x00, 0x85, 0x00,
+	0x88, 0x01, 0x2b, 0x01, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x82, 0x00, 0x01, 0x07, 0x00, 0x04, 0x00, 0x7e, 0x00, 0x44, 0x00, 0x89, 0x00,
+	0x1b, 0x00, 0xc3, 0x00, 0x26, 0x00, 0x30, 0x8a, 0x00, 0x00, 0x0e, 0x00, 0x3f, 0x00, 0x8a, 0x00, 0x7b, 0x00, 0x09, 0x00, 0x1e, 0x00, 0x05, 0x00,
+	0xdf, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x10, 0x00, 0x0d, 0x83, 0x00, 0x1a, 0x10, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x01, 0x27, 0x00, 0x05, 0x00, 0x5d, 0x00,
+	0x17, 0x00, 0x62, 0x00, 0x2e, 0x00, 0x3f, 0x8c, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0xd8, 0x00, 0xe3, 0x00, 0x23, 0x00, 0xe5, 0x00, 0xa6, 0x00,
+	0xc5, 0x00, 0x02, 0x00, 0x08, 0x82, 0x00, 0x0c, 0x01, 0x00, 0x08, 0x00, 0xc5, 0x84, 0x00, 0x37, 0x01, 0x00, 0x72, 0x00, 0x5c, 0x83, 0x00, 0x03,
+	0x08, 0x00, 0x5c, 0x00, 0x03, 0x00, 0x03, 0x00, 0xd9, 0x00, 0x5e, 0x00, 0x27, 0x00, 0x5f, 0x00, 0x5e, 0x00, 0x07, 0x8d, 0x00, 0x00, 0x0b, 0x00,
+	0x25, 0x00, 0x34, 0x00, 0xa2, 0x00, 0x09, 0x00, 0x78, 0x00, 0x16, 0x00, 0x60, 0x00, 0x1a, 0x00, 0x0d, 0x00, 0x10, 0x00, 0x15, 0x00, 0x0d, 0x85,
+	0x00, 0x15, 0x01, 0x00, 0x10, 0x00, 0x0d, 0x84, 0x00, 0x04, 0x81, 0x00, 0x00, 0x06, 0x01, 0x51, 0x00, 0x16, 0x00, 0x64, 0x00, 0x17, 0x00, 0x5d,
+	0x00, 0x34, 0x00, 0x25, 0x8e, 0x00, 0x00, 0x07, 0x00, 0x2d, 0x00, 0x74, 0x00, 0xe2, 0x00, 0x24, 0x00, 0xdc, 0x00, 0x05, 0x00, 0x75, 0x00, 0xab,
+	0x8a, 0x00, 0x0f, 0x00, 0x00, 0xe8, 0x83, 0x00, 0x13, 0x07, 0x00, 0x6c, 0x00, 0x70, 0x00, 0x05, 0x00, 0xe7, 0x00, 0x1b, 0x00, 0x8f, 0x00, 0x4d,
+	0x01, 0x4d, 0x8f, 0x00, 0x00, 0x07, 0x00, 0x39, 0x00, 0x59, 0x00, 0x11, 0x00, 0x22, 0x00, 0x23, 0x00, 0x73, 0x00, 0x2f, 0x00, 0x28, 0x8a, 0x00,
+	0x0b, 0x0c, 0x00, 0x41, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x41, 0x00, 0x0b, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x4e, 0x00, 0x27, 0x00, 0x40, 0x01, 0x5a,
+	0x00, 0x3e, 0x00, 0x39, 0x90, 0x00, 0x00, 0x08, 0x00, 0x7d, 0x00, 0x05, 0x00, 0x5a, 0x00, 0x23, 0x00, 0x09, 0x00, 0x83, 0x00, 0x84, 0x00, 0x1e,
+	0x00, 0x1e, 0x87, 0x00, 0x18, 0x0c, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x1e, 0x00, 0xcf, 0x00, 0x19, 0x00, 0x19, 0x00, 0x61, 0x00, 0x90, 0x00, 0x12,
+	0x00, 0x27, 0x00, 0xe9, 0x00, 0x05, 0x00, 0x3f, 0x92, 0x00, 0x00, 0x04, 0x00, 0x33, 0x00, 0x05, 0x01, 0x14, 0x00, 0x7b, 0x00, 0x22, 0x8a, 0x00,
+	0x09, 0x81, 0x00, 0x4b, 0x09, 0x00, 0x09, 0x00, 0xee, 0x00, 0x12, 0x00, 0x17, 0x00, 0x12, 0x00, 0x40, 0x00, 0x62, 0x01, 0x12, 0x00, 0x16, 0x00,
+	0x33, 0x94, 0x00, 0x00, 0x05, 0x00, 0x8b, 0x00, 0x77, 0x00, 0x21, 0x00, 0x51, 0x01, 0x1f, 0x00, 0x2a, 0x8b, 0x00, 0x11, 0x07, 0x00, 0x2a, 0x01,
+	0x4f, 0x00, 0x58, 0x00, 0x98, 0x00, 0x7c, 0x00, 0x21, 0x01, 0x29, 0x00, 0x8b, 0x97, 0x00, 0x00, 0x02, 0x00, 0x4c, 0x00, 0x57, 0x00, 0x54, 0x8f,
+	0x00, 0x07, 0x02, 0x00, 0x54, 0x00, 0x57, 0x00, 0x4c, 0xec, 0x00, 0x00,
+};
+
+const iconAsset falsePositive = { 48, 48, falsePositivePalette, nullptr, falsePositiveData, true, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t categoriseEventsPalette[] = {
+	0xffff, 0x0000, 0xf7be, 0xf79e, 0xffdf, 0xcebb, 0xcedb, 0x4a49, 0x4a69, 0xdedb, 0xef7d, 0x0861,
+	0xd6fc, 0x9cd3, 0x2965, 0x2945, 0xd6ba, 0xe75d, 0x0020, 0xff40, 0x7bcf, 0x39e7, 0x10a2, 0xd6db,
+	0xbdf7, 0xe71c, 0x52aa, 0xdefb, 0x8410, 0x73ae, 0x738e, 0xef5d, 0x94f4, 0xdf3d, 0x18e3, 0x39c7,
+	0x6b6d, 0x1082, 0x4208, 0xa534, 0x5acb, 0xf6a0, 0xce79, 0xd69a, 0x632c, 0xfea0, 0x2104, 0x9c40,
+	0x5240, 0x0840, 0xa514, 0xff20, 0x2124, 0x7bef, 0x0841, 0xc638, 0xe640, 0x8430, 0x94d3, 0x3186,
+	0x3160, 0xe73c, 0xdf1c, 0x630c, 0xd71c, 0xce9a, 0x6b4d, 0xce59, 0x94f3, 0x31a6, 0x9d14, 0x18c3,
+	0xbdd7, 0x94b2, 0xc618, 0x9cf3, 0xac21, 0x0820, 0x94b3, 0x8c71, 0xff00, 0xad55, 0x528a, 0x5220,
+	0x632d, 0x9d35, 0x4228, 0x6b8e, 0x3980, 0xad75, 0xac20, 0xeea0, 0xfea1, 0xac00, 0x31c7, 0x31a7,
+	0xb5b6, 0x39e8, 0x5aeb, 0x52cb, 0x0862, 0x3a08, 0x39a0, 0x1081, 0xfec0, 0xee40, 0xe77e, 0x2986,
+	0xbe39, 0xf6c0, 0xef9f, 0xee60, 0xa576, 0x9492, 0x1060, 0x8c92, 0x634d, 0x18a2, 0xb596, 0xac23,
+	0xa535, 0x4180, 0xc67a, 0x6865, 0xc10b, 0xad96, 0xd8cc, 0xef7e, 0x0882, 0xff36, 0xc4a0, 0x41e0,
+	0xee94, 0x2125, 0xc5f7, 0xfec2, 0x7b4a, 0xacae, 0x60a5, 0xbe38, 0xa48e, 0x31e8, 0x8c51, 0x9149,
+	0x83a0, 0xff81, 0x734a, 0x4a20, 0xf0ec, 0x30e4, 0x60c7, 0x88e9, 0xbe18, 0x2022, 0x52ab, 0xac24,
+	0xdefc, 0xc571, 0x1001, 0xff77, 0x10a1, 0x68a6, 0xf79d, 0x5b0c, 0x1822, 0xa441, 0xf660, 0x1061,
+	0x3843, 0xff97, 0x3164, 0x8471, 0xff57, 0x8431, 0xc659, 0x7ae3, 0xf7bf, 0x2144, 0x5a40, 0xa460,
+	0xe92c, 0x73cf, 0xff16, 0xeeb5, 0xb5b7, 0x1862, 0x2940, 0x5a60, 0xf7df, 0x0021, 0x3209, 0xff60,
+	0x7329, 0xfef6, 0x6b09, 0x20e2, 0xc8eb, 0x73ef, 0x1904, 0xa440, 0x0041, 0x2103, 0xa555, 0x9c20,
+	0x8472, 0xff80, 0xac03, 0x62a0, 0xdf1d, 0x5a80, 0xd5c0, 0x914a, 0x1080, 0x6ae9, 0x630b, 0x1801,
+	0x4a8a, 0xd0cc, 0xac25, 0xd699, 0xe620, 0xff41,
+};
+
+static const uint8_t categoriseEventsData[] = {
+	0x85, 0x00, 0x02, 0x2a, 0x24, 0x02, 0x84, 0x00, 0x02, 0x4a, 0x1d, 0x04, 0x84, 0x00, 0x01, 0x18, 0x42, 0x85, 0x00, 0x01, 0x48, 0x1c, 0x95, 0x00,
+	0x02, 0x48, 0x23, 0x0a, 0x84, 0x00, 0x02, 0x59, 0x56, 0x03, 0x84, 0x00, 0x01, 0x59, 0x12, 0x85, 0x00, 0x02, 0x27, 0x28, 0x02, 0x94, 0x00, 0x02,
+	0x18, 0x23, 0x0a, 0x84, 0x00, 0x02, 0x59, 0x07, 0x03, 0x84, 0x00, 0x01, 0x76, 0x12, 0x85, 0x00, 0x02, 0x51, 0x28, 0x04, 0x90, 0x00, 0x06, 0x10,
+	0x27, 0x0d, 0x0d, 0x24, 0x2e, 0x4f, 0x82, 0x0d, 0x04, 0x49, 0x4b, 0x2c, 0x0f, 0x4f, 0x84, 0x0d, 0x02, 0x2c, 0x01, 0x49, 0x84, 0x0d, 0x06, 0x3f,
+	0x45, 0x71, 0x0d, 0x4b, 0x18, 0x03, 0x8a, 0x00, 0x25, 0x02, 0x27, 0x01, 0x16, 0x0e, 0x0e, 0x16, 0x01, 0x34, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x25,
+	0x01, 0x0f, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x16, 0x01, 0x0e, 0x0f, 0x0e, 0x0e, 0x0f, 0x0e, 0x25, 0x12, 0x0f, 0x0e, 0xc6, 0x01, 0x3f, 0x3d, 0x89,
+	0x00, 0x19, 0x60, 0x01, 0x42, 0x10, 0x1b, 0x0a, 0x2c, 0x0b, 0x48, 0x0a, 0x1b, 0x19, 0x1b, 0x03, 0x1a, 0x25, 0x18, 0x1f, 0x1b, 0x19, 0x19, 0x0a,
+	0x28, 0x01, 0x10, 0x1f, 0x82, 0x19, 0x09, 0x1f, 0x08, 0x16, 0x43, 0x1f, 0x41, 0x3a, 0x16, 0x14, 0x04, 0x88, 0x00, 0x26, 0x28, 0x45, 0x1f, 0x00,
+	0x00, 0x4f, 0x12, 0x01, 0x0f, 0x09, 0x00, 0x02, 0x00, 0x8e, 0x01, 0x01, 0x45, 0x1b, 0x00, 0x02, 0x00, 0x35, 0x12, 0x01, 0x23, 0x19, 0x04, 0x02,
+	0x00, 0x1d, 0x01, 0x01, 0x15, 0x1f, 0xbc, 0x6a, 0xc5, 0x01, 0x3d, 0x88, 0x00, 0x26, 0x16, 0x52, 0x04, 0x02, 0x10, 0x47, 0x22, 0x62, 0x01, 0x2c,
+	0x00, 0x04, 0x10, 0x36, 0x0f, 0x62, 0x01, 0x14, 0x04, 0x02, 0x09, 0x01, 0x0e, 0x3f, 0x01, 0x14, 0x00, 0x02, 0x4a, 0x12, 0x3b, 0x1a, 0x01, 0x1c,
+	0x00, 0x21, 0x20, 0x0b, 0x09, 0x88, 0x00, 0x26, 0x0b, 0x08, 0x04, 0x04, 0x2b, 0x25, 0x0e, 0x14, 0x01, 0x28, 0x00, 0x04, 0x10, 0x01, 0x15, 0x14,
+	0x01, 0x24, 0x04, 0x04, 0x2b, 0x01, 0x15, 0x35, 0x01, 0x1e, 0x00, 0x04, 0x18, 0x01, 0x26, 0x1e, 0x01, 0x1d, 0x00, 0x21, 0x44, 0x0b, 0x09, 0x88,
+	0x00, 0x26, 0x0b, 0x08, 0x00, 0x03, 0x04, 0x24, 0x01, 0x01, 0x25, 0x4a, 0x04, 0x03, 0x02, 0x42, 0x01, 0x01, 0x47, 0x37, 0x00, 0x03, 0x02, 0x28,
+	0x01, 0x01, 0x2e, 0x37, 0x00, 0x03, 0x02, 0x1a, 0x01, 0x01, 0x2e, 0x2b, 0x02, 0x11, 0x44, 0x01, 0x09, 0x88, 0x00, 0x26, 0x01, 0x08, 0x00, 0x03,
+	0x02, 0x02, 0x32, 0x35, 0x43, 0x04, 0x02, 0x03, 0x04, 0x03, 0x4b, 0x35, 0x2a, 0x00, 0x03, 0x03, 0x04, 0x03, 0x0d, 0x1c, 0x2a, 0x00, 0x03, 0x02,
+	0x04, 0x0a, 0x49, 0x1c, 0x10, 0x04, 0x03, 0x11, 0x20, 0x01, 0x09, 0x88, 0x00, 0x05, 0x01, 0x52, 0x00, 0x03, 0x04, 0x04, 0x82, 0x00, 0x04, 0x04,
+	0x02, 0x02, 0x04, 0x04, 0x82, 0x00, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x82, 0x00, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x82, 0x00, 0x05, 0x04,
+	0x02, 0x11, 0x46, 0x01, 0x09, 0x88, 0x00, 0x26, 0x12, 0x01, 0x32, 0x00, 0x08, 0x01, 0x32, 0x04, 0x26, 0x01, 0x32, 0x00, 0x23, 0x01, 0x51, 0x03,
+	0x15, 0x01, 0x76, 0x04, 0x45, 0x01, 0x51, 0x04, 0x0f, 0x01, 0x18, 0x0a, 0x3b, 0x01, 0x48, 0x0a, 0x0f, 0x01, 0x18, 0x9c, 0x0f, 0x01, 0x10, 0x82,
+	0x00, 0x01, 0x03, 0x02, 0x83, 0x00, 0x2c, 0x12, 0x22, 0x18, 0x04, 0x39, 0x1a, 0x18, 0x04, 0x1c, 0x1a, 0x18, 0x04, 0x14, 0x1a, 0x37, 0x02, 0x35,
+	0x1a, 0x43, 0x02, 0x14, 0x1a, 0x37, 0x04, 0x1e, 0x28, 0x2a, 0x03, 0x1d, 0x1a, 0x2a, 0x03, 0x1e, 0x28, 0x2a, 0x3e, 0xd8, 0x01, 0x1b, 0x00, 0x00,
+	0x2a, 0x07, 0x42, 0x1b, 0x82, 0x00, 0x03, 0x01, 0x1a, 0x00, 0x03, 0x82, 0x00, 0x00, 0x02, 0x82, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x02, 0x82,
+	0x00, 0x00, 0x02, 0x82, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x11, 0x55, 0x01, 0x27, 0x1b, 0x37,
+	0x16, 0x99, 0xa4, 0x26, 0x09, 0x00, 0x00, 0x01, 0x08, 0x00, 0x83, 0x03, 0x00, 0x02, 0x83, 0x03, 0x07, 0x0a, 0x02, 0x03, 0x03, 0x0a, 0x0a, 0x03,
+	0x02, 0x82, 0x03, 0x00, 0x02, 0x82, 0x03, 0x00, 0x02, 0x82, 0x03, 0x00, 0x02, 0x82, 0x03, 0x11, 0x11, 0x3a, 0x01, 0x01, 0x2e, 0x01, 0xa8, 0x7c,
+	0xd3, 0x9e, 0x26, 0x09, 0x00, 0x01, 0x08, 0x00, 0x03, 0x03, 0x84, 0x02, 0x03, 0x03, 0x04, 0x04, 0x3d, 0x83, 0x00, 0x00, 0x04, 0x82, 0x02, 0x85,
+	0x03, 0x83, 0x02, 0x13, 0x03, 0x02, 0x0a, 0x3e, 0x57, 0x01, 0x07, 0x15, 0x0b, 0x8a, 0x94, 0x7e, 0x8f, 0xd7, 0x07, 0x19, 0x01, 0x08, 0x00, 0x03,
+	0x84, 0x02, 0x0d, 0x03, 0x04, 0x43, 0x26, 0xc9, 0x0e, 0x08, 0x1d, 0x4b, 0x37, 0x1f, 0x02, 0x04, 0x04, 0x82, 0x00, 0x03, 0x04, 0x02, 0x03, 0x0a,
+	0x83, 0x03, 0x11, 0x0a, 0x06, 0x5e, 0x01, 0x1c, 0x27, 0x23, 0x01, 0xa1, 0xb4, 0xd9, 0x97, 0xb9, 0x1a, 0x01, 0x08, 0x00, 0x03, 0x83, 0x02, 0x81,
+	0x03, 0x06, 0x04, 0x15, 0x01, 0x5f, 0x22, 0x0b, 0xbd, 0x82, 0x01, 0x07, 0x47, 0x56, 0x1e, 0x4b, 0x4a, 0x2b, 0x19, 0x03, 0x83, 0x00, 0x13, 0x04,
+	0x02, 0x21, 0x54, 0x01, 0x01, 0x64, 0x1c, 0x27, 0x23, 0x01, 0x7b, 0xc4, 0x96, 0x01, 0x71, 0x01, 0x08, 0x00, 0x03, 0x83, 0x02, 0x0d, 0x03, 0x00,
+	0x37, 0x36, 0x63, 0x6e, 0x0c, 0x6c, 0xca, 0xcc, 0x57, 0x9a, 0x5e, 0x22, 0x83, 0x01, 0x19, 0x2e, 0x26, 0x2c, 0x39, 0x32, 0x18, 0x17, 0x0c, 0x54,
+	0x01, 0xb2, 0x5a, 0x72, 0x25, 0x1c, 0x27, 0x45, 0x0b, 0x95, 0x01, 0x39, 0x04, 0x01, 0x08, 0x00, 0x03, 0x83, 0x02, 0x13, 0x03, 0x00, 0x32, 0x01,
+	0x73, 0x17, 0x05, 0x17, 0x0c, 0x21, 0x11, 0x21, 0x05, 0x6c, 0xb8, 0x55, 0xab, 0x54, 0x61, 0x47, 0x82, 0x01, 0x14, 0x36, 0x2e, 0xb1, 0x01, 0x30,
+	0x29, 0x33, 0x5d, 0x01, 0x36, 0x1c, 0x27, 0x26, 0x0b, 0x1e, 0x02, 0x00, 0x01, 0x08, 0x00, 0x03, 0x83, 0x02, 0x05, 0x03, 0x00, 0x14, 0x01, 0x98,
+	0x0c, 0x83, 0x05, 0x21, 0x41, 0x05, 0x06, 0x0c, 0x0c, 0x3e, 0x40, 0x0c, 0x17, 0x05, 0x7a, 0x7d, 0x73, 0x74, 0x31, 0x01, 0x30, 0x29, 0x13, 0x38,
+	0x58, 0x4d, 0x4d, 0x0b, 0x1c, 0x51, 0x3b, 0x08, 0x1f, 0x00, 0x01, 0x08, 0x00, 0x03, 0x82, 0x02, 0x0b, 0x03, 0x02, 0x1f, 0x23, 0x22, 0x05, 0x17,
+	0x05, 0x06, 0x05, 0x05, 0x06, 0x86, 0x05, 0x19, 0x06, 0x17, 0x17, 0x0c, 0x21, 0x1d, 0x01, 0x30, 0x6d, 0x13, 0x38, 0x3c, 0x01, 0xa5, 0x82, 0xd4,
+	0x22, 0x3f, 0x22, 0x24, 0x02, 0x00, 0x01, 0x08, 0x00, 0x03, 0x82, 0x02, 0x07, 0x03, 0x00, 0x10, 0x12, 0xa3, 0x0c, 0x05, 0x05, 0x88, 0x06, 0x1b,
+	0x05, 0x06, 0x05, 0x41, 0x06, 0x0c, 0x74, 0x01, 0x30, 0x29, 0x50, 0x29, 0xba, 0x01, 0x2f, 0x33, 0x87, 0xaf, 0x01, 0x01, 0x3f, 0x3d, 0x00, 0x00,
+	0x01, 0x08, 0x00, 0x03, 0x82, 0x02, 0x07, 0x03, 0x00, 0x0d, 0x01, 0x3a, 0x21, 0x05, 0x05, 0x86, 0x06, 0x81, 0x05, 0x14, 0x06, 0x05, 0x05, 0x3e,
+	0x17, 0x2c, 0x01, 0x30, 0x29, 0x33, 0xcd, 0x68, 0x83, 0x2f, 0xdd, 0x5c, 0xce, 0x72, 0x1e, 0x18, 0x0a, 0x82, 0x00, 0x03, 0x01, 0x08, 0x00, 0x03,
+	0x82, 0x02, 0x06, 0x03, 0x00, 0x3b, 0x47, 0x8b, 0x0c, 0x05, 0x84, 0x06, 0x81, 0x05, 0x15, 0x06, 0x05, 0x05, 0x06, 0x40, 0x0c, 0x4e, 0x65, 0x01,
+	0x53, 0x5b, 0x13, 0xdc, 0x90, 0x6f, 0x91, 0x33, 0x2d, 0x9b, 0x31, 0x24, 0x0a, 0x84, 0x00, 0x0e, 0x01, 0x08, 0x00, 0x03, 0x02, 0x02, 0x03, 0x04,
+	0x2a, 0x01, 0x63, 0x21, 0x41, 0x05, 0x05, 0x82, 0x06, 0x01, 0x05, 0x06, 0x82, 0x05, 0x12, 0x40, 0x17, 0x20, 0x5f, 0x12, 0x01, 0x30, 0x29, 0x13,
+	0x38, 0x3c, 0x01, 0xd2, 0x50, 0x5c, 0xda, 0x31, 0x1d, 0x0a, 0x85, 0x00, 0x0e, 0x01, 0x08, 0x00, 0x03, 0x03, 0x02, 0x03, 0x00, 0x2c, 0x01, 0x78,
+	0x40, 0x05, 0x06, 0x06, 0x85, 0x05, 0x03, 0x21, 0x05, 0x46, 0x23, 0x82, 0x01, 0x0c, 0x30, 0x29, 0x13, 0x69, 0x58, 0x01, 0xb3, 0x50, 0x5c, 0x77,
+	0x31, 0x24, 0x0a, 0x86, 0x00, 0x0a, 0x01, 0x08, 0x00, 0x03, 0x02, 0x03, 0x04, 0x09, 0x16, 0x0e, 0x0c, 0x83, 0x05, 0x18, 0x06, 0x05, 0x05, 0x06,
+	0x0c, 0x0c, 0x3a, 0x15, 0x01, 0x25, 0x67, 0x01, 0x53, 0x5b, 0x13, 0x38, 0x3c, 0x01, 0x2f, 0x13, 0x68, 0x77, 0xa0, 0x1d, 0x0a, 0x87, 0x00, 0x0d,
+	0x01, 0x08, 0x00, 0x03, 0x02, 0x03, 0x00, 0x1c, 0x01, 0x3a, 0x0c, 0x05, 0x06, 0x06, 0x82, 0x05, 0x15, 0x40, 0x17, 0x55, 0x3b, 0x01, 0x12, 0x14,
+	0xd6, 0x01, 0x30, 0x29, 0x13, 0x38, 0x3c, 0x01, 0x2f, 0x13, 0x2d, 0x5a, 0x22, 0x01, 0x10, 0x88, 0x00, 0x0a, 0x01, 0x08, 0x00, 0x03, 0x03, 0x04,
+	0x1b, 0x75, 0x0e, 0x05, 0x06, 0x83, 0x05, 0x17, 0xd0, 0x05, 0x46, 0x15, 0x01, 0x25, 0x24, 0x19, 0x39, 0x01, 0x53, 0x29, 0x13, 0x69, 0x66, 0x01,
+	0x2f, 0x33, 0x2d, 0x5d, 0x01, 0x34, 0x0b, 0x09, 0x88, 0x00, 0x26, 0x01, 0x08, 0x00, 0x03, 0x03, 0x00, 0x24, 0x01, 0x4e, 0x40, 0x05, 0x05, 0x06,
+	0x0c, 0x0c, 0x4e, 0x15, 0x01, 0x0b, 0x1d, 0x10, 0x00, 0x14, 0x01, 0x93, 0x5b, 0x13, 0x38, 0x3c, 0x01, 0x2f, 0x33, 0x2d, 0x4c, 0x4d, 0x0f, 0x35,
+	0x01, 0x09, 0x88, 0x00, 0x26, 0x01, 0x08, 0x00, 0x0a, 0x00, 0x4a, 0x01, 0x15, 0x17, 0x41, 0x05, 0x3e, 0x06, 0x46, 0x6b, 0x01, 0x31, 0x14, 0x09,
+	0x00, 0x00, 0x39, 0x01, 0xbb, 0x6d, 0x13, 0x38, 0x3c, 0x01, 0x2f, 0x33, 0x2d, 0x4c, 0x01, 0x34, 0xae, 0x78, 0x01, 0x09, 0x88, 0x00, 0x26, 0x01,
+	0x08, 0x04, 0x02, 0x03, 0x23, 0x12, 0x70, 0x0c, 0x3e, 0x06, 0x20, 0x5e, 0x01, 0x16, 0x1e, 0x1b, 0x00, 0x04, 0x03, 0x3d, 0x16, 0x01, 0xd1, 0x50,
+	0x6f, 0x58, 0x01, 0xc7, 0x13, 0x2d, 0x5d, 0x01, 0x2e, 0xdb, 0x6e, 0x3a, 0x01, 0x09, 0x88, 0x00, 0x26, 0x01, 0x08, 0x04, 0x00, 0x35, 0x01, 0x57,
+	0x11, 0x17, 0x4e, 0x23, 0x01, 0x0b, 0x1d, 0x10, 0x00, 0x04, 0x03, 0x03, 0x00, 0x49, 0x12, 0xaa, 0x01, 0x53, 0x66, 0x01, 0x2f, 0x13, 0x2d, 0x4c,
+	0x4d, 0x0f, 0x2b, 0x00, 0x21, 0x20, 0x01, 0x09, 0x88, 0x00, 0x26, 0x01, 0x07, 0x00, 0x60, 0x12, 0x61, 0x41, 0x46, 0x6b, 0x01, 0x12, 0x14, 0x09,
+	0x00, 0x00, 0x03, 0x02, 0x02, 0x03, 0x00, 0x5f, 0x67, 0x84, 0x92, 0x01, 0x01, 0xcb, 0xbf, 0x2d, 0x4c, 0x01, 0x34, 0x2b, 0x00, 0x0a, 0x11, 0x44,
+	0x01, 0x09, 0x88, 0x00, 0x26, 0x01, 0x28, 0x1b, 0x22, 0x36, 0xb5, 0x65, 0x01, 0x16, 0x1e, 0x1b, 0x00, 0x04, 0x03, 0x03, 0x02, 0x02, 0x03, 0x00,
+	0x86, 0xc8, 0xd5, 0xa9, 0xb6, 0xc0, 0x01, 0xcf, 0xa6, 0x5a, 0x01, 0x2e, 0x2b, 0x00, 0x0a, 0x03, 0x11, 0x20, 0x01, 0x09, 0x88, 0x00, 0x0c, 0x01,
+	0x15, 0x26, 0x01, 0x36, 0x01, 0x36, 0x14, 0x10, 0x00, 0x02, 0x03, 0x03, 0x82, 0x02, 0x81, 0x03, 0x14, 0x00, 0x1e, 0x01, 0x8c, 0x9f, 0xc1, 0xac,
+	0x88, 0x01, 0x79, 0x31, 0x85, 0x10, 0x00, 0x03, 0x02, 0x03, 0x11, 0x20, 0x01, 0x09, 0x88, 0x00, 0x83, 0x01, 0x05, 0x25, 0x1d, 0x09, 0x00, 0x00,
+	0x03, 0x85, 0x02, 0x16, 0x03, 0x04, 0x19, 0x34, 0x01, 0x75, 0x9d, 0x81, 0xb7, 0x89, 0x31, 0x01, 0x0f, 0x2b, 0x00, 0x03, 0x02, 0x03, 0x03, 0x11,
+	0x20, 0x01, 0x09, 0x88, 0x00, 0x81, 0x01, 0x06, 0x22, 0x1e, 0x09, 0x00, 0x04, 0x03, 0x03, 0x86, 0x02, 0x16, 0x03, 0x00, 0x27, 0x01, 0x8d, 0x64,
+	0xc3, 0xc2, 0xa7, 0x01, 0x34, 0x2c, 0x10, 0x00, 0x03, 0x02, 0x03, 0x02, 0x03, 0x11, 0x20, 0x01, 0x09, 0x88, 0x00, 0x06, 0x01, 0x3b, 0x10, 0x00,
+	0x02, 0x03, 0x03, 0x88, 0x02, 0x0d, 0x03, 0xb0, 0x08, 0x01, 0xbe, 0x80, 0x01, 0x01, 0x26, 0x49, 0x09, 0x00, 0x04, 0x03, 0x83, 0x02, 0x04, 0x03,
+	0x11, 0x20, 0x01, 0x09, 0x88, 0x00, 0x04, 0x0b, 0x1a, 0x00, 0x0a, 0x03, 0x8a, 0x02, 0x0b, 0x03, 0x04, 0x42, 0x01, 0x01, 0x16, 0x24, 0x43, 0xa2,
+	0x00, 0x04, 0x03, 0x85, 0x02, 0x04, 0x03, 0x11, 0x44, 0x01, 0x09, 0x88, 0x00, 0x04, 0x0b, 0x08, 0x04, 0x03, 0x03, 0x8a, 0x02, 0x0a, 0x03, 0x04,
+	0x3d, 0x39, 0x0d, 0x1f, 0x00, 0x00, 0x02, 0x03, 0x03, 0x86, 0x02, 0x04, 0x03, 0x11, 0x44, 0x0b, 0x09, 0x88, 0x00, 0x04, 0x0b, 0x52, 0x04, 0x0a,
+	0x03, 0x8b, 0x02, 0x04, 0x03, 0x02, 0x00, 0x00, 0x02, 0x82, 0x03, 0x86, 0x02, 0x82, 0x03, 0x03, 0x11, 0x20, 0x16, 0x09, 0x88, 0x00, 0x03, 0x07,
+	0x15, 0x03, 0x04, 0x8e, 0x03, 0x81, 0x0a, 0x8c, 0x03, 0x04, 0x7f, 0x6a, 0xad, 0x01, 0x19, 0x88, 0x00, 0x03, 0x32, 0x01, 0x1c, 0x03, 0x9d, 0x00,
+	0x04, 0x0a, 0x70, 0x34, 0x3f, 0x04, 0x88, 0x00, 0x04, 0x03, 0x39, 0x01, 0x15, 0x08, 0x9c, 0x07, 0x03, 0x56, 0x25, 0x0e, 0x09, 0x8b, 0x00, 0x03,
+	0x48, 0x52, 0x0b, 0x0b, 0x99, 0x01, 0x04, 0x0b, 0x01, 0x0f, 0x4f, 0x1f, 0x8a, 0x00,
+};
+
+const iconAsset categoriseEvents = { 48, 48, categoriseEventsPalette, nullptr, categoriseEventsData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t manualEntryPalette[] = {
+	0xffff, 0xf7be, 0x0000, 0xf79e, 0xffdf, 0xce59, 0xbdf7, 0x528a, 0x10a2, 0xc618, 0xad55, 0xef7d,
+	0xa600, 0x6b4d, 0xa620, 0xd6ba, 0xae40, 0x2104, 0x1082, 0xdefb, 0xa514, 0x5aeb, 0xce79, 0xe75d,
+	0xae60, 0xc638, 0xef5d, 0xdedb, 0xb5b6, 0xc67a, 0x18e3, 0x632c, 0x4228, 0xe73c, 0x2145, 0xd69a,
+	0x52aa, 0x0020, 0xad75, 0x39c7, 0xa534, 0x18c3, 0xbdd7, 0x0861, 0x4208, 0xa5e0, 0x738e, 0x2965,
+	0x5acb, 0x8c71, 0x39e7, 0xa601, 0x9cf3, 0x73ae, 0x0040, 0x4a69, 0x9de0, 0xf7df, 0x2945, 0x1900,
+	0xe71c, 0x3186, 0x630c, 0x7bef, 0x2120, 0x8410, 0x2125, 0x0862, 0x39c8, 0x0880, 0x52ab, 0xa640,
+	0x7bcf, 0x95a0, 0xe73d, 0x8d00, 0x84e0, 0x29c0, 0x84e4, 0x0841, 0x84c0, 0x8c92, 0x7c80, 0xb596,
+	0x7420, 0x2160, 0x3187, 0x5b40, 0x10a0, 0x5b44, 0xef7e, 0xb680, 0x7c10, 0x10c0, 0x84c1, 0xdf3d,
+	0x9dc0, 0x8d42, 0x10a1, 0x31e0, 0x5300, 0xdf1c, 0x2124, 0xcebb, 0x18e1, 0x9dc2, 0x73cf, 0x0021,
+	0x9582, 0x8500, 0x9de1, 0x3200, 0x0842, 0xb5d7, 0x8430, 0x1920, 0x4281, 0xae41, 0x6b6d, 0xa621,
+	0x3a23, 0x2980, 0x9dc1, 0x9cd3, 0x0822, 0x63a0, 0xd699, 0xce9a, 0x7bf0, 0xad54, 0xad96, 0x94d3,
+	0x1083, 0x0840, 0x2161, 0x9581, 0x6382, 0x7c61, 0x7460, 0x3a04, 0x31c1, 0x9540, 0xdeda, 0xef9e,
+	0x4ae2, 0x94b3, 0x528b, 0x7445, 0x5320, 0xbe18, 0xa5e2, 0x7461, 0xe75c, 0x4a49, 0x6c03, 0x9562,
+	0xae62, 0x10a3, 0x7441, 0x8d20, 0x9da0, 0x4280, 0x8471, 0xe77e, 0xb595, 0xc659, 0x7c60, 0x18c4,
+	0x0001, 0x9560, 0x94b2, 0x8d40, 0x4260, 0x2966, 0xce7a, 0xa5e1, 0x5b41, 0xa623, 0x1084, 0xd6fc,
+	0x2925, 0xae61, 0x3a03, 0x73ef, 0x1904, 0x7440, 0xa555, 0x29a0, 0xa513, 0x8504, 0x2103, 0x6c20,
+	0x7cc0, 0x6be0, 0xceba, 0x9543, 0xb5f7, 0x31a7, 0x9561, 0xb6a0, 0xae80, 0x1940, 0x0002, 0x9563,
+	0xa641,
+};
+
+static const uint8_t manualEntryData[] = {
+	0x85, 0x00, 0x01, 0x13, 0x19, 0x85, 0x00, 0x81, 0x23, 0x85, 0x00, 0x01, 0x19, 0x13, 0x85, 0x00, 0x01, 0x06, 0x1a, 0x95, 0x00, 0x02, 0x28, 0x0d,
+	0x01, 0x84, 0x00, 0x01, 0x3f, 0x35, 0x84, 0x00, 0x02, 0x01, 0x15, 0x0a, 0x84, 0x00, 0x02, 0x03, 0x02, 0x05, 0x95, 0x00, 0x02, 0x28, 0x1f, 0x04,
+	0x84, 0x00, 0x01, 0x3f, 0x2e, 0x84, 0x00, 0x02, 0x04, 0x15, 0x0a, 0x84, 0x00, 0x02, 0x03, 0x02, 0x16, 0x91, 0x00, 0x06, 0x01, 0x13, 0x0f, 0x1b,
+	0x72, 0x07, 0x16, 0x83, 0x0f, 0x03, 0x1b, 0x1f, 0x15, 0x1b, 0x83, 0x0f, 0x02, 0x16, 0x99, 0x31, 0x83, 0x0f, 0x07, 0x1b, 0x05, 0x02, 0x28, 0x13,
+	0x23, 0x3c, 0x04, 0x8c, 0x00, 0x01, 0x16, 0x07, 0x9f, 0x02, 0x01, 0x2e, 0x13, 0x8a, 0x00, 0x09, 0x16, 0x11, 0x27, 0x0a, 0x1c, 0x19, 0x20, 0x1e,
+	0x26, 0x06, 0x82, 0x1c, 0x18, 0x19, 0x3a, 0x11, 0x19, 0x1c, 0x2a, 0x1c, 0x06, 0x26, 0x29, 0x37, 0x09, 0x1c, 0x2a, 0x1c, 0x09, 0x28, 0x02, 0x0d,
+	0x19, 0x26, 0xa2, 0xb8, 0x37, 0x0b, 0x89, 0x00, 0x08, 0x2e, 0x11, 0x23, 0x00, 0x00, 0x06, 0x08, 0x02, 0x41, 0x83, 0x00, 0x03, 0x14, 0x02, 0x02,
+	0x28, 0x83, 0x00, 0x03, 0x41, 0x02, 0x29, 0x06, 0x82, 0x00, 0x09, 0x01, 0x1f, 0x02, 0x2f, 0x1b, 0x00, 0x8f, 0xba, 0x25, 0x2a, 0x89, 0x00, 0x25,
+	0x11, 0x07, 0x00, 0x01, 0x1b, 0x29, 0x29, 0x3d, 0x02, 0x14, 0x04, 0x04, 0x19, 0x02, 0x3a, 0x3a, 0x25, 0x09, 0x04, 0x04, 0x34, 0x02, 0x3d, 0x29,
+	0x29, 0x1b, 0x03, 0x04, 0x35, 0x02, 0x32, 0x2b, 0x2f, 0x01, 0x4a, 0x7f, 0x22, 0x14, 0x89, 0x00, 0x25, 0x02, 0x07, 0x00, 0x00, 0x06, 0x02, 0x24,
+	0x31, 0x02, 0x48, 0x00, 0x00, 0x26, 0x02, 0x3f, 0x41, 0x02, 0x26, 0x00, 0x00, 0x2e, 0x02, 0x31, 0x24, 0x25, 0x06, 0x00, 0x00, 0x07, 0x02, 0x0a,
+	0x27, 0x02, 0x01, 0x17, 0x1d, 0x2f, 0x14, 0x89, 0x00, 0x1c, 0x2b, 0x07, 0x00, 0x03, 0x1a, 0x2c, 0x02, 0x02, 0x4f, 0x19, 0x04, 0x04, 0x1b, 0x1e,
+	0x02, 0x02, 0x66, 0x0f, 0x04, 0x04, 0x09, 0x4f, 0x02, 0x02, 0x32, 0x0b, 0x03, 0x00, 0x34, 0x82, 0x02, 0x05, 0x15, 0x04, 0x17, 0x1d, 0x42, 0x14,
+	0x89, 0x00, 0x25, 0x02, 0x07, 0x00, 0x0b, 0x04, 0x0f, 0x0d, 0x24, 0x53, 0x04, 0x03, 0x03, 0x04, 0x19, 0x30, 0x30, 0x19, 0x00, 0x03, 0x03, 0x04,
+	0x26, 0x30, 0x0d, 0x0f, 0x04, 0x03, 0x03, 0x04, 0x7b, 0x24, 0x35, 0x1a, 0x04, 0x17, 0x1d, 0x22, 0x14, 0x89, 0x00, 0x04, 0x02, 0x24, 0x00, 0x03,
+	0x04, 0x83, 0x00, 0x81, 0x04, 0x01, 0x01, 0x04, 0x83, 0x00, 0x03, 0x04, 0x01, 0x04, 0x04, 0x83, 0x00, 0x03, 0x04, 0x01, 0x04, 0x04, 0x83, 0x00,
+	0x04, 0x04, 0x17, 0x67, 0x22, 0x14, 0x89, 0x00, 0x25, 0x02, 0x12, 0x2a, 0x04, 0x1f, 0x3d, 0x19, 0x1a, 0x24, 0x27, 0x23, 0x0b, 0x20, 0x2c, 0x1b,
+	0x13, 0x32, 0x20, 0x03, 0x16, 0x32, 0x24, 0x0b, 0x09, 0x3d, 0x0d, 0x01, 0x2a, 0x2f, 0x76, 0x04, 0x14, 0x2f, 0x41, 0x39, 0x5c, 0x25, 0x14, 0x89,
+	0x00, 0x25, 0x25, 0x08, 0x1c, 0x01, 0x3e, 0x27, 0x09, 0x1a, 0x24, 0x27, 0x05, 0x1a, 0x20, 0x2c, 0x1b, 0x13, 0x32, 0x2c, 0x0b, 0x05, 0x32, 0x24,
+	0x0b, 0x06, 0x27, 0x3e, 0x03, 0x1c, 0x27, 0x0d, 0x00, 0x34, 0x27, 0x48, 0x39, 0xb7, 0x4f, 0x14, 0x89, 0x00, 0x09, 0x02, 0x07, 0x00, 0x03, 0x01,
+	0x0b, 0x01, 0x01, 0x03, 0x0b, 0x85, 0x01, 0x82, 0x03, 0x05, 0x01, 0x0b, 0x03, 0x01, 0x01, 0x0b, 0x82, 0x01, 0x09, 0x1a, 0x01, 0x03, 0x01, 0x0b,
+	0x04, 0x17, 0x67, 0x66, 0x14, 0x89, 0x00, 0x07, 0x02, 0x07, 0x00, 0x03, 0x03, 0x01, 0x04, 0x04, 0x82, 0x00, 0x82, 0x01, 0x00, 0x04, 0x83, 0x00,
+	0x12, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x04, 0x01, 0x01, 0x17, 0x1d, 0x22, 0x14, 0x89, 0x00, 0x02, 0x02,
+	0x07, 0x00, 0x82, 0x03, 0x00, 0x23, 0x83, 0x05, 0x03, 0x21, 0x04, 0x0b, 0x16, 0x82, 0x05, 0x81, 0x16, 0x81, 0x05, 0x81, 0x16, 0x81, 0x05, 0x81,
+	0x16, 0x09, 0x05, 0x16, 0x05, 0x1b, 0x03, 0x01, 0x17, 0x1d, 0x42, 0x14, 0x89, 0x00, 0x06, 0x02, 0x07, 0x00, 0x0b, 0x00, 0x0a, 0x08, 0x82, 0x12,
+	0x05, 0x2b, 0x37, 0x00, 0x31, 0x12, 0x08, 0x8e, 0x12, 0x06, 0x1e, 0x23, 0x00, 0x4a, 0x1d, 0x22, 0x14, 0x89, 0x00, 0x0e, 0x02, 0x07, 0x00, 0x0b,
+	0x04, 0x0f, 0x2e, 0x1f, 0x0d, 0x0d, 0x1f, 0x34, 0x00, 0x09, 0x1f, 0x8e, 0x0d, 0x07, 0x1f, 0x48, 0x21, 0x04, 0x17, 0x1d, 0x22, 0x14, 0x89, 0x00,
+	0x05, 0x02, 0x07, 0x00, 0x03, 0x03, 0x04, 0x85, 0x00, 0x01, 0x03, 0x04, 0x91, 0x00, 0x81, 0x01, 0x03, 0x17, 0x1d, 0x22, 0x14, 0x89, 0x00, 0x05,
+	0x02, 0x07, 0x00, 0x03, 0x03, 0x04, 0x99, 0x00, 0x81, 0x01, 0x03, 0x17, 0x1d, 0x22, 0x14, 0x89, 0x00, 0x05, 0x02, 0x07, 0x00, 0x03, 0x01, 0x3c,
+	0x97, 0x0a, 0x07, 0x28, 0x26, 0x1a, 0x04, 0x17, 0x1d, 0x22, 0x14, 0x89, 0x00, 0x05, 0x02, 0x07, 0x00, 0x0b, 0x00, 0x14, 0x99, 0x02, 0x05, 0x16,
+	0x00, 0x4a, 0x1d, 0x22, 0x14, 0x89, 0x00, 0x06, 0x02, 0x07, 0x00, 0x03, 0x01, 0x1a, 0x19, 0x97, 0x09, 0x06, 0x05, 0x0b, 0x01, 0x21, 0xa5, 0x42,
+	0x34, 0x89, 0x00, 0x05, 0x02, 0x07, 0x00, 0x03, 0x03, 0x01, 0x99, 0x00, 0x05, 0x03, 0x00, 0x39, 0xb3, 0x3a, 0x28, 0x89, 0x00, 0x05, 0x02, 0x07,
+	0x00, 0x03, 0x03, 0x04, 0x89, 0x00, 0x8d, 0x03, 0x08, 0x01, 0x00, 0x04, 0x05, 0x91, 0x6a, 0x08, 0x72, 0x21, 0x88, 0x00, 0x07, 0x02, 0x07, 0x00,
+	0x03, 0x04, 0x19, 0x37, 0x2c, 0x85, 0x20, 0x03, 0x2c, 0x31, 0x00, 0x03, 0x88, 0x01, 0x81, 0x03, 0x0c, 0x00, 0x98, 0x31, 0xad, 0x43, 0x02, 0x2b,
+	0x02, 0x2b, 0x20, 0x2e, 0x2a, 0x01, 0x85, 0x00, 0x07, 0x02, 0x07, 0x00, 0x0b, 0x00, 0x53, 0x11, 0x29, 0x86, 0x1e, 0x02, 0x1f, 0x00, 0x03, 0x87,
+	0x01, 0x10, 0x03, 0x01, 0x39, 0x82, 0x3a, 0x02, 0x5d, 0xac, 0xbf, 0x50, 0x4c, 0x9e, 0x64, 0x55, 0x02, 0x30, 0x23, 0x84, 0x00, 0x07, 0x02, 0x07,
+	0x00, 0x03, 0x03, 0x04, 0x1a, 0x3c, 0x86, 0x21, 0x00, 0x01, 0x85, 0x03, 0x82, 0x01, 0x81, 0x03, 0x10, 0x5a, 0x51, 0x6b, 0x45, 0x7d, 0x2d, 0x5b,
+	0x10, 0x75, 0x10, 0xcc, 0x9c, 0xb1, 0x9a, 0x40, 0x02, 0x1c, 0x83, 0x00, 0x05, 0x02, 0x07, 0x00, 0x03, 0x01, 0x03, 0x88, 0x00, 0x86, 0x04, 0x0b,
+	0x01, 0x03, 0x01, 0x03, 0x5a, 0x83, 0x02, 0x40, 0xab, 0xc8, 0x0e, 0x2d, 0x82, 0x0e, 0x07, 0x10, 0x0c, 0x33, 0x18, 0x61, 0x78, 0x02, 0x2a, 0x82,
+	0x00, 0x07, 0x02, 0x07, 0x00, 0x03, 0x03, 0x01, 0x13, 0x1b, 0x8c, 0x13, 0x22, 0x1b, 0x0b, 0x01, 0x01, 0x0b, 0x95, 0x08, 0x58, 0xa9, 0x18, 0x38,
+	0x0c, 0x10, 0x9f, 0xa1, 0x6f, 0x52, 0x0e, 0x0c, 0x33, 0x0c, 0x9b, 0xb6, 0x11, 0x1b, 0x00, 0x00, 0x02, 0x07, 0x00, 0x0b, 0x00, 0x26, 0x11, 0x1e,
+	0x8c, 0x11, 0x22, 0x29, 0x0d, 0x01, 0x0b, 0x5f, 0x46, 0x02, 0xa6, 0x18, 0x38, 0x0c, 0x0e, 0xa0, 0x3b, 0x7c, 0xa7, 0x36, 0x4c, 0x47, 0x0c, 0x33,
+	0x6e, 0x4e, 0x68, 0x3f, 0x04, 0x00, 0x02, 0x07, 0x00, 0x0b, 0x04, 0x05, 0x3e, 0x30, 0x8c, 0x15, 0x21, 0x24, 0x7b, 0x01, 0x17, 0x71, 0x43, 0x4d,
+	0x18, 0x0c, 0x0c, 0x38, 0x18, 0x50, 0x02, 0xaa, 0x06, 0xa8, 0x57, 0x18, 0x0c, 0x0c, 0x38, 0x69, 0x59, 0x08, 0x0f, 0x00, 0x02, 0x07, 0x00, 0x03,
+	0x03, 0x04, 0x00, 0x8e, 0x04, 0x07, 0x00, 0x03, 0xa3, 0x80, 0x02, 0xb9, 0x10, 0x0c, 0x82, 0x10, 0x12, 0x52, 0x02, 0xa4, 0x8e, 0x70, 0x64, 0x0e,
+	0x0e, 0x18, 0x77, 0x60, 0x4e, 0x62, 0x28, 0x00, 0x02, 0x07, 0x00, 0x03, 0x92, 0x01, 0x1c, 0x0b, 0x65, 0x46, 0x02, 0x2d, 0x0e, 0x47, 0x4b, 0x6f,
+	0x55, 0x3b, 0x02, 0x0a, 0x7e, 0x25, 0x45, 0x55, 0x4d, 0x54, 0x10, 0x7a, 0xc3, 0x8c, 0x2e, 0x00, 0x02, 0x07, 0x00, 0x03, 0x92, 0x01, 0x1c, 0x1a,
+	0xc2, 0x44, 0x58, 0x0e, 0x0e, 0x2d, 0x40, 0xca, 0x56, 0x27, 0x2c, 0x23, 0x1a, 0x3e, 0xc5, 0x44, 0xb2, 0x36, 0x4b, 0x0c, 0x6c, 0x74, 0x2f, 0x00,
+	0x02, 0x07, 0x00, 0x03, 0x92, 0x01, 0x08, 0x17, 0x1d, 0x56, 0xc9, 0x0e, 0x10, 0x49, 0x02, 0x35, 0x82, 0x00, 0x81, 0x04, 0x82, 0x00, 0x0b, 0x81,
+	0x02, 0x7d, 0x10, 0x87, 0x90, 0x02, 0x04, 0x02, 0x07, 0x00, 0x03, 0x90, 0x01, 0x1e, 0x03, 0x01, 0x1a, 0x7f, 0x44, 0x5d, 0x0e, 0x0e, 0x2d, 0x3b,
+	0x9d, 0x07, 0x07, 0x30, 0x0f, 0x1a, 0x76, 0x07, 0x46, 0xb4, 0x25, 0x6d, 0x0c, 0xc6, 0x74, 0x11, 0x04, 0x02, 0x07, 0x00, 0x03, 0x92, 0x01, 0x1c,
+	0x0b, 0x65, 0x92, 0x02, 0x2d, 0x0e, 0x0e, 0x4b, 0xbb, 0x36, 0x25, 0x02, 0x0a, 0x23, 0x02, 0x02, 0x36, 0x3b, 0x54, 0x10, 0x7a, 0x61, 0x4d, 0x1f,
+	0x00, 0x02, 0x07, 0x00, 0x03, 0x92, 0x01, 0x1c, 0x0b, 0x17, 0x6a, 0x02, 0x8a, 0x10, 0x0c, 0x0e, 0x0e, 0xc7, 0x50, 0x25, 0x26, 0x0f, 0x43, 0x94,
+	0x5b, 0x10, 0x47, 0x77, 0x60, 0x4e, 0x62, 0x34, 0x00, 0x02, 0x07, 0x00, 0x03, 0x92, 0x01, 0x05, 0x03, 0x17, 0x71, 0x70, 0x63, 0x18, 0x82, 0x0c,
+	0x07, 0x18, 0xc0, 0x02, 0xbc, 0x7e, 0x02, 0x57, 0x10, 0x82, 0x0c, 0x08, 0x69, 0x59, 0x02, 0x0f, 0x00, 0x2b, 0x07, 0x00, 0x03, 0x91, 0x01, 0x1e,
+	0x03, 0x01, 0x0b, 0x5f, 0x07, 0x02, 0x52, 0x18, 0x2d, 0x0c, 0x0e, 0x49, 0x73, 0x7c, 0x84, 0x02, 0x4c, 0x10, 0x0c, 0x33, 0x6e, 0xbd, 0x68, 0x35,
+	0x04, 0x00, 0x02, 0x07, 0x00, 0x03, 0x03, 0x91, 0x01, 0x1c, 0x03, 0x01, 0x0b, 0xc4, 0x12, 0x3b, 0x49, 0x10, 0x0c, 0x0c, 0x10, 0x6d, 0x63, 0x79,
+	0x54, 0x0e, 0x33, 0x33, 0x0c, 0x6c, 0x8b, 0x08, 0x0f, 0x00, 0x00, 0x1e, 0x07, 0x00, 0x0b, 0x95, 0x03, 0x12, 0x17, 0x51, 0x02, 0x73, 0x8d, 0x18,
+	0x0e, 0x0c, 0x0e, 0x18, 0x18, 0x10, 0xaf, 0x0e, 0x0e, 0xcb, 0x78, 0x02, 0x1c, 0x82, 0x00, 0x04, 0x1f, 0x2f, 0x3c, 0x00, 0x04, 0x95, 0x00, 0x10,
+	0x39, 0x51, 0x6b, 0x45, 0xc1, 0x38, 0x10, 0x18, 0x10, 0x75, 0xb5, 0x18, 0x96, 0x93, 0x40, 0x02, 0x53, 0x83, 0x00, 0x03, 0x09, 0x02, 0x37, 0x06,
+	0x97, 0x05, 0x0e, 0xae, 0x5c, 0x08, 0x2b, 0x86, 0xb0, 0x97, 0x5e, 0x5e, 0x89, 0x88, 0x79, 0x02, 0x15, 0x19, 0x85, 0x00, 0x02, 0x06, 0x02, 0x02,
+	0x98, 0x08, 0x01, 0xbe, 0x2b, 0x83, 0x02, 0x06, 0x36, 0x85, 0x02, 0x02, 0x1f, 0x2a, 0x0b, 0x87, 0x00, 0x01, 0x03, 0x05, 0x9d, 0x06, 0x04, 0x05,
+	0x16, 0x19, 0x0f, 0x03, 0x88, 0x00,
+};
+
+const iconAsset manualEntry = { 48, 48, manualEntryPalette, nullptr, manualEntryData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t deleteLastLinePalette[] = {
+	0xffff, 0xf7be, 0x0000, 0xf79e, 0xffdf, 0x4a69, 0xc618, 0x9cf3, 0x0020, 0xdedb, 0xbdd7, 0x4a49,
+	0xef5d, 0x057f, 0x31a6, 0x049a, 0x8430, 0xe75d, 0x3186, 0x0861, 0x0041, 0x9cd3, 0xef7d, 0x2965,
+	0x2945, 0x8410, 0x05df, 0xbdf7, 0xe71c, 0x05bf, 0x528a, 0x051d, 0x52aa, 0x39e7, 0x04fc, 0x0189,
+	0x020c, 0xd6ba, 0x053e, 0x18c3, 0x059f, 0x10a2, 0x73ae, 0xce79, 0x0168, 0x5acb, 0x7bcf, 0xc638,
+	0x94f4, 0xdefb, 0x5aeb, 0x022c, 0x053d, 0x028e, 0x8c71, 0xe73c, 0x7bef, 0x2104, 0x0458, 0x1082,
+	0xb5b6, 0x6b4d, 0x18e3, 0xa534, 0xd69a, 0x0d1d, 0x632c, 0xa514, 0x026e, 0x0021, 0x0147, 0xb596,
+	0x94d3, 0x4208, 0xce59, 0xdf3d, 0x738e, 0x630c, 0x39c7, 0xad55, 0x0841, 0x6b6d, 0x00a4, 0x04dc,
+	0x01a9, 0x94f3, 0x0106, 0xef9e, 0x0042, 0xe77e, 0xdf1c, 0x08a3, 0xad75, 0x23d7, 0x94b2, 0x04ba,
+	0xdf5d, 0x4228, 0x8c51, 0x0d7f, 0x0062, 0x0479, 0x2924, 0x0148, 0x0c5a, 0x04db, 0x03d5, 0xf7bf,
+	0x0188, 0x9492, 0xd6fc, 0x0438, 0x0332, 0x020b, 0x3165, 0x01eb, 0x151d, 0x0cfd, 0x03b4, 0x7bf0,
+	0x1126, 0x0bf9, 0xef7e, 0x055e, 0x0373, 0x026d, 0x1af2, 0x02af, 0x9d55, 0x0820, 0xd6db, 0x0311,
+	0x0353, 0x0c7b, 0x9d14, 0x0906, 0x00e6, 0x8451, 0xdefc, 0x153d, 0x2b95, 0x0c9b, 0x3144, 0xb618,
+	0x1061, 0x0082, 0x00c4, 0x055f, 0x2124, 0xcebb, 0xc659, 0x0b54, 0x08e5, 0x1c5a, 0x1af1, 0x143a,
+	0x5aec, 0xef9f, 0x01aa, 0xd71c, 0x7c31, 0x4229, 0x73cf, 0x0d9f, 0x0a8f, 0x0352, 0x09cb, 0x13b7,
+	0x1167, 0x5aca, 0x0989, 0xf7df, 0x0063, 0x94d4, 0x3145, 0x149b, 0x73ef, 0x18c2, 0x1904, 0x0083,
+	0x1147, 0xadb7, 0x8c92, 0x020d, 0x051c, 0x0cfc, 0x2354, 0x0cbc, 0x0418, 0x18a2, 0x634d, 0x022d,
+	0x11ca, 0x0c19, 0xa535, 0x3986, 0xce9a,
+};
+
+static const uint8_t deleteLastLineData[] = {
+	0x85, 0x00, 0x02, 0x2b, 0x51, 0x01, 0x84, 0x00, 0x02, 0x06, 0x2a, 0x04, 0x84, 0x00, 0x01, 0x1b, 0x3d, 0x85, 0x00, 0x01, 0x0a, 0x19, 0x95, 0x00,
+	0x02, 0x0a, 0x4e, 0x16, 0x84, 0x00, 0x02, 0x5c, 0x61, 0x03, 0x84, 0x00, 0x01, 0x5c, 0x08, 0x85, 0x00, 0x02, 0x3f, 0x2d, 0x01, 0x94, 0x00, 0x02,
+	0x1b, 0x4e, 0x16, 0x84, 0x00, 0x02, 0x5c, 0x0b, 0x03, 0x84, 0x00, 0x01, 0x47, 0x08, 0x85, 0x00, 0x02, 0x4f, 0x2d, 0x04, 0x90, 0x00, 0x06, 0x25,
+	0x3f, 0x15, 0x15, 0x51, 0x39, 0x36, 0x82, 0x15, 0x04, 0x5e, 0x07, 0x42, 0x18, 0x36, 0x84, 0x15, 0x02, 0x42, 0x02, 0x5e, 0x84, 0x15, 0x06, 0x4d,
+	0x0e, 0x6d, 0x15, 0x07, 0x1b, 0x03, 0x8a, 0x00, 0x25, 0x01, 0x3f, 0x02, 0x29, 0x17, 0x17, 0x29, 0x02, 0x94, 0x17, 0x18, 0x17, 0x18, 0x17, 0x3b,
+	0x02, 0x18, 0x17, 0x18, 0x17, 0x18, 0x17, 0x29, 0x02, 0x17, 0x18, 0x17, 0x17, 0x18, 0x17, 0x3b, 0x08, 0x18, 0x17, 0xb2, 0x02, 0x4d, 0x37, 0x89,
+	0x00, 0x19, 0x3c, 0x02, 0x3d, 0x25, 0x31, 0x16, 0x42, 0x13, 0x0a, 0x16, 0x31, 0x1c, 0x31, 0x03, 0x20, 0x3b, 0x1b, 0x0c, 0x31, 0x1c, 0x1c, 0x16,
+	0x2d, 0x02, 0x25, 0x0c, 0x82, 0x1c, 0x09, 0x0c, 0x05, 0x29, 0x4a, 0x0c, 0xc4, 0x48, 0x29, 0x2e, 0x04, 0x88, 0x00, 0x26, 0x2d, 0x0e, 0x0c, 0x00,
+	0x00, 0x36, 0x08, 0x02, 0x18, 0x09, 0x00, 0x01, 0x00, 0x62, 0x02, 0x02, 0x0e, 0x31, 0x00, 0x01, 0x00, 0x38, 0x08, 0x02, 0x4e, 0x1c, 0x04, 0x01,
+	0x00, 0x2a, 0x02, 0x02, 0x21, 0x0c, 0xab, 0x59, 0xb0, 0x02, 0x37, 0x88, 0x00, 0x26, 0x29, 0x1e, 0x04, 0x01, 0x25, 0x27, 0x3e, 0x32, 0x02, 0x42,
+	0x00, 0x04, 0x25, 0x50, 0x18, 0x32, 0x02, 0x2e, 0x04, 0x01, 0x09, 0x02, 0x17, 0x4d, 0x02, 0x2e, 0x00, 0x01, 0x06, 0x08, 0x12, 0x20, 0x02, 0x19,
+	0x00, 0x4b, 0x30, 0x13, 0x09, 0x88, 0x00, 0x26, 0x13, 0x05, 0x04, 0x04, 0x40, 0x3b, 0x17, 0x2e, 0x02, 0x2d, 0x00, 0x04, 0x25, 0x02, 0x21, 0x2e,
+	0x02, 0x51, 0x04, 0x04, 0x40, 0x02, 0x21, 0x38, 0x02, 0x4c, 0x00, 0x04, 0x1b, 0x02, 0x49, 0x4c, 0x02, 0x2a, 0x00, 0x4b, 0x55, 0x13, 0x09, 0x88,
+	0x00, 0x26, 0x13, 0x05, 0x00, 0x03, 0x04, 0x51, 0x02, 0x02, 0x3b, 0x06, 0x04, 0x03, 0x01, 0x3d, 0x02, 0x02, 0x27, 0x2f, 0x00, 0x03, 0x01, 0x2d,
+	0x02, 0x02, 0x39, 0x2f, 0x00, 0x03, 0x01, 0x20, 0x02, 0x02, 0x39, 0x40, 0x01, 0x11, 0x55, 0x02, 0x09, 0x88, 0x00, 0x26, 0x02, 0x05, 0x00, 0x03,
+	0x01, 0x01, 0x43, 0x38, 0x4a, 0x04, 0x01, 0x03, 0x04, 0x03, 0x07, 0x38, 0x2b, 0x00, 0x03, 0x03, 0x04, 0x03, 0x15, 0x19, 0x2b, 0x00, 0x03, 0x01,
+	0x04, 0x16, 0x5e, 0x19, 0x25, 0x04, 0x03, 0x11, 0x30, 0x02, 0x09, 0x88, 0x00, 0x05, 0x02, 0x1e, 0x00, 0x03, 0x04, 0x04, 0x82, 0x00, 0x04, 0x04,
+	0x01, 0x01, 0x04, 0x04, 0x82, 0x00, 0x04, 0x04, 0x01, 0x01, 0x04, 0x04, 0x82, 0x00, 0x04, 0x04, 0x01, 0x01, 0x04, 0x04, 0x82, 0x00, 0x05, 0x04,
+	0x01, 0x11, 0x86, 0x02, 0x09, 0x88, 0x00, 0x26, 0x08, 0x02, 0x43, 0x00, 0x05, 0x02, 0x43, 0x04, 0x49, 0x02, 0x43, 0x00, 0x4e, 0x02, 0x4f, 0x03,
+	0x21, 0x02, 0x47, 0x04, 0x0e, 0x02, 0x4f, 0x04, 0x18, 0x02, 0x1b, 0x16, 0x12, 0x02, 0x0a, 0x16, 0x18, 0x02, 0x1b, 0x8a, 0x18, 0x02, 0x09, 0x88,
+	0x00, 0x26, 0x08, 0x3e, 0x1b, 0x04, 0x10, 0x20, 0x1b, 0x04, 0x19, 0x20, 0x1b, 0x04, 0x2e, 0x20, 0x2f, 0x01, 0x38, 0x20, 0x4a, 0x01, 0x2e, 0x20,
+	0x2f, 0x04, 0x4c, 0x2d, 0x2b, 0x03, 0x2a, 0x20, 0x2b, 0x03, 0x4c, 0x2d, 0x2b, 0x5a, 0x05, 0x02, 0x09, 0x88, 0x00, 0x26, 0x02, 0x20, 0x00, 0x03,
+	0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x01, 0x03,
+	0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x04, 0x11, 0xc2, 0x02, 0x09, 0x88, 0x00, 0x02, 0x02, 0x05, 0x00, 0x82, 0x03, 0x85, 0x00, 0x81, 0x03, 0x91,
+	0x00, 0x06, 0x01, 0x03, 0x03, 0x11, 0x48, 0x02, 0x09, 0x88, 0x00, 0x06, 0x02, 0x05, 0x00, 0x03, 0x01, 0x03, 0x06, 0x82, 0x0a, 0x04, 0x3c, 0x2b,
+	0x01, 0x16, 0x06, 0x8f, 0x0a, 0x07, 0x3c, 0x31, 0x01, 0x03, 0x11, 0x55, 0x02, 0x09, 0x88, 0x00, 0x10, 0x02, 0x05, 0x00, 0x03, 0x04, 0x3c, 0x3b,
+	0x08, 0x08, 0x50, 0x08, 0x27, 0x01, 0x47, 0x13, 0x08, 0x50, 0x8c, 0x08, 0x08, 0x50, 0x08, 0x32, 0x01, 0x03, 0x11, 0x30, 0x02, 0x09, 0x88, 0x00,
+	0x0f, 0x02, 0x05, 0x00, 0x03, 0x01, 0x37, 0x36, 0x19, 0x10, 0x10, 0x19, 0x07, 0x01, 0x1c, 0x36, 0x19, 0x8e, 0x10, 0x07, 0x19, 0x1b, 0x01, 0x03,
+	0x11, 0x30, 0x02, 0x09, 0x88, 0x00, 0x05, 0x02, 0x05, 0x00, 0x03, 0x03, 0x01, 0x85, 0x00, 0x01, 0x03, 0x01, 0x91, 0x00, 0x06, 0x04, 0x03, 0x03,
+	0x11, 0x30, 0x02, 0x09, 0x88, 0x00, 0x05, 0x02, 0x05, 0x00, 0x03, 0x03, 0x04, 0x99, 0x00, 0x06, 0x04, 0x01, 0x03, 0x11, 0x30, 0x02, 0x09, 0x88,
+	0x00, 0x07, 0x02, 0x05, 0x00, 0x03, 0x01, 0x37, 0x3f, 0x15, 0x97, 0x07, 0x06, 0x2f, 0x01, 0x03, 0x11, 0x30, 0x02, 0x09, 0x88, 0x00, 0x05, 0x02,
+	0x05, 0x00, 0x03, 0x04, 0x0a, 0x99, 0x02, 0x06, 0x1e, 0x04, 0x01, 0x59, 0x30, 0x02, 0x09, 0x88, 0x00, 0x06, 0x02, 0x05, 0x00, 0x03, 0x01, 0x16,
+	0x2f, 0x97, 0x06, 0x07, 0x1b, 0x1c, 0x01, 0x16, 0x4b, 0x48, 0x3e, 0x09, 0x88, 0x00, 0x05, 0x02, 0x05, 0x00, 0x03, 0x03, 0x01, 0x99, 0x00, 0x08,
+	0x4a, 0x0e, 0x02, 0x02, 0x13, 0x02, 0x02, 0x21, 0x06, 0x86, 0x00, 0x05, 0x02, 0x05, 0x00, 0x03, 0x03, 0x04, 0x89, 0x00, 0x8b, 0x03, 0x0d, 0x01,
+	0x03, 0x03, 0x01, 0x17, 0x13, 0x3d, 0x9c, 0x32, 0x62, 0x3c, 0x36, 0x02, 0x31, 0x85, 0x00, 0x06, 0x02, 0x05, 0x00, 0x03, 0x01, 0x25, 0x32, 0x86,
+	0x1e, 0x02, 0x05, 0x2a, 0x03, 0x87, 0x01, 0x10, 0x03, 0x04, 0x04, 0x03, 0x57, 0x6b, 0x25, 0x13, 0x32, 0x00, 0x5a, 0x6e, 0x57, 0x00, 0x0c, 0x0e,
+	0x0a, 0x85, 0x00, 0x07, 0x02, 0x05, 0x00, 0x03, 0x04, 0x1b, 0x39, 0x29, 0x85, 0x27, 0x04, 0x29, 0x21, 0x37, 0x01, 0x03, 0x85, 0x01, 0x10, 0x04,
+	0x31, 0x2e, 0xc3, 0x8e, 0x72, 0x66, 0x02, 0x90, 0x72, 0xae, 0x66, 0xa9, 0x19, 0x2a, 0x39, 0x32, 0x82, 0x19, 0x09, 0x07, 0x1c, 0x00, 0x02, 0x05,
+	0x00, 0x03, 0x03, 0x04, 0x1c, 0x87, 0x09, 0x03, 0x0c, 0x01, 0x03, 0x01, 0x83, 0x03, 0x0a, 0x01, 0x7a, 0x82, 0x21, 0x02, 0x88, 0x67, 0x46, 0x46,
+	0x2c, 0x2c, 0x82, 0x46, 0x03, 0x67, 0x2c, 0x2c, 0x6c, 0x82, 0x2c, 0x0a, 0x56, 0x14, 0x17, 0x1c, 0x02, 0x05, 0x00, 0x03, 0x01, 0x03, 0x04, 0x87,
+	0x00, 0x00, 0x04, 0x84, 0x01, 0x07, 0x04, 0x01, 0x03, 0x11, 0xb6, 0x02, 0x44, 0x34, 0x84, 0x1f, 0x04, 0x34, 0x41, 0x34, 0x41, 0x8b, 0x82, 0x41,
+	0x81, 0x74, 0x0b, 0x68, 0x7e, 0x64, 0x2a, 0x02, 0x05, 0x00, 0x03, 0x03, 0x04, 0x16, 0x37, 0x8d, 0x0c, 0x81, 0x03, 0x04, 0x60, 0xa2, 0x02, 0x3a,
+	0x1d, 0x8d, 0x0d, 0x0b, 0x63, 0xb9, 0x79, 0xa8, 0x3e, 0x02, 0x05, 0x00, 0x03, 0x04, 0x2f, 0x21, 0x8c, 0x12, 0x08, 0x0e, 0x12, 0x49, 0x40, 0x59,
+	0x2a, 0x02, 0x76, 0x5f, 0x8e, 0x0f, 0x0b, 0xbc, 0x97, 0xb4, 0x02, 0x02, 0x05, 0x00, 0x03, 0x04, 0x2b, 0x49, 0x12, 0x8c, 0x0e, 0x07, 0x12, 0x61,
+	0x25, 0x6b, 0x48, 0x02, 0x58, 0x91, 0x8d, 0x14, 0x82, 0x5b, 0x06, 0x02, 0x19, 0x02, 0x05, 0x00, 0x03, 0x03, 0x90, 0x04, 0x08, 0x00, 0x01, 0x01,
+	0x16, 0x89, 0xbd, 0x45, 0x73, 0x33, 0x82, 0x24, 0x81, 0x33, 0x81, 0x24, 0x81, 0x33, 0x0b, 0x24, 0x33, 0x71, 0xc0, 0x98, 0x3e, 0x3f, 0x01, 0x02,
+	0x05, 0x00, 0x03, 0x92, 0x01, 0x09, 0x03, 0x01, 0x16, 0x4b, 0x20, 0xac, 0x34, 0x1a, 0x1d, 0x1a, 0x82, 0x1d, 0x00, 0x1a, 0x83, 0x1d, 0x0a, 0x1a,
+	0x93, 0x99, 0x24, 0x05, 0x03, 0x00, 0x02, 0x05, 0x00, 0x03, 0x94, 0x01, 0x1a, 0x16, 0x6e, 0xbe, 0x02, 0x65, 0x0d, 0x34, 0x22, 0x1f, 0x26, 0x34,
+	0x22, 0x1f, 0x26, 0x26, 0x22, 0x34, 0x53, 0x5d, 0xaa, 0x3d, 0x03, 0x00, 0x02, 0x05, 0x00, 0x03, 0x94, 0x01, 0x1a, 0x57, 0x5a, 0xa0, 0x02, 0x3a,
+	0x28, 0x22, 0x92, 0x7f, 0x1d, 0xb8, 0xb3, 0x83, 0x1d, 0x5f, 0x52, 0x70, 0x75, 0x5d, 0x56, 0x38, 0x04, 0x00, 0x02, 0x05, 0x00, 0x03, 0x92, 0x01,
+	0x1c, 0x03, 0x01, 0x03, 0x11, 0xad, 0x02, 0x6a, 0x28, 0x65, 0x45, 0x71, 0x1a, 0x22, 0x02, 0x44, 0x1a, 0x6f, 0x02, 0x35, 0x53, 0x5d, 0x52, 0x6d,
+	0x00, 0x00, 0x02, 0x05, 0x00, 0x03, 0x93, 0x01, 0x81, 0x03, 0x19, 0x11, 0x80, 0x02, 0x70, 0x28, 0x0f, 0x14, 0x24, 0x1a, 0x22, 0x02, 0x35, 0x1d,
+	0x3a, 0x45, 0x35, 0xbb, 0x8c, 0x64, 0x07, 0x00, 0x00, 0x02, 0x05, 0x00, 0x03, 0x95, 0x01, 0x19, 0x11, 0xb5, 0x81, 0x44, 0x28, 0x0f, 0x14, 0x24,
+	0x1a, 0x22, 0x02, 0x35, 0x1a, 0x3a, 0x08, 0x35, 0xaf, 0xba, 0x13, 0x47, 0x00, 0x00, 0x02, 0x05, 0x00, 0x03, 0x95, 0x01, 0x19, 0x11, 0x8f, 0xb1,
+	0x9e, 0x28, 0x0f, 0x14, 0x24, 0x1a, 0x22, 0x02, 0x35, 0x1a, 0x3a, 0x45, 0x44, 0x8d, 0x9a, 0x02, 0x2f, 0x00, 0x00, 0x13, 0x05, 0x00, 0x03, 0x95,
+	0x01, 0x1a, 0x11, 0x96, 0x18, 0x56, 0x0d, 0x0f, 0x58, 0x33, 0x1a, 0x22, 0x02, 0x35, 0x1d, 0x3a, 0x45, 0x44, 0x85, 0xa4, 0x29, 0x40, 0x00, 0x00,
+	0x13, 0x05, 0x00, 0x03, 0x03, 0x94, 0x01, 0x1a, 0x11, 0x95, 0x21, 0x58, 0x0d, 0x0f, 0x02, 0x73, 0x1a, 0x22, 0x02, 0x7d, 0x1a, 0x6f, 0x02, 0xbf,
+	0x68, 0xb7, 0x0e, 0x1c, 0x00, 0x00, 0x13, 0x1e, 0x04, 0x16, 0x03, 0x92, 0x01, 0x1b, 0x03, 0x01, 0x11, 0x9f, 0x1e, 0x02, 0x26, 0x1f, 0x54, 0xa5,
+	0x28, 0x1f, 0x6c, 0x7c, 0x28, 0x69, 0x54, 0x84, 0x9b, 0xa6, 0x0b, 0x16, 0x00, 0x00, 0x0b, 0x21, 0x03, 0x04, 0x95, 0x03, 0x06, 0x0c, 0x60, 0x4d,
+	0x02, 0x69, 0x7b, 0x1f, 0x82, 0x26, 0x00, 0x1f, 0x82, 0x26, 0x0b, 0x1f, 0x53, 0xc1, 0x23, 0x20, 0x04, 0x00, 0x00, 0x43, 0x02, 0x19, 0x03, 0x95,
+	0x00, 0x05, 0x04, 0x9d, 0x77, 0x02, 0x6a, 0x28, 0x83, 0x0d, 0x08, 0x28, 0x0d, 0x0d, 0x63, 0xa3, 0x75, 0xa7, 0x87, 0x42, 0x82, 0x00, 0x04, 0x03,
+	0x10, 0x02, 0x21, 0x05, 0x95, 0x0b, 0x04, 0xa1, 0x18, 0x02, 0x52, 0x54, 0x88, 0x23, 0x03, 0x2c, 0x78, 0x02, 0x47, 0x84, 0x00, 0x03, 0x0a, 0x1e,
+	0x13, 0x13, 0xa0, 0x02, 0x82, 0x13, 0x01, 0x39, 0x4f, 0x83, 0x00,
+};
+
+const iconAsset deleteLastLine = { 48, 48, deleteLastLinePalette, nullptr, deleteLastLineData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
+
+static const uint16_t startScreenPalette[] = {
+	0xffff, 0x2bd8, 0x3a2a, 0x94f4, 0x634e, 0xd73e, 0xd71e, 0x8452, 0xe73d, 0xffdf, 0x859b, 0xbdf8,
+	0x4459, 0xc6dd, 0x9e1c, 0xf7df, 0xefbf, 0x33f8, 0x753a, 0xe77e, 0x7c11, 0xf7bf, 0x6baf, 0xf7be,
+	0xdefc, 0x5499, 0xef5d, 0x4439, 0x52cc, 0xe75d, 0xae5c, 0xce7a, 0x52ec, 0x6d1a, 0xb67d, 0x94d4,
+	0x636f, 0x94d3, 0xad76, 0xd69a, 0x636e, 0x5b2e, 0x7d7b, 0x4c79, 0xcf1e, 0xcefe, 0x9d15, 0xad96,
+	0xf79e, 0x3a4a, 0xce79, 0x6cfa, 0x8dbb, 0x9dfc, 0xe73c, 0xdf1c, 0x857b, 0xbebd, 0xb69d, 0xa63c,
+	0xef9f, 0x95fc, 0x3418, 0x7c31, 0x426b, 0x64fa, 0x5cda, 0x3c39, 0xce9a, 0xc639, 0xef9e, 0x73d0,
+	0x95db, 0x4aab, 0xa556, 0x428b, 0x9cf4, 0x5cb9, 0x8431, 0xc659, 0x54b9, 0x8cb3, 0xef7d, 0xc638,
+	0x8472, 0x2bf8, 0x4acc, 0xa535, 0x755b, 0xcefd, 0xbe18, 0x4a8b, 0xc6fd, 0xdf3e, 0x3c38, 0xd6ba,
+	0xa61c, 0x4438, 0x755a, 0xbe9d, 0xdf5e, 0xe79f, 0x8ddb, 0x6b8f, 0xae7d, 0xa555, 0x5cba, 0x4aac,
+	0x33d8, 0x5b2d, 0x426a, 0x6b6f, 0x95dc, 0xdefb,
+};
+
+static const uint8_t startScreenData[] = {
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbd, 0x00,
+	0x03, 0x18, 0x14, 0x14, 0x18, 0xfb, 0x00, 0x03, 0x1c, 0x02, 0x02, 0x1c, 0xfa, 0x00, 0x00, 0x1d, 0x83, 0x02, 0x00, 0x1d, 0xf9, 0x00, 0x00, 0x08,
+	0x83, 0x02, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x08, 0x83, 0x02, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x08, 0x83, 0x02, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x08,
+	0x83, 0x02, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x08, 0x83, 0x02, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x08, 0x83, 0x02, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x08,
+	0x83, 0x02, 0x00, 0x08, 0xdb, 0x00, 0x03, 0x57, 0x6b, 0x67, 0x1d, 0x99, 0x00, 0x00, 0x08, 0x83, 0x02, 0x00, 0x08, 0x99, 0x00, 0x03, 0x1d, 0x16,
+	0x20, 0x57, 0xbc, 0x00, 0x00, 0x27, 0x82, 0x02, 0x01, 0x29, 0x09, 0x98, 0x00, 0x00, 0x46, 0x83, 0x02, 0x00, 0x30, 0x98, 0x00, 0x01, 0x09, 0x29,
+	0x82, 0x02, 0x00, 0x5f, 0xbb, 0x00, 0x00, 0x53, 0x83, 0x02, 0x00, 0x23, 0x99, 0x00, 0x03, 0x14, 0x02, 0x02, 0x3f, 0x99, 0x00, 0x00, 0x23, 0x83,
+	0x02, 0x00, 0x53, 0xbb, 0x00, 0x01, 0x0f, 0x20, 0x83, 0x02, 0x00, 0x44, 0x99, 0x00, 0x81, 0x4f, 0x99, 0x00, 0x00, 0x44, 0x83, 0x02, 0x01, 0x1c,
+	0x17, 0xbc, 0x00, 0x00, 0x27, 0x83, 0x02, 0x01, 0x1c, 0x30, 0xb3, 0x00, 0x01, 0x17, 0x20, 0x83, 0x02, 0x00, 0x1f, 0xbe, 0x00, 0x00, 0x03, 0x83,
+	0x02, 0x00, 0x4e, 0xb3, 0x00, 0x00, 0x4e, 0x83, 0x02, 0x00, 0x25, 0xbf, 0x00, 0x01, 0x09, 0x28, 0x83, 0x02, 0x00, 0x0b, 0xb1, 0x00, 0x00, 0x5a,
+	0x83, 0x02, 0x01, 0x6d, 0x09, 0xc0, 0x00, 0x01, 0x37, 0x6e, 0x82, 0x02, 0x01, 0x4b, 0x1a, 0xaf, 0x00, 0x01, 0x1a, 0x5b, 0x82, 0x02, 0x01, 0x31,
+	0x71, 0xc2, 0x00, 0x00, 0x26, 0x83, 0x02, 0x00, 0x14, 0xaf, 0x00, 0x00, 0x14, 0x83, 0x02, 0x00, 0x69, 0xc4, 0x00, 0x00, 0x16, 0x82, 0x02, 0x00,
+	0x4b, 0xaf, 0x00, 0x00, 0x40, 0x82, 0x02, 0x00, 0x16, 0xc5, 0x00, 0x04, 0x1a, 0x49, 0x02, 0x02, 0x14, 0xaf, 0x00, 0x04, 0x14, 0x02, 0x02, 0x49,
+	0x1a, 0xc6, 0x00, 0x03, 0x36, 0x25, 0x2e, 0x17, 0x96, 0x00, 0x81, 0x15, 0x96, 0x00, 0x03, 0x17, 0x2e, 0x23, 0x08, 0xdb, 0x00, 0x05, 0x2d, 0x0e,
+	0x2a, 0x42, 0x1b, 0x11, 0x83, 0x01, 0x05, 0x11, 0x1b, 0x42, 0x38, 0x0e, 0x2c, 0xeb, 0x00, 0x03, 0x10, 0x3b, 0x41, 0x11, 0x8f, 0x01, 0x03, 0x11,
+	0x41, 0x3b, 0x10, 0xe5, 0x00, 0x02, 0x0d, 0x21, 0x55, 0x95, 0x01, 0x02, 0x6c, 0x21, 0x0d, 0xe1, 0x00, 0x01, 0x39, 0x50, 0x9b, 0x01, 0x01, 0x19,
+	0x22, 0xdd, 0x00, 0x01, 0x2c, 0x19, 0x9f, 0x01, 0x01, 0x19, 0x2c, 0xd9, 0x00, 0x01, 0x15, 0x2a, 0xa3, 0x01, 0x01, 0x2a, 0x15, 0xd6, 0x00, 0x01,
+	0x06, 0x0c, 0xa5, 0x01, 0x01, 0x1b, 0x2c, 0xd4, 0x00, 0x00, 0x0e, 0xa8, 0x01, 0x01, 0x55, 0x60, 0xd2, 0x00, 0x00, 0x0a, 0x90, 0x01, 0x06, 0x0c,
+	0x33, 0x0a, 0x66, 0x0e, 0x34, 0x3e, 0x93, 0x01, 0x00, 0x0a, 0xcf, 0x00, 0x01, 0x09, 0x12, 0x8d, 0x01, 0x03, 0x43, 0x0a, 0x39, 0x15, 0x85, 0x00,
+	0x00, 0x06, 0x94, 0x01, 0x01, 0x12, 0x09, 0xcd, 0x00, 0x00, 0x21, 0x8c, 0x01, 0x01, 0x33, 0x0d, 0x8a, 0x00, 0x00, 0x5e, 0x94, 0x01, 0x00, 0x12,
+	0xcc, 0x00, 0x00, 0x38, 0x8b, 0x01, 0x01, 0x21, 0x05, 0x8b, 0x00, 0x00, 0x13, 0x96, 0x01, 0x00, 0x0a, 0xca, 0x00, 0x00, 0x35, 0x8a, 0x01, 0x01,
+	0x1b, 0x39, 0x89, 0x00, 0x04, 0x13, 0x05, 0x0d, 0x1e, 0x0c, 0x97, 0x01, 0x00, 0x0e, 0xc8, 0x00, 0x00, 0x59, 0x8a, 0x01, 0x01, 0x21, 0x15, 0x86,
+	0x00, 0x03, 0x0d, 0x34, 0x50, 0x11, 0x9d, 0x01, 0x00, 0x2d, 0xae, 0x00, 0x04, 0x26, 0x20, 0x28, 0x4a, 0x1a, 0x92, 0x00, 0x01, 0x3c, 0x1b, 0x89,
+	0x01, 0x00, 0x0e, 0x85, 0x00, 0x02, 0x10, 0x48, 0x61, 0xa1, 0x01, 0x01, 0x1b, 0x10, 0x92, 0x00, 0x04, 0x1a, 0x4a, 0x28, 0x20, 0x2f, 0x94, 0x00,
+	0x00, 0x37, 0x84, 0x02, 0x02, 0x16, 0x0b, 0x17, 0x8f, 0x00, 0x00, 0x12, 0x89, 0x01, 0x00, 0x68, 0x84, 0x00, 0x02, 0x0f, 0x48, 0x11, 0xa4, 0x01,
+	0x00, 0x12, 0x8f, 0x00, 0x02, 0x17, 0x0b, 0x16, 0x84, 0x02, 0x00, 0x37, 0x93, 0x00, 0x00, 0x1f, 0x86, 0x02, 0x02, 0x40, 0x07, 0x32, 0x8c, 0x00,
+	0x00, 0x0d, 0x89, 0x01, 0x00, 0x22, 0x84, 0x00, 0x01, 0x2d, 0x0c, 0xa7, 0x01, 0x00, 0x0d, 0x8c, 0x00, 0x02, 0x32, 0x07, 0x40, 0x86, 0x02, 0x00,
+	0x1f, 0x93, 0x00, 0x01, 0x09, 0x28, 0x88, 0x02, 0x01, 0x56, 0x0b, 0x89, 0x00, 0x01, 0x09, 0x2b, 0x88, 0x01, 0x00, 0x0e, 0x84, 0x00, 0x00, 0x35,
+	0xa9, 0x01, 0x00, 0x2b, 0x8a, 0x00, 0x01, 0x0b, 0x56, 0x88, 0x02, 0x01, 0x24, 0x09, 0x94, 0x00, 0x02, 0x09, 0x0b, 0x47, 0x88, 0x02, 0x00, 0x36,
+	0x88, 0x00, 0x00, 0x3b, 0x88, 0x01, 0x00, 0x12, 0x84, 0x00, 0x00, 0x0a, 0xab, 0x01, 0x00, 0x1e, 0x88, 0x00, 0x00, 0x36, 0x88, 0x02, 0x02, 0x47,
+	0x0b, 0x09, 0x98, 0x00, 0x02, 0x52, 0x26, 0x04, 0x85, 0x02, 0x00, 0x44, 0x88, 0x00, 0x00, 0x0c, 0x87, 0x01, 0x01, 0x2b, 0x0f, 0x83, 0x00, 0x00,
+	0x2a, 0xac, 0x01, 0x00, 0x0c, 0x88, 0x00, 0x00, 0x1f, 0x85, 0x02, 0x02, 0x04, 0x26, 0x52, 0x9e, 0x00, 0x06, 0x18, 0x03, 0x1c, 0x02, 0x02, 0x29,
+	0x09, 0x87, 0x00, 0x00, 0x22, 0x88, 0x01, 0x00, 0x5c, 0x83, 0x00, 0x00, 0x3d, 0xae, 0x01, 0x00, 0x22, 0x87, 0x00, 0x06, 0x09, 0x29, 0x02, 0x02,
+	0x1c, 0x03, 0x18, 0xa4, 0x00, 0x02, 0x27, 0x45, 0x0f, 0x88, 0x00, 0x00, 0x6a, 0x87, 0x01, 0x00, 0x12, 0x83, 0x00, 0x00, 0x0d, 0xaf, 0x01, 0x00,
+	0x4d, 0x88, 0x00, 0x02, 0x0f, 0x45, 0x27, 0xb2, 0x00, 0x00, 0x64, 0x88, 0x01, 0x00, 0x13, 0x82, 0x00, 0x01, 0x15, 0x43, 0xb0, 0x01, 0x00, 0x13,
+	0xbd, 0x00, 0x00, 0x70, 0x87, 0x01, 0x00, 0x58, 0x83, 0x00, 0x00, 0x0a, 0xb1, 0x01, 0x00, 0x3d, 0xbd, 0x00, 0x00, 0x19, 0x87, 0x01, 0x00, 0x05,
+	0x82, 0x00, 0x00, 0x13, 0xb2, 0x01, 0x00, 0x19, 0xbc, 0x00, 0x00, 0x10, 0x87, 0x01, 0x00, 0x2b, 0x83, 0x00, 0x00, 0x0a, 0xb3, 0x01, 0x00, 0x10,
+	0xbb, 0x00, 0x00, 0x3a, 0x87, 0x01, 0x00, 0x35, 0x82, 0x00, 0x01, 0x0f, 0x11, 0xb3, 0x01, 0x00, 0x63, 0xbb, 0x00, 0x00, 0x0a, 0x87, 0x01, 0x00,
+	0x06, 0x82, 0x00, 0x00, 0x22, 0xb4, 0x01, 0x00, 0x34, 0xbb, 0x00, 0x00, 0x41, 0x86, 0x01, 0x00, 0x3e, 0x83, 0x00, 0x00, 0x62, 0xb4, 0x01, 0x00,
+	0x33, 0xbb, 0x00, 0x00, 0x0c, 0x86, 0x01, 0x00, 0x42, 0x83, 0x00, 0x00, 0x43, 0xb4, 0x01, 0x00, 0x0c, 0xba, 0x00, 0x00, 0x09, 0x87, 0x01, 0x00,
+	0x38, 0x82, 0x00, 0x00, 0x3c, 0xb6, 0x01, 0xba, 0x00, 0x00, 0x3c, 0x87, 0x01, 0x00, 0x0e, 0x82, 0x00, 0x00, 0x2d, 0xb6, 0x01, 0x00, 0x10, 0xb9,
+	0x00, 0x00, 0x13, 0x87, 0x01, 0x00, 0x1e, 0x82, 0x00, 0x00, 0x3a, 0xb6, 0x01, 0x00, 0x13, 0xb9, 0x00, 0x00, 0x05, 0x87, 0x01, 0x00, 0x3a, 0x82,
+	0x00, 0x00, 0x1e, 0xb6, 0x01, 0x00, 0x5d, 0xb9, 0x00, 0x00, 0x06, 0x87, 0x01, 0x00, 0x1e, 0x82, 0x00, 0x00, 0x3d, 0xb6, 0x01, 0x00, 0x06, 0xb9,
+	0x00, 0x00, 0x06, 0x87, 0x01, 0x04, 0x19, 0x10, 0x00, 0x65, 0x0c, 0xb6, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0x88, 0x01, 0x02, 0x3e, 0x4d,
+	0x11, 0xb7, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00,
+	0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00,
+	0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00,
+	0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00,
+	0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00,
+	0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00,
+	0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00,
+	0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00,
+	0x06, 0xc3, 0x01, 0x00, 0x06, 0xb9, 0x00, 0x00, 0x0f, 0xc3, 0x05, 0x00, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb6, 0x00, 0x02, 0x1d, 0x2f,
+	0x4c, 0xc5, 0x03, 0x02, 0x4c, 0x2f, 0x1d, 0xb2, 0x00, 0x01, 0x25, 0x31, 0xc9, 0x02, 0x01, 0x31, 0x23, 0xb0, 0x00, 0x00, 0x51, 0xcd, 0x02, 0x00,
+	0x51, 0xae, 0x00, 0x00, 0x18, 0xcf, 0x02, 0x00, 0x18, 0xad, 0x00, 0x00, 0x2e, 0xcf, 0x02, 0x00, 0x2e, 0xad, 0x00, 0x00, 0x54, 0xcf, 0x02, 0x00,
+	0x54, 0xad, 0x00, 0x00, 0x07, 0xcf, 0x02, 0x00, 0x07, 0xad, 0x00, 0x00, 0x07, 0xcf, 0x02, 0x00, 0x07, 0xad, 0x00, 0x00, 0x07, 0xcf, 0x02, 0x00,
+	0x07, 0xad, 0x00, 0x00, 0x07, 0xcf, 0x02, 0x00, 0x07, 0xad, 0x00, 0x00, 0x07, 0xcf, 0x02, 0x00, 0x07, 0xad, 0x00, 0x00, 0x07, 0xcf, 0x02, 0x00,
+	0x07, 0xad, 0x00, 0x00, 0x07, 0xcf, 0x02, 0x00, 0x07, 0xad, 0x00, 0x00, 0x07, 0xcf, 0x02, 0x00, 0x07, 0xad, 0x00, 0x00, 0x25, 0xcf, 0x02, 0x00,
+	0x23, 0xad, 0x00, 0x00, 0x32, 0xcf, 0x02, 0x00, 0x1f, 0xae, 0x00, 0x00, 0x16, 0xcd, 0x02, 0x00, 0x16, 0xaf, 0x00, 0x01, 0x46, 0x24, 0xcb, 0x02,
+	0x01, 0x6f, 0x30, 0xb1, 0x00, 0x02, 0x0b, 0x3f, 0x24, 0xc5, 0x04, 0x02, 0x24, 0x3f, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x99, 0x00,
+};
+
+const iconAsset startScreen = { 128, 128, startScreenPalette, nullptr, startScreenData, false, 0x0000 };
+
+/*---------------------------------------------------------------- */
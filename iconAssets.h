@@ -0,0 +1,31 @@
+// iconAssets.h
+
+// Generated by tools/convertIcons.py from assets/, do not edit
+
+#ifndef _ICONASSETS_h
+#define _ICONASSETS_h
+
+#include "drawBitmap.h"
+
+/*---------------------------------------------------------------- */
+
+extern const iconAsset wiFiRed;
+extern const iconAsset wiFiGreen;
+extern const iconAsset wiFiAmber;
+extern const iconAsset pulseRed;
+extern const iconAsset pulseAmber;
+extern const iconAsset pulseGreen;
+extern const iconAsset sdCardGreen;
+extern const iconAsset sdCardRed;
+extern const iconAsset yesPlease;
+extern const iconAsset noThanks;
+extern const iconAsset policeCar;
+extern const iconAsset ambulance;
+extern const iconAsset fireEngine;
+extern const iconAsset falsePositive;
+extern const iconAsset categoriseEvents;
+extern const iconAsset manualEntry;
+extern const iconAsset deleteLastLine;
+extern const iconAsset startScreen;
+
+#endif
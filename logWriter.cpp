@@ -0,0 +1,202 @@
+//
+// logWriter.cpp
+//
+
+// Main libraries
+
+#include <FS.h>						// Files system library
+
+// Local declarations
+
+#include "logWriter.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+unsigned long logFlushInterval = 5000;				// Durability window, records reach the card within this time
+
+static char logBuffer[logBufferSize] __attribute__((aligned(4)));
+
+static size_t logLength = 0;						// Bytes held in the buffer
+static size_t logLimit = logBufferSize;				// Bytes to hold before writing, keeps writes on sector boundaries
+static bool logDirty = false;						// Records held or written but not yet committed
+static unsigned long logDirtySince = 0;				// When the oldest uncommitted record arrived
+
+static File logFile;								// Kept open between records
+static fs::FS* logFs = nullptr;
+static const char* logPath = nullptr;
+
+/*---------------------------------------------------------------- */
+
+// Open the log file if it isnt already
+
+static bool openLog(fs::FS& fs, const char* path) {
+
+	if (logFile && logFs == &fs && strcmp(logPath, path) == 0) return true;
+
+	logWriterClose();
+
+	logFile = fs.open(path, FILE_APPEND);
+
+	if (!logFile) {
+		outputDebugLn("Failed to open log file for appending");
+		return false;
+	}
+
+	logFs = &fs;
+	logPath = path;
+
+	// Top the file up to the next sector boundary first, so later full buffers land on whole sectors
+
+	logLimit = logBufferSize - (logFile.size() % logBufferSize);
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Write the buffer to the file
+
+static bool writeHeld() {
+
+	if (logLength == 0) return true;
+
+	size_t written = logFile.write((const uint8_t*)logBuffer, logLength);
+
+	// Keep what didnt reach the card at the front of the buffer, the next write tries it again
+
+	if (written < logLength) {
+
+		memmove(logBuffer, &logBuffer[written], logLength - written);
+
+		logLength -= written;
+		logLimit = logBufferSize;						// Hold as much as fits until a write goes through
+
+		outputDebugLn("Log write short, bytes kept for the next write");
+
+		return false;
+	}
+
+	logLength = 0;
+	logLimit = logBufferSize - (logFile.position() % logBufferSize);
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Copy bytes into the buffer, writing each time it fills. The caller has made room for all of them,
+// a write that comes up short only leaves more held.
+
+static void hold(const char* data, size_t length) {
+
+	while (length > 0) {
+
+		size_t count = min(logLimit - logLength, length);
+
+		memcpy(&logBuffer[logLength], data, count);
+
+		logLength += count;
+		data += count;
+		length -= count;
+
+		if (logLength == logLimit) writeHeld();
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Add a line to the log
+
+bool logWriterAppend(fs::FS& fs, const char* path, const char* line) {
+
+	if (!openLog(fs, path)) return false;
+
+	// A line is held whole with its ending or not at all, a torn one would join the next in the file
+
+	size_t length = strlen(line);
+
+	if (logLength + length + 2 > logBufferSize) writeHeld();
+
+	if (logLength + length + 2 > logBufferSize) {
+		outputDebugLn("Log buffer full, line dropped");
+		return false;
+	}
+
+	if (!logDirty) {
+		logDirty = true;
+		logDirtySince = millis();
+	}
+
+	hold(line, length);
+	hold("\r\n", 2);
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Write anything held once the durability window has passed
+
+void logWriterPoll() {
+
+	if (logDirty && (millis() - logDirtySince >= logFlushInterval)) {
+		logWriterSync();
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Write anything held and commit it to the card
+
+void logWriterSync() {
+
+	if (!logFile) return;
+
+	// Anything the card didnt take stays dirty, so the next poll tries again
+
+	bool written = writeHeld();
+
+	logFile.flush();
+
+	logDirty = !written;
+
+	outputDebugLn("Log synced");
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Sync and close the file
+
+void logWriterClose() {
+
+	if (!logFile) return;
+
+	logWriterSync();
+	logFile.close();
+
+	logFs = nullptr;
+	logPath = nullptr;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
@@ -0,0 +1,44 @@
+// logWriter.h
+
+#ifndef _LOGWRITER_h
+#define _LOGWRITER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Main libraries
+
+#include <FS.h>						// Files system library
+
+/*---------------------------------------------------------------- */
+
+// Buffer size & durability window
+
+const size_t logBufferSize = 512;			// One SD sector
+
+extern unsigned long logFlushInterval;		// Longest time a record is held in RAM before it is written, ms
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Add a line to the log, the line ending is added here
+
+bool logWriterAppend(fs::FS& fs, const char* path, const char* line);
+
+// Write anything held once the durability window has passed
+
+void logWriterPoll();
+
+// Write anything held and commit it to the card
+
+void logWriterSync();
+
+// Sync and close the file, needed before the file is rewritten or renamed
+
+void logWriterClose();
+
+#endif
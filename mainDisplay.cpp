@@ -12,6 +12,9 @@
 #include "global.h"					// Global
 #include "colours.h"				// Colour pallette
 #include "screenLayout.h"			// Screen layout
+#include "Free_Fonts.h"				// Additional fonts
+#include "screenWidgets.h"			// Title label
+#include "spiBus.h"					// Shared SPI bus
 
 // Debug serial prints
 
@@ -32,11 +35,15 @@
 
 void drawBorder() {
 
+	busAcquire(busTFT);
+
 	// Draw layout borders
 
 	tft.drawRect(FRAME1_X, FRAME1_Y, FRAME1_W, FRAME1_H, BLACK);
 	tft.drawRect(FRAME2_X, FRAME2_Y, FRAME2_W, FRAME2_H, BLACK);
 
+	busRelease(busTFT);
+
 } // Close function
 
 /*-----------------------------------------------------------------*/
@@ -45,11 +52,87 @@ void drawBorder() {
 
 void drawWhiteBox() {
 
+	busAcquire(busTFT);
+
 	// Clear screen by using a black box
 
 	tft.fillRect(FRAME2_X + 1, FRAME2_Y + 30, FRAME2_W - 2, FRAME2_H - 45, WHITE);		// This covers only the graphs and charts, not the system icons to save refresh flicker
 	tft.fillRect(FRAME2_X + 1, FRAME2_Y + 1, FRAME2_W - 90, FRAME2_H - 200, WHITE);		// Ths covers the title text per page
 
+	busRelease(busTFT);
+
+	invalidateTitle();
+
 } // Close function
 
-/*-----------------------------------------------------------------*/
\ No newline at end of file
+/*-----------------------------------------------------------------*/
+
+// Show a one line message in the red band across the table
+
+void showPrompt(const char* text, int cursorX) {
+
+	busAcquire(busTFT);
+
+	tft.fillRect(15, 60, 233, 40, LTRED);
+	tft.setFreeFont(&FreeSans12pt7b);
+	tft.setTextSize(1);
+	tft.setTextColor(DKBLUE);
+	tft.setCursor(cursorX, 88);
+	tft.print(text);
+
+	busRelease(busTFT);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Clear the title area and write a page title
+
+void drawTitle(const char* title) {
+
+	busAcquire(busTFT);
+
+	tft.fillRect(FRAME2_X + 1, FRAME2_Y + 1, FRAME2_W - 90, FRAME2_H - 200, WHITE);
+
+	tft.setFreeFont(&FreeSans9pt7b);
+	tft.setTextSize(1);
+	tft.setTextColor(BLACK);
+	tft.setCursor(13, 26);
+	tft.print(title);
+
+	busRelease(busTFT);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Draw the copy progress bar under the message band
+
+void drawCopyProgress(size_t done, size_t total) {
+
+	static int lastWidth = -1;		// Only the part that has grown is filled
+
+	int width = (total == 0) ? PROGRESS_W - 2 : (int)((uint64_t)done * (PROGRESS_W - 2) / total);
+
+	busAcquire(busTFT);
+
+	if (done == 0 || width < lastWidth) {
+
+		tft.drawRect(PROGRESS_X, PROGRESS_Y, PROGRESS_W, PROGRESS_H, DKBLUE);
+		tft.fillRect(PROGRESS_X + 1, PROGRESS_Y + 1, PROGRESS_W - 2, PROGRESS_H - 2, WHITE);
+
+		lastWidth = 0;
+	}
+
+	if (width > lastWidth) {
+
+		tft.fillRect(PROGRESS_X + 1 + lastWidth, PROGRESS_Y + 1, width - lastWidth, PROGRESS_H - 2, DKBLUE);
+
+		lastWidth = width;
+	}
+
+	busRelease(busTFT);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
@@ -24,5 +24,11 @@ void drawBorder();
 
 void drawWhiteBox();
 
+void showPrompt(const char* text, int cursorX);
+
+void drawTitle(const char* title);
+
+void drawCopyProgress(size_t done, size_t total);
+
 #endif
 
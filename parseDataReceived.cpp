@@ -8,6 +8,15 @@
 #include "global.h"
 #include "fileOperations.h"
 #include "mainDisplay.h"
+#include "serialRingBuffer.h"
+#include "eventQueue.h"
+#include "logWriter.h"
+#include "binaryLog.h"
+#include "glyphCache.h"
+#include "screenWidgets.h"
+#include "displayPower.h"
+#include "spiBus.h"
+#include "wifiSystem.h"
 
 // Debug serial prints
 
@@ -30,12 +39,45 @@ const unsigned long firstDetectionTimeCheckPeriod = 5000;		// Period to wait bef
 unsigned long waitSinceLastEventTime = 0;					// Time since the next event wait period
 const unsigned long waitDetectionPeriod = 10000;			// Period to wait before recognizing a new event
 
+static char tailChunk[tailChunkSize];						// Buffer for reading the CSV file in blocks
+
+static bleSignal shownEntries[maxEntries];					// What each row of the table shows now
+static bool tableValid = false;								// False once something else has drawn over the table
+
+// Any title that fits in a frame fits in a record whole
+
+static_assert(titleLength + 4 >= maxFrameLength, "bleSignal.title must hold the longest title a frame can carry");
+
 /*-----------------------------------------------------------------*/
 
 // Parse data from serial
 
 void parseData() {
 
+	frameSlice frame;
+
+	// Work through every complete frame in the ring buffer, nothing here waits on the UART
+
+	while (nextFrame(frame)) {
+
+		outputDebug("Data received from Serial 2: ");
+		outputDebugLn(String(frame.data, frame.length));
+		outputDebugLn("");
+
+		processFrame(frame);
+
+		releaseFrame(frame);
+
+	}
+
+}  // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Handle one frame received from the Nano BLE
+
+void processFrame(const frameSlice& frame) {
+
 	// Event count
 
 	static byte eventCount = 0;
@@ -45,22 +87,13 @@ void parseData() {
 
 	unsigned long currentMillis = millis();
 
-	// Read data into String
-
-	dataReceived = "";
-	dataReceived = Serial2.readStringUntil('%');		// '%' isnt included in the data
-
-	outputDebug("Data received from Serial 2: ");
-	outputDebugLn(dataReceived);
-	outputDebugLn("");
-
 	// Parse the received data
 
-	bleSignal newData = parseDataS(dataReceived);
+	bleSignal newData = parseDataS(frame);
 
 	// Check if the title and percentage are not blank
 
-	if (!newData.title.isEmpty() || !newData.percentage.isEmpty()) {
+	if (newData.title[0] != '\0' || newData.percentage[0] != '\0') {
 
 		// Check if signal is within first wait period
 
@@ -105,9 +138,9 @@ void parseData() {
 
 				addEntryToArray(newData);
 
-				// Update CSV file with the new entry
+				// Queue the new entry for the persistence task to write to the CSV file, open pages are told once it is stored
 
-				appendFile(SD, fileName, newData);
+				pushEvent(newData);
 
 				// Update the last event time
 
@@ -160,7 +193,6 @@ void parseData() {
 
 	else {
 		outputDebugLn("Error: Title or percentage is blank!");
-		clearSerialBuffer();
 
 		return;
 
@@ -172,70 +204,58 @@ void parseData() {
 
 // CSV data parsing
 
-bleSignal parseDataS(String dataReceived) {
-
-	bleSignal newData;
+bleSignal parseDataS(const frameSlice& frame) {
 
 	// Ensure struct is empty
 
-	newData.title = "";
-	newData.date = "";
-	newData.time = "";
-	newData.category = "";
-	newData.percentage = "";
-	
+	bleSignal newData = {};
+
 	// Get current local time
 
 	struct tm timeinfo;
 	if (getLocalTime(&timeinfo)) {
 
-		// Extract date from timeinfo
-
-		char date[11]; // Format: DD-MM-YYYY
+		// Extract date from timeinfo, format: DD-MM-YYYY
 
-		snprintf(date, sizeof(date), "%02d-%02d-%04d", timeinfo.tm_mday, timeinfo.tm_mon + 1, timeinfo.tm_year + 1900);
+		snprintf(newData.date, sizeof(newData.date), "%02u-%02u-%04u", (unsigned)timeinfo.tm_mday % 100, (unsigned)(timeinfo.tm_mon + 1) % 100,
+			(unsigned)(timeinfo.tm_year + 1900) % 10000);
 
-		// Assign date to newData
+		// Extract time from timeinfo, format: HH:MM:SS
 
-		newData.date = String(date);
-
-		// Extract time from timeinfo
-
-		char time[9]; // Format: HH:MM:SS
-
-		snprintf(time, sizeof(time), "%02d:%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-
-		// Assign time to newData
-
-		newData.time = String(time);
+		snprintf(newData.time, sizeof(newData.time), "%02u:%02u:%02u", (unsigned)timeinfo.tm_hour % 100, (unsigned)timeinfo.tm_min % 100,
+			(unsigned)timeinfo.tm_sec % 100);
 	}
 
 	// Find the positions of the commas
 
-	int commaIndex1 = dataReceived.indexOf(',');
+	const char* start = frame.data;
+	const char* end = frame.data + frame.length;
 
-	int commaIndex2 = dataReceived.indexOf(',', commaIndex1 + 1);
+	const char* comma1 = (const char*)memchr(start, ',', end - start);
+	const char* comma2 = comma1 ? (const char*)memchr(comma1 + 1, ',', end - (comma1 + 1)) : nullptr;
 
-	if (commaIndex1 != -1 && commaIndex2 != -1) {
+	if (comma1 != nullptr && comma2 != nullptr) {
 
 		// Extract and trim title - Trim is needed to remove control characters from serial inputs
 
-		newData.title = dataReceived.substring(0, commaIndex1);
-
-		newData.title.trim();		// Properly apply trim to the extracted substring
+		setField(newData.title, start, comma1);
 
 		// Extract and trim category
 
-		newData.category = dataReceived.substring(commaIndex1 + 1, commaIndex2);
-
-		newData.category.trim();	// Properly apply trim to the extracted substring
+		setField(newData.category, comma1 + 1, comma2);
 
 		// Extract and trim percentage
 
-		newData.percentage = dataReceived.substring(commaIndex2 + 1);
+		setField(newData.percentage, comma2 + 1, end);
+
+		// Append percentage sign
 
-		newData.percentage.trim();  // Properly apply trim to the extracted substring
-		newData.percentage += '%';	// Append percentage sign
+		size_t length = strlen(newData.percentage);
+
+		if (length < sizeof(newData.percentage) - 1) {
+			newData.percentage[length] = '%';
+			newData.percentage[length + 1] = '\0';
+		}
 
 	}
 
@@ -267,231 +287,278 @@ void addEntryToArray(bleSignal entry) {
 
 /*-----------------------------------------------------------------*/
 
-// Populate temporary array from CSV file
+// Find where the last lines of a file start by walking backwards from the end, blank lines are skipped
+
+size_t findTailOffset(File& file, int lines, int& linesFound) {
+
+	size_t position = file.size();
+	bool inLine = false;
+
+	linesFound = 0;
+
+	while (position > 0) {
+
+		size_t length = min(tailChunkSize, position);
+
+		position -= length;
+
+		file.seek(position);
+		length = file.read((uint8_t*)tailChunk, length);
+
+		for (size_t i = length; i-- > 0;) {
+
+			char c = tailChunk[i];
+
+			if (c == '\n') {
+
+				if (inLine) {
+
+					linesFound++;
+					inLine = false;
+
+					if (linesFound == lines) {
+						return position + i + 1;
+					}
+				}
+			}
+
+			else if (!isspace((unsigned char)c)) {
+				inLine = true;
+			}
+		}
+	}
+
+	// Reached the start of the file, the first line has no newline in front of it
+
+	if (inLine) {
+		linesFound++;
+	}
+
+	return 0;
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Populate temporary array from the tail of the CSV file, cost depends on maxEntries not the file size
 
 void populateArrayFromCSV(fs::FS& fs, const char* path, bleSignal* dataEntries, int maxEntries) {
 
 	// Open the CSV file
 
+	lockStorage();
+	drainEvents();						// Detections still queued are already in the table, write them first
+	logWriterSync();					// Make sure buffered records are in the file before reading it
+
+#if BINARY_LOG
+
+	// The binary log holds the same rows at fixed offsets, so the tail is one seek and a single read
+
+	if (binaryLogReady()) {
+
+		numEntries = binaryLogTail(dataEntries, maxEntries);
+
+		unlockStorage();
+		return;
+	}
+
+#endif
+
 	File file = fs.open(path, FILE_READ);
 
 	if (!file) {
 		outputDebugLn("");
 		outputDebugLn("Failed to open CSV file");
+		unlockStorage();
 		return;
 	}
 
-	// Calculate the total number of rows (excluding the header)
+	// Find the start of the last maxEntries rows
+
+	int rowsFound = 0;
+	size_t startOffset = findTailOffset(file, maxEntries, rowsFound);
 
-	int totalRows = 0;
+	outputDebugLn("");
+	outputDebug("Rows read from end of CSV file: ");
+	outputDebugLn(rowsFound);
+	outputDebugLn("");
 
-	while (file.available()) {
-		if (file.readStringUntil('\n').length() > 0) {
-			totalRows++;
+	// Read forwards from there, the oldest row goes in the highest position and the newest in position 0
+
+	file.seek(startOffset);
+
+	char line[maxLineLength];
+	size_t lineLength = 0;
+	bool inLine = false;					// Seen something other than whitespace since the last line ending
+	bool atEnd = false;
+	int position = rowsFound - 1;
+
+	while (position >= 0 && !atEnd) {
+
+		size_t length = file.read((uint8_t*)tailChunk, tailChunkSize);
+
+		// Treat the end of the file as a final line ending, then stop
+
+		if (length == 0) {
+			tailChunk[0] = '\n';
+			length = 1;
+			atEnd = true;
 		}
-	}
 
-		outputDebugLn("");
-		outputDebug("Total number of rows in CSV file: ");
-		outputDebugLn(totalRows);
-		outputDebugLn("");
+		for (size_t i = 0; i < length && position >= 0; i++) {
+
+			char c = tailChunk[i];
 
-	// Start reading from the beginning of the file
+			if (c != '\n') {
+				if (!isspace((unsigned char)c)) inLine = true;
+				if (inLine && lineLength < maxLineLength) line[lineLength++] = c;		// Leading whitespace would only be trimmed
+				continue;
+			}
 
-	file.seek(0);
+			// Skip blank lines, the same way findTailOffset does
 
-	// Move to the desired starting row
+			if (inLine) {
 
-	int startRow = totalRows - maxEntries;
+				// Parse the line and populate the array
 
-	for (int i = 0; i < (startRow); i++) {
-		String line = file.readStringUntil('\n');
+				dataEntries[position] = parseCSVLine(line, lineLength);
 
-		outputDebug("Parse array from CSV: ")
-		outputDebug("Starting line: ");
-		outputDebugLn(line);
-		outputDebugLn("");
+				outputDebug("Title: ");
+				outputDebug(dataEntries[position].title);
+				outputDebug(", Date: ");
+				outputDebug(dataEntries[position].date);
+				outputDebug(", Time: ");
+				outputDebug(dataEntries[position].time);
+				outputDebug(", Catagory: ");
+				outputDebug(dataEntries[position].category);
+				outputDebug(", Accuracy: ");
+				outputDebugLn(dataEntries[position].percentage);
+
+				position--;
+			}
+
+			lineLength = 0;
+			inLine = false;
+		}
+	}
+
+	// Clear any positions the file didnt have rows for
 
+	for (int i = rowsFound; i < maxEntries; i++) {
+		dataEntries[i] = bleSignal();
 	}
 
-	int position = 9;
+	numEntries = rowsFound;
+
+	outputDebugLn("");
+
+	// Close the file
+
+	file.close();
+
+	unlockStorage();
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Draw one table cell over what it showed, padded to the widest the field can be so the old text is painted over
+
+static void drawCell(int x, int y, const char* text, const char* shown, int width) {
+
+	drawTextOver(x, y, text, shown, BLACK, WHITE, width);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Update table on TFT display, only the cells that differ from what is on screen are drawn
+
+void updateTable() {
+
+	// Left for wake while the display is dark, dataEntries already holds the new rows
+
+	if (!displayRender(displayTable)) {
 
-	if (totalRows < 10) {
+		newDataReceived = false;
 
-		position = totalRows - 1;
+		return;
 	}
 
-	else position = 9;
+	// Headers and every changed cell go out in one bus batch
+
+	busAcquire(busTFT);
+
+	if (!tableValid) {
+
+		drawWhiteBox();
 
-	// Read the rows and populate the array
+		setTitle("Siren Monitor");
 
-	// (int i = 0; i < maxEntries; i++)
+		tft.setFreeFont();
+		tft.setTextColor(BLACK);
 
-	for (int i = position; i > -1; i--) {
+		tft.setCursor(15, 47);
+		tft.print("Time");
+		tft.setCursor(80, 47);
+		tft.print("Date");
+		tft.setCursor(155, 47);
+		tft.print("Type");
+		tft.setCursor(195, 47);
+		tft.print("Accuracy");
+		tft.drawFastHLine(15, 55, 230, BLACK);
 
-		// Read the next line from the file
+		// The box is blank now, so only cells with something in them get drawn
 
-		String line = file.readStringUntil('\r\n');
+		memset(shownEntries, 0, sizeof(shownEntries));
 
-		// Parse the line and populate the array
+		tableValid = true;
+	}
 
-		int commaIndex1 = line.indexOf(',');
-		int commaIndex2 = line.indexOf(',', commaIndex1 + 1);
-		int commaIndex3 = line.indexOf(',', commaIndex2 + 1);
-		int commaIndex4 = line.indexOf(',', commaIndex3 + 1);
+	// Each cell is drawn with its background as one block, so nothing is cleared first. Only the
+	// characters that differ go out, a new time often keeps its hour and a new date its month and year
 
-		if (commaIndex1 != -1 && commaIndex2 != -1 && commaIndex3 != -1 && commaIndex4 != -1) {
+	for (int i = 0; i < maxEntries; i++) {
 
-			// Extract data from the line
+		const bleSignal& entry = dataEntries[i];
+		bleSignal& shown = shownEntries[i];
 
-			dataEntries[i].title = line.substring(0, commaIndex1);
-			dataEntries[i].date = line.substring(commaIndex1 + 1, commaIndex2);
-			dataEntries[i].time = line.substring(commaIndex2 + 1, commaIndex3);
-			dataEntries[i].category = line.substring(commaIndex3 + 1, commaIndex4);
-			dataEntries[i].percentage = line.substring(commaIndex4 + 1);
+		int y = 60 + i * 13;
 
+		if (strcmp(entry.time, shown.time) != 0) {
+			drawCell(15, y, entry.time, shown.time, sizeof(entry.time) - 1);
 		}
 
-		outputDebug("Title: ");
-		outputDebug(dataEntries[i].title);
-		outputDebug(", Date: ");
-		outputDebug(dataEntries[i].date);
-		outputDebug(", Time: ");
-		outputDebug(dataEntries[i].time);
-		outputDebug(", Catagory: ");
-		outputDebug(dataEntries[i].category);
-		outputDebug(", Accuracy: ");
-		outputDebugLn(dataEntries[i].percentage);
+		if (strcmp(entry.date, shown.date) != 0) {
+			drawCell(80, y, entry.date, shown.date, sizeof(entry.date) - 1);
+		}
 
-		numEntries++;
+		if (strcmp(entry.category, shown.category) != 0) {
+			drawCell(155, y, entry.category, shown.category, sizeof(entry.category) - 1);
+		}
 
-	}
+		if (strcmp(entry.percentage, shown.percentage) != 0) {
+			drawCell(195, y, entry.percentage, shown.percentage, sizeof(entry.percentage) - 1);
+		}
 
-	outputDebugLn("");
+		shown = entry;
+	}
 
-	// Close the file
+	busRelease(busTFT);
 
-	file.close();
+	newDataReceived = false;
 
 } // Close function
 
 /*-----------------------------------------------------------------*/
 
-// Update table on TFT display
+// Redraw the whole table, for when something else has drawn over it
 
-void updateTable() {
+void redrawTable() {
 
-	drawWhiteBox();
-
-	tft.setFreeFont(&FreeSans9pt7b);
-	tft.setTextSize(1);
-	tft.setTextColor(BLACK);
-	tft.setCursor(13, 26);
-	tft.print("Siren Monitor");
-
-	tft.setFreeFont();
-	tft.setTextColor(BLACK);
-
-	tft.setCursor(15, 47);
-	tft.print("Time");
-	tft.drawFastHLine(15, 55, 230, BLACK);
-	tft.setCursor(15, 60);
-	tft.print(dataEntries[0].time);
-	tft.setCursor(15, 73);
-	tft.print(dataEntries[1].time);
-	tft.setCursor(15, 86);
-	tft.print(dataEntries[2].time);
-	tft.setCursor(15, 99);
-	tft.print(dataEntries[3].time);
-	tft.setCursor(15, 112);
-	tft.print(dataEntries[4].time);
-	tft.setCursor(15, 125);
-	tft.print(dataEntries[5].time);
-	tft.setCursor(15, 138);
-	tft.print(dataEntries[6].time);
-	tft.setCursor(15, 151);
-	tft.print(dataEntries[7].time);
-	tft.setCursor(15, 164);
-	tft.print(dataEntries[8].time);
-	tft.setCursor(15, 177);
-	tft.print(dataEntries[9].time);
-
-	byte xP = 80;
-
-	tft.setCursor(xP, 47);
-	tft.print("Date");
-	tft.setCursor(xP, 60);
-	tft.print(dataEntries[0].date);
-	tft.setCursor(xP, 73);
-	tft.print(dataEntries[1].date);
-	tft.setCursor(xP, 86);
-	tft.print(dataEntries[2].date);
-	tft.setCursor(xP, 99);
-	tft.print(dataEntries[3].date);
-	tft.setCursor(xP, 112);
-	tft.print(dataEntries[4].date);
-	tft.setCursor(xP, 125);
-	tft.print(dataEntries[5].date);
-	tft.setCursor(xP, 138);
-	tft.print(dataEntries[6].date);
-	tft.setCursor(xP, 151);
-	tft.print(dataEntries[7].date);
-	tft.setCursor(xP, 164);
-	tft.print(dataEntries[8].date);
-	tft.setCursor(xP, 177);
-	tft.print(dataEntries[9].date);
-
-	xP = 155;
-
-	tft.setCursor(xP, 47);
-	tft.print("Type");
-	tft.setCursor(xP, 60);
-	tft.print(dataEntries[0].category);
-	tft.setCursor(xP, 73);
-	tft.print(dataEntries[1].category);
-	tft.setCursor(xP, 86);
-	tft.print(dataEntries[2].category);
-	tft.setCursor(xP, 99);
-	tft.print(dataEntries[3].category);
-	tft.setCursor(xP, 112);
-	tft.print(dataEntries[4].category);
-	tft.setCursor(xP, 125);
-	tft.print(dataEntries[5].category);
-	tft.setCursor(xP, 138);
-	tft.print(dataEntries[6].category);
-	tft.setCursor(xP, 151);
-	tft.print(dataEntries[7].category);
-	tft.setCursor(xP, 164);
-	tft.print(dataEntries[8].category);
-	tft.setCursor(xP, 177);
-	tft.print(dataEntries[9].category);
-
-	xP = 195;
-
-	tft.setCursor(xP, 47);
-	tft.print("Accuracy");
-	tft.setCursor(xP, 60);
-	tft.print(dataEntries[0].percentage);
-	tft.setCursor(xP, 73);
-	tft.print(dataEntries[1].percentage);
-	tft.setCursor(xP, 86);
-	tft.print(dataEntries[2].percentage);
-	tft.setCursor(xP, 99);
-	tft.print(dataEntries[3].percentage);
-	tft.setCursor(xP, 112);
-	tft.print(dataEntries[4].percentage);
-	tft.setCursor(xP, 125);
-	tft.print(dataEntries[5].percentage);
-	tft.setCursor(xP, 138);
-	tft.print(dataEntries[6].percentage);
-	tft.setCursor(xP, 151);
-	tft.print(dataEntries[7].percentage);
-	tft.setCursor(xP, 164);
-	tft.print(dataEntries[8].percentage);
-	tft.setCursor(xP, 177);
-	tft.print(dataEntries[9].percentage);
+	tableValid = false;
 
-	newDataReceived = false;
+	updateTable();
 
 } // Close function
 
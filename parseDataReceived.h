@@ -9,6 +9,7 @@
 #include "global.h"
 #include "fileOperations.h"
 #include "mainDisplay.h"
+#include "serialRingBuffer.h"
 
 #if defined(ARDUINO) && ARDUINO >= 100
 	#include "arduino.h"
@@ -16,26 +17,43 @@
 	#include "WProgram.h"
 #endif
 
+// Tail reader sizes
+
+const size_t tailChunkSize = 256;		// Bytes read per seek when walking back from the end of the CSV file
+const size_t maxLineLength = 96;		// Longest CSV line kept, longer lines are truncated. Room for the longest title.
+
 // Extract data
 
 void parseData();
 
+// Handle one frame
+
+void processFrame(const frameSlice& frame);
+
 // Write data to CSV & Array
 
-bleSignal parseDataS(String dataReceived);
+bleSignal parseDataS(const frameSlice& frame);
 
 // Add entry to array
 
 void addEntryToArray(bleSignal entry);
 
+// Find start of last lines in file
+
+size_t findTailOffset(File& file, int lines, int& linesFound);
+
 // Populate array
 
 void populateArrayFromCSV(fs::FS& fs, const char* path, bleSignal* dataEntries, int maxEntries);
 
-// Update table
+// Update table, only changed cells are drawn
 
 void updateTable();
 
+// Redraw the whole table after a dialog has covered it
+
+void redrawTable();
+
 // Clear serial buffer
 
 void clearSerialBuffer();
@@ -61,3 +61,8 @@
 #define WIFI_ICON_W 24
 #define WIFI_ICON_H 24
 
+// Copy progress bar, below the message band.
+#define PROGRESS_X 25
+#define PROGRESS_Y 110
+#define PROGRESS_W 213
+#define PROGRESS_H 12
@@ -0,0 +1,280 @@
+//
+// screenWidgets.cpp
+//
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "screenWidgets.h"
+#include "mainDisplay.h"			// Display layout
+#include "iconAssets.h"				// Icons
+#include "colours.h"				// Colour pallette
+#include "displayPower.h"			// Nothing is drawn while the display is dark
+#include "spiBus.h"					// Shared SPI bus
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+struct iconWidget {
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t h;
+	bool framed;						// Buttons have a border round the icon
+	bool valid;							// False until drawn, or once the screen has been cleared
+	const iconAsset* shown;				// Icon on screen now, nullptr when hidden
+	bool pending;						// Changed while the display was dark
+	const iconAsset* wanted;			// Icon to show on wake
+};
+
+static iconWidget buttons[buttonCount] = {
+	{ BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H, true, false, nullptr, false, nullptr },
+	{ BUTTON2_X, BUTTON2_Y, BUTTON2_W, BUTTON2_H, true, false, nullptr, false, nullptr },
+	{ BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H, true, false, nullptr, false, nullptr },
+	{ BUTTON4_X, BUTTON4_Y, BUTTON4_W, BUTTON4_H, true, false, nullptr, false, nullptr }
+};
+
+static iconWidget statusIcons[statusCount] = {
+	{ PULSE_ICON_X, PULSE_ICON_Y, PULSE_ICON_W, PULSE_ICON_H, false, false, nullptr, false, nullptr },
+	{ SDCARD_ICON_X, SDCARD_ICON_Y, SDCARD_ICON_W, SDCARD_ICON_H, false, false, nullptr, false, nullptr },
+	{ WIFI_ICON_X, WIFI_ICON_Y, WIFI_ICON_W, WIFI_ICON_H, false, false, nullptr, false, nullptr }
+};
+
+static char shownTitle[maxTitleLength + 1];		// Title on screen now
+static bool titleValid = false;
+
+/*---------------------------------------------------------------- */
+
+// Draw an icon widget
+
+static void drawWidget(iconWidget& widget, const iconAsset* icon) {
+
+	busAcquire(busTFT);
+
+	if (icon == nullptr) {
+
+		tft.fillRect(widget.x, widget.y, widget.w, widget.h, WHITE);
+
+	}
+
+	else if (widget.framed) {
+
+		drawIcon(tft, widget.y + 1, widget.x + 1, *icon);
+		tft.drawRect(widget.x, widget.y, widget.w, widget.h, WHITE);
+
+	}
+
+	else drawIcon(tft, widget.y, widget.x, *icon);
+
+	busRelease(busTFT);
+
+	widget.shown = icon;
+	widget.valid = true;
+	widget.pending = false;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Draw an icon widget if what it should show has changed, or leave it for wake when the display is dark
+
+static void updateIcon(iconWidget& widget, const iconAsset* icon) {
+
+	if (widget.valid && !widget.pending && widget.shown == icon) return;
+
+	if (!displayRender(displayWidgets)) {
+
+		widget.pending = true;
+		widget.wanted = icon;
+
+		return;
+	}
+
+	drawWidget(widget, icon);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Show an icon on a button
+
+void setButton(screenButton button, const iconAsset* icon) {
+
+	updateIcon(buttons[button], icon);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Show a status icon
+
+void setStatusIcon(screenStatus status, const iconAsset& icon) {
+
+	updateIcon(statusIcons[status], &icon);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Show a page title
+
+void setTitle(const char* title) {
+
+	if (titleValid && strncmp(shownTitle, title, maxTitleLength) == 0) return;
+
+	drawTitle(title);
+
+	strncpy(shownTitle, title, maxTitleLength);
+	shownTitle[maxTitleLength] = '\0';
+
+	titleValid = true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Check a point against a widget
+
+static bool contains(const iconWidget& widget, uint16_t x, uint16_t y) {
+
+	return (x > widget.x) && (x < (widget.x + widget.w)) && (y > widget.y) && (y <= (widget.y + widget.h));
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Which button is at x, y
+
+screenButton buttonAt(uint16_t x, uint16_t y) {
+
+	for (uint8_t i = 0; i < buttonCount; i++) {
+		if (contains(buttons[i], x, y)) return (screenButton)i;
+	}
+
+	return buttonCount;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Which status icon is at x, y
+
+screenStatus statusIconAt(uint16_t x, uint16_t y) {
+
+	for (uint8_t i = 0; i < statusCount; i++) {
+		if (contains(statusIcons[i], x, y)) return (screenStatus)i;
+	}
+
+	return statusCount;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Main menu, button four is unused
+
+void showMainMenu() {
+
+	setButton(button1, &categoriseEvents);
+	setButton(button2, &manualEntry);
+	setButton(button3, &deleteLastLine);
+	setButton(button4, nullptr);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Category choices for categorising and manual entries
+
+void showCategoryMenu() {
+
+	setButton(button1, &policeCar);
+	setButton(button2, &ambulance);
+	setButton(button3, &fireEngine);
+	setButton(button4, &falsePositive);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Yes / No on buttons three and four
+
+void showYesNo() {
+
+	setButton(button3, &yesPlease);
+	setButton(button4, &noThanks);
+
+} // Close function
+
+void hideYesNo() {
+
+	setButton(button3, nullptr);
+	setButton(button4, nullptr);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Draw a widget that changed while the display was dark, unless it has changed back
+
+static void refreshWidget(iconWidget& widget) {
+
+	if (!widget.pending) return;
+
+	if (widget.valid && widget.shown == widget.wanted) widget.pending = false;
+
+	else drawWidget(widget, widget.wanted);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Draw the widgets that changed while the display was dark
+
+void refreshWidgets() {
+
+	for (iconWidget& widget : buttons) refreshWidget(widget);
+	for (iconWidget& widget : statusIcons) refreshWidget(widget);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Something else has drawn over the title
+
+void invalidateTitle() {
+
+	titleValid = false;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// The screen has been cleared
+
+void invalidateWidgets() {
+
+	for (iconWidget& widget : buttons) widget.valid = false;
+	for (iconWidget& widget : statusIcons) widget.valid = false;
+
+	titleValid = false;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
@@ -0,0 +1,88 @@
+// screenWidgets.h
+
+#ifndef _SCREENWIDGETS_h
+#define _SCREENWIDGETS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "global.h"
+#include "screenLayout.h"			// Screen layout
+#include "drawBitmap.h"				// Icon assets
+
+/*---------------------------------------------------------------- */
+
+// Widgets remember what they show and only draw when it changes. The table is its own
+// widget, see updateTable() and redrawTable().
+
+enum screenButton : uint8_t {		// Buttons down the right hand side
+	button1,
+	button2,
+	button3,
+	button4,
+	buttonCount
+};
+
+enum screenStatus : uint8_t {		// Status icons along the top
+	pulseStatus,
+	sdCardStatus,
+	wiFiStatus,
+	statusCount
+};
+
+const uint8_t maxTitleLength = 24;	// Longest page title
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Show an icon on a button, nullptr hides the button
+
+void setButton(screenButton button, const iconAsset* icon);
+
+// Show a status icon
+
+void setStatusIcon(screenStatus status, const iconAsset& icon);
+
+// Show a page title
+
+void setTitle(const char* title);
+
+// Which button or status icon is at x, y, buttonCount or statusCount when none
+
+screenButton buttonAt(uint16_t x, uint16_t y);
+
+screenStatus statusIconAt(uint16_t x, uint16_t y);
+
+// Button sets
+
+void showMainMenu();
+
+void showCategoryMenu();
+
+void showYesNo();
+
+void hideYesNo();
+
+// Draw the widgets that changed while the display was dark
+
+void refreshWidgets();
+
+// Something else has drawn over the title
+
+void invalidateTitle();
+
+// The screen has been cleared, draw every widget again on its next change
+
+void invalidateWidgets();
+
+#endif
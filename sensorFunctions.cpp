@@ -4,6 +4,7 @@
 #include "sensorFunctions.h"    // Sensor functions
 #include "drawBitmap.h"         // Draw drawBitmap
 #include "global.h"             // Global
+#include "screenWidgets.h"      // Status icons
 
 // Debug serial prints
 
@@ -38,11 +39,11 @@ void sensorCheckCall(boolean interruptDetected, const unsigned long interruptChe
 
             interruptIntervals++;
 
-            drawBitmap(tft, PULSE_ICON_Y, PULSE_ICON_X, pulseAmber, PULSE_ICON_W, PULSE_ICON_H);
+            setStatusIcon(pulseStatus, pulseAmber);
 
             if (interruptIntervals > interruptCount) {
 
-                drawBitmap(tft, PULSE_ICON_Y, PULSE_ICON_X, pulseRed, PULSE_ICON_W, PULSE_ICON_H);
+                setStatusIcon(pulseStatus, pulseRed);
 
                 delay(1500);
 
@@ -71,7 +72,7 @@ void sensorCheckCall(boolean interruptDetected, const unsigned long interruptChe
             interruptDetected = false;
             interruptIntervals = 0;
 
-            drawBitmap(tft, PULSE_ICON_Y, PULSE_ICON_X, pulseGreen, PULSE_ICON_W, PULSE_ICON_H);
+            setStatusIcon(pulseStatus, pulseGreen);
 
         }
     }
@@ -11,7 +11,7 @@
 // Local declarations
 
 #include "global.h"
-#include "icons.h"
+#include "iconAssets.h"
 #include "screenLayout.h"
 
 void sensorCheckCall(boolean interruptDetected,const unsigned long interruptCheckPeriod, const byte interruptCount,byte nanoResetPin);
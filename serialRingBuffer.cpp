@@ -0,0 +1,188 @@
+//
+// serialRingBuffer.cpp
+//
+
+// Main libraries
+
+#include <atomic>
+
+// Local declarations
+
+#include "serialRingBuffer.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+// The first maxFrameLength + 1 bytes of the ring are mirrored past its end, so a frame
+// that wraps around is still one contiguous slice and never needs copying out.
+
+static char ringBuffer[serialRingSize + maxFrameLength + 1];
+
+static const uint32_t ringMask = serialRingSize - 1;
+
+static HardwareSerial* ringPort = nullptr;			// UART feeding the ring
+static std::atomic<uint32_t> ringHead(0);			// Next byte to write, only moved by the UART task
+static std::atomic<uint32_t> ringTail(0);			// Start of the oldest unreleased frame, only moved by the loop
+static std::atomic<uint32_t> droppedBytes(0);		// Bytes lost to a full ring or an over long frame
+static uint32_t scanPosition = 0;					// Next byte to check for '%', loop only
+static bool resynchronising = false;				// Dropping the rest of an over long frame, loop only
+
+/*---------------------------------------------------------------- */
+
+// Attach ring buffer to the UART receive callback
+
+void beginSerialRing(HardwareSerial& port) {
+
+	ringPort = &port;
+
+	// Bytes are moved out of the UART driver as they arrive rather than when loop() gets round to it
+
+	ringPort->onReceive(serialRingReceive);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Move bytes from the UART into the ring buffer, runs on the UART event task
+
+void serialRingReceive() {
+
+	if (ringPort == nullptr) return;
+
+	uint32_t head = ringHead.load(std::memory_order_relaxed);
+
+	while (true) {
+
+		uint32_t tail = ringTail.load(std::memory_order_acquire);
+		uint32_t space = serialRingSize - (head - tail);
+
+		// Ring is full, discard what is left in the UART rather than block
+
+		if (space == 0) {
+
+			while (ringPort->available() > 0) {
+				ringPort->read();
+				droppedBytes++;
+			}
+
+			break;
+		}
+
+		// Read straight into the ring, up to the physical end of the buffer
+
+		uint32_t index = head & ringMask;
+		size_t span = min((size_t)space, (size_t)(serialRingSize - index));
+		size_t count = ringPort->read((uint8_t*)&ringBuffer[index], span);
+
+		if (count == 0) break;
+
+		// Keep the mirror of the start of the ring up to date
+
+		if (index <= maxFrameLength) {
+			memcpy(&ringBuffer[serialRingSize + index], &ringBuffer[index], min(count, (size_t)(maxFrameLength + 1 - index)));
+		}
+
+		head += count;
+		ringHead.store(head, std::memory_order_release);
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Check for unread bytes
+
+bool serialRingAvailable() {
+
+	return scanPosition != ringHead.load(std::memory_order_acquire);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Get the next complete frame, scanning only bytes not seen on a previous call
+
+bool nextFrame(frameSlice& frame) {
+
+	uint32_t head = ringHead.load(std::memory_order_acquire);
+	uint32_t tail = ringTail.load(std::memory_order_relaxed);
+
+	while (scanPosition != head) {
+
+		if (ringBuffer[scanPosition & ringMask] == '%') {
+
+			scanPosition++;
+
+			// The end of a frame that was too long, its tail goes with the rest of it
+
+			if (resynchronising) {
+
+				droppedBytes += scanPosition - tail;
+				tail = scanPosition;
+				ringTail.store(tail, std::memory_order_release);
+				resynchronising = false;
+
+				continue;
+			}
+
+			frame.data = &ringBuffer[tail & ringMask];
+			frame.length = scanPosition - 1 - tail;		// '%' isnt included in the frame
+
+			return true;
+		}
+
+		scanPosition++;
+
+		// No delimiter within the longest frame, drop the bytes and everything up to the next '%'
+
+		if (scanPosition - tail > maxFrameLength) {
+
+			outputDebugLn("Serial frame too long, discarded");
+
+			droppedBytes += scanPosition - tail;
+			tail = scanPosition;
+			ringTail.store(tail, std::memory_order_release);
+			resynchronising = true;
+		}
+	}
+
+	return false;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Release the frame returned by nextFrame, its space can then be reused
+
+void releaseFrame(const frameSlice& frame) {
+
+	uint32_t tail = ringTail.load(std::memory_order_relaxed);
+
+	ringTail.store(tail + frame.length + 1, std::memory_order_release);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Bytes dropped because the ring was full or a frame was too long
+
+uint32_t serialRingDropped() {
+
+	return droppedBytes.load(std::memory_order_relaxed);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
@@ -0,0 +1,54 @@
+// serialRingBuffer.h
+
+#ifndef _SERIALRINGBUFFER_h
+#define _SERIALRINGBUFFER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Ring buffer sizes
+
+const size_t serialRingSize = 512;			// Bytes held from the Nano BLE, must be a power of two
+const size_t maxFrameLength = 64;			// Longest frame accepted from the Nano BLE, '%' excluded
+
+// Frame slice, points straight into the ring buffer and is valid until releaseFrame() is called
+
+struct frameSlice {
+	const char* data;
+	size_t length;
+};
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Attach ring buffer to the UART receive callback
+
+void beginSerialRing(HardwareSerial& port);
+
+// Move bytes from the UART into the ring buffer
+
+void serialRingReceive();
+
+// Check for unread bytes
+
+bool serialRingAvailable();
+
+// Get the next complete frame
+
+bool nextFrame(frameSlice& frame);
+
+// Release the frame returned by nextFrame
+
+void releaseFrame(const frameSlice& frame);
+
+// Bytes dropped because the ring was full or a frame was too long
+
+uint32_t serialRingDropped();
+
+#endif
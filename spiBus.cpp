@@ -0,0 +1,182 @@
+//
+// spiBus.cpp
+//
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "spiBus.h"
+#include "global.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+static SemaphoreHandle_t busMutex = NULL;			// Recursive, a batch can call code that takes the bus again
+
+// Only the task holding the bus touches these
+
+static busDevice owner = busTFT;					// Device the outermost batch is for
+static uint8_t depth = 0;							// Nesting of the current owner
+static uint32_t heldSince = 0;						// When the outermost batch started, micros
+static bool tftBatch = false;						// TFT transaction held open for the batch
+static uint8_t inside = 0;							// Other device batches open inside a TFT batch
+
+static busStats stats[busDeviceCount];
+
+static const uint32_t clocks[busDeviceCount] = { tftClock, touchClock, sdClock };
+static const char* const names[busDeviceCount] = { "tft", "touch", "sd" };
+
+/*---------------------------------------------------------------- */
+
+// Park every chip select high and create the bus lock
+
+void beginSpiBus(uint8_t tftCs, uint8_t touchCs, uint8_t sdCs) {
+
+	// A device with its select floating or low answers transfers meant for another
+
+	const uint8_t selects[busDeviceCount] = { tftCs, touchCs, sdCs };
+
+	for (uint8_t i = 0; i < busDeviceCount; i++) {
+		pinMode(selects[i], OUTPUT);
+		digitalWrite(selects[i], HIGH);
+	}
+
+	if (busMutex == NULL) {
+		busMutex = xSemaphoreCreateRecursiveMutex();
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Take the bus
+
+void busAcquire(busDevice device) {
+
+	if (busMutex == NULL) return;
+
+	uint32_t start = micros();
+
+	xSemaphoreTakeRecursive(busMutex, portMAX_DELAY);
+
+	if (depth++ > 0) {
+
+		// Another device inside a TFT batch, the TFT transaction keeps its chip select low so close it first
+
+		if (owner == busTFT && device != busTFT) {
+
+			inside++;
+
+			if (tftBatch) {
+				tft.endWrite();
+				tftBatch = false;
+			}
+		}
+
+		return;
+	}
+
+	owner = device;
+	heldSince = micros();
+
+	stats[device].acquisitions++;
+	stats[device].waitMicros += heldSince - start;
+
+	// Everything the TFT draws in the batch goes out as one transaction
+
+	if (device == busTFT) {
+		tft.startWrite();
+		tftBatch = true;
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Give the bus back
+
+void busRelease(busDevice device) {
+
+	if (busMutex == NULL || depth == 0) return;
+
+	if (--depth > 0) {
+
+		// Another device is done inside a TFT batch, open the TFT transaction again for the rest of it
+
+		if (owner == busTFT && device != busTFT && inside > 0 && --inside == 0) {
+			tft.startWrite();
+			tftBatch = true;
+		}
+	}
+
+	else {
+
+		if (device != owner) {
+			outputDebugLn("Bus released by a different device to the one that took it");
+		}
+
+		if (tftBatch) {
+			tft.endWrite();
+			tftBatch = false;
+		}
+
+		uint32_t held = micros() - heldSince;
+
+		stats[owner].busyMicros += held;
+
+		if (held > stats[owner].longestMicros) {
+			stats[owner].longestMicros = held;
+		}
+	}
+
+	xSemaphoreGiveRecursive(busMutex);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Clock for a device
+
+uint32_t busClock(busDevice device) {
+
+	return clocks[device];
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Device name
+
+const char* busDeviceName(busDevice device) {
+
+	return names[device];
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Copy of a device's statistics, read without the lock so a figure can be one batch out
+
+busStats busDeviceStats(busDevice device) {
+
+	return stats[device];
+
+} // Close function
+
+/*---------------------------------------------------------------- */
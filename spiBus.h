@@ -0,0 +1,65 @@
+// spiBus.h
+
+#ifndef _SPIBUS_h
+#define _SPIBUS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+/*---------------------------------------------------------------- */
+
+// The TFT, touch controller and SD card share SCK 18 / MISO 19 / MOSI 23. Each user takes the
+// bus for a batch of transfers, so a display update and an SD write never interleave mid batch.
+
+enum busDevice : uint8_t {
+	busTFT,
+	busTouch,
+	busSD,
+	busDeviceCount
+};
+
+// Clocks, the TFT and touch clocks are set in the TFT_eSPI setup and are listed for the statistics
+
+const uint32_t tftClock = 40000000;
+const uint32_t touchClock = 2500000;
+const uint32_t sdClock = 20000000;				// SD library default is 4 MHz, drop back if a card is unreliable
+
+struct busStats {								// Per device occupancy
+	uint32_t acquisitions;						// Batches
+	uint64_t busyMicros;						// Time holding the bus
+	uint64_t waitMicros;						// Time waiting for another device to finish
+	uint32_t longestMicros;						// Longest single batch
+};
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Park every chip select high and create the bus lock, call first in setup()
+
+void beginSpiBus(uint8_t tftCs, uint8_t touchCs, uint8_t sdCs);
+
+// Take the bus for a batch of transfers, batches may nest within one task
+
+void busAcquire(busDevice device);
+
+// Give the bus back
+
+void busRelease(busDevice device);
+
+// Clock for a device
+
+uint32_t busClock(busDevice device);
+
+// Device name
+
+const char* busDeviceName(busDevice device);
+
+// Copy of a device's statistics
+
+busStats busDeviceStats(busDevice device);
+
+#endif
@@ -0,0 +1,358 @@
+//
+// statsRollup.cpp
+//
+
+// Main libraries
+
+#include <FS.h>						// Files system library
+
+// Local declarations
+
+#include "statsRollup.h"
+#include "fileOperations.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// File name
+
+const char* statsFileName = "/stats.bin";			// Counts per hour, day and category, rebuilt from the log if lost
+
+const char statsCategoryNames[statsCategories] = { 'U', 'P', 'A', 'F', 'O', 'M' };
+
+// Variables
+
+static statsRollup stats;							// Copy of the file
+static fs::FS* statsFs = nullptr;					// File system the file lives on
+static bool statsActive = false;					// There is a log to count
+static uint32_t statsChanges = 0;					// Changes since it was last saved
+static unsigned long statsSavedAt = 0;				// millis() of the last save
+static bool statsRecount = false;					// Counting the log from the start, saved as soon as it is done
+
+/*---------------------------------------------------------------- */
+
+// Empty the rollup, statsPoll counts the log again from the start
+
+static void resetStats() {
+
+	memset(&stats, 0, sizeof(stats));
+	memcpy(stats.magic, "SMRS", 4);
+	stats.version = statsVersion;
+
+	statsChanges++;
+	statsRecount = true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Category slot of a record, manual entries are counted on their own
+
+static uint8_t categoryIndex(char category, uint8_t flags) {
+
+	if (flags & logFlagManual) return statsCategories - 1;
+
+	for (uint8_t i = 0; i < statsCategories - 1; i++) {
+		if (statsCategoryNames[i] == category) return i;
+	}
+
+	return 0;			// Anything unknown counts as uncategorised
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Find the bucket for an hour or day, a slot holding an older period is cleared when create is set.
+// Periods that have already dropped out of the window have no bucket.
+
+static statsBucket* findBucket(statsBucket* buckets, uint8_t slots, uint32_t key, uint32_t newest, bool create) {
+
+	if (key + slots <= newest) return nullptr;
+
+	statsBucket& bucket = buckets[key % slots];
+
+	if (bucket.key != key) {
+
+		if (!create) return nullptr;
+
+		memset(&bucket, 0, sizeof(bucket));
+		bucket.key = key;
+	}
+
+	return &bucket;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Add a record to, or take it away from, its total, hour and day
+
+static void countRecord(const binaryLogRecord& record, bool add) {
+
+	uint8_t category = categoryIndex(record.category, record.flags);
+	uint32_t hour = record.epoch / 3600;
+
+	if (add && hour > stats.newestHour) stats.newestHour = hour;
+
+	statsBucket* buckets[2] = {
+		findBucket(stats.hours, statsHours, hour, stats.newestHour, add),
+		findBucket(stats.days, statsDays, hour / 24, stats.newestHour / 24, add)
+	};
+
+	statsTotal& total = stats.totals[category];
+
+	if (add) {
+
+		total.count++;
+		total.confidence += record.confidence;
+
+		for (statsBucket* bucket : buckets) {
+
+			if (!bucket) continue;
+
+			bucket->count[category]++;
+			bucket->confidence += record.confidence;
+		}
+	}
+
+	else {
+
+		if (total.count) total.count--;
+		total.confidence -= min(total.confidence, (uint32_t)record.confidence);
+
+		for (statsBucket* bucket : buckets) {
+
+			if (!bucket) continue;
+
+			if (bucket->count[category]) bucket->count[category]--;
+			bucket->confidence -= min(bucket->confidence, (uint32_t)record.confidence);
+		}
+	}
+
+	statsChanges++;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Write the rollup to the card
+
+static void saveStats() {
+
+	binaryLogRecord tail = {};
+
+	if (stats.covered > 0) binaryLogReadRecord(stats.covered - 1, tail);
+
+	stats.tailCrc = tail.crc;
+	stats.logEdits = binaryLogEdits();
+	stats.crc = crc32(&stats, offsetof(statsRollup, crc));
+
+	File file = statsFs->open(statsFileName, FILE_WRITE);
+
+	if (!file) {
+		outputDebugLn("Failed to open stats file for writing");
+		return;
+	}
+
+	if (file.write((const uint8_t*)&stats, sizeof(stats)) == sizeof(stats)) {
+		statsChanges = 0;
+		statsSavedAt = millis();
+		statsRecount = false;
+	}
+
+	file.close();
+
+	outputDebugLn("Stats saved");
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Load the rollup, a missing or stale file is rebuilt from the log by statsPoll
+
+void statsBegin(fs::FS& fs) {
+
+	statsFs = &fs;
+	statsActive = binaryLogReady();
+
+	if (!statsActive) return;
+
+	File file = fs.open(statsFileName, FILE_READ);
+
+	bool loaded = file && file.read((uint8_t*)&stats, sizeof(stats)) == sizeof(stats)
+		&& memcmp(stats.magic, "SMRS", 4) == 0
+		&& stats.version == statsVersion
+		&& stats.crc == crc32(&stats, offsetof(statsRollup, crc))
+		&& stats.covered <= binaryLogCount()
+		&& stats.logEdits == binaryLogEdits();		// Records changed or cut since it was saved
+
+	if (file) file.close();
+
+	// The last record counted must still be the same record, otherwise the log was rebuilt under it
+
+	if (loaded && stats.covered > 0) {
+
+		binaryLogRecord tail = {};
+
+		binaryLogReadRecord(stats.covered - 1, tail);
+
+		loaded = tail.crc == stats.tailCrc;
+	}
+
+	statsSavedAt = millis();
+
+	if (loaded) {
+
+		statsChanges = 0;
+		statsRecount = false;
+
+		outputDebug("Stats loaded, records counted: ");
+		outputDebugLn(stats.covered);
+	}
+
+	else {
+
+		resetStats();
+
+		outputDebugLn("Stats missing or stale, rebuilding from the log");
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// A record was appended, only counted if every record before it has been
+
+void statsAdd(uint32_t index, const binaryLogRecord& record) {
+
+	if (!statsActive || index != stats.covered) return;
+
+	countRecord(record, true);
+	stats.covered++;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// A record is about to be cut from the end of the log
+
+void statsRemove(uint32_t index, const binaryLogRecord& record) {
+
+	if (!statsActive || index >= stats.covered) return;
+
+	countRecord(record, false);
+	stats.covered = index;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// A record is about to change category, record still holds the old one
+
+void statsSetCategory(uint32_t index, const binaryLogRecord& record, char category) {
+
+	if (!statsActive || index >= stats.covered) return;
+
+	uint8_t from = categoryIndex(record.category, record.flags);
+	uint8_t to = categoryIndex(category, record.flags);
+
+	if (from == to) return;
+
+	// Buckets keep one confidence sum for every category, the totals keep one each
+
+	statsTotal& oldTotal = stats.totals[from];
+	statsTotal& newTotal = stats.totals[to];
+
+	oldTotal.count -= min(oldTotal.count, (uint32_t)1);
+	oldTotal.confidence -= min(oldTotal.confidence, (uint32_t)record.confidence);
+
+	newTotal.count++;
+	newTotal.confidence += record.confidence;
+
+	uint32_t hour = record.epoch / 3600;
+
+	statsBucket* buckets[2] = {
+		findBucket(stats.hours, statsHours, hour, stats.newestHour, false),
+		findBucket(stats.days, statsDays, hour / 24, stats.newestHour / 24, false)
+	};
+
+	for (statsBucket* bucket : buckets) {
+
+		if (!bucket) continue;
+
+		if (bucket->count[from]) bucket->count[from]--;
+		bucket->count[to]++;
+	}
+
+	statsChanges++;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Catch up with the log a slice at a time and save any changes, returns true once every record is counted
+
+bool statsPoll() {
+
+	if (!statsActive) return true;
+
+	lockStorage();
+
+	uint32_t count = binaryLogCount();
+
+	if (stats.covered > count) resetStats();		// The log shrank without telling us
+
+	for (uint16_t i = 0; i < statsRebuildSlice && stats.covered < count; i++) {
+
+		binaryLogRecord record;
+
+		if (binaryLogReadRecord(stats.covered, record)) countRecord(record, true);
+
+		stats.covered++;
+		statsChanges++;
+	}
+
+	bool ready = stats.covered == count;
+
+	// A recount is saved once caught up, after that only a batch of changes or a while, as each
+	// save rewrites the whole file. A restart in between counts the new records again from the
+	// log, or all of it if a record was changed or cut.
+
+	bool due = statsRecount || statsChanges >= statsSaveChanges || millis() - statsSavedAt >= statsSaveInterval;
+
+	if (ready && statsChanges && due) saveStats();
+
+	unlockStorage();
+
+	return ready;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Read the rollup, storage must be locked
+
+const statsRollup& statsData() {
+
+	return stats;
+
+} // Close function
+
+bool statsReady() {
+
+	return statsActive && stats.covered == binaryLogCount();
+
+} // Close function
+
+/*---------------------------------------------------------------- */
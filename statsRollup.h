@@ -0,0 +1,89 @@
+// statsRollup.h
+
+#ifndef _STATSROLLUP_h
+#define _STATSROLLUP_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Main libraries
+
+#include <FS.h>						// Files system library
+
+// Local declarations
+
+#include "binaryLog.h"
+
+/*---------------------------------------------------------------- */
+
+// File name
+
+extern const char* statsFileName;
+
+// Layout
+
+const uint16_t statsVersion = 2;
+const uint8_t statsCategories = 6;			// U, P, A, F, O, then M for manual entries
+const uint8_t statsHours = 168;				// One week of hourly buckets
+const uint8_t statsDays = 31;				// One month of daily buckets
+const uint16_t statsRebuildSlice = 512;		// Records counted per turn while catching up with the log
+const uint16_t statsSaveChanges = 64;		// Changes that are saved straight away, fewer wait for statsSaveInterval
+const unsigned long statsSaveInterval = 900000;	// 15 minutes, a restart before then recounts from the log
+
+extern const char statsCategoryNames[statsCategories];
+
+struct statsBucket {						// Rows in one hour or one day
+	uint32_t key;							// Hour or day number since 1970, 0 when empty
+	uint16_t count[statsCategories];		// Rows per category
+	uint32_t confidence;					// Sum of the confidence of every row
+};
+
+struct statsTotal {							// Rows in one category since the log began
+	uint32_t count;
+	uint32_t confidence;					// Sum of the confidence of every row
+};
+
+struct statsRollup {						// Whole store, kept in RAM and saved to the card as is
+	char magic[4];							// "SMRS"
+	uint16_t version;						// statsVersion
+	uint16_t reserved;
+	uint32_t covered;						// Log records counted, records from here on are not
+	uint32_t tailCrc;						// CRC of record covered - 1, ties the file to the log it was built from
+	uint32_t logEdits;						// binaryLogEdits() when saved, a change since means a rebuild
+	uint32_t newestHour;					// Latest hour seen, the week of buckets ends here
+	statsTotal totals[statsCategories];
+	statsBucket hours[statsHours];			// Hour k lives in slot k % statsHours
+	statsBucket days[statsDays];			// Day k lives in slot k % statsDays
+	uint32_t crc;							// CRC32 of everything above
+};
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Load the rollup, a missing or stale file is rebuilt from the log by statsPoll
+
+void statsBegin(fs::FS& fs);
+
+// Log changes, called by the binary log with storage locked
+
+void statsAdd(uint32_t index, const binaryLogRecord& record);
+
+void statsRemove(uint32_t index, const binaryLogRecord& record);
+
+void statsSetCategory(uint32_t index, const binaryLogRecord& record, char category);
+
+// Catch up with the log and save any changes, returns true once every record is counted
+
+bool statsPoll();
+
+// Read the rollup, storage must be locked
+
+const statsRollup& statsData();
+
+bool statsReady();
+
+#endif
@@ -0,0 +1,97 @@
+//
+// bench_binaryLog.cpp
+//
+// Read and write cost of the binary log: converting a CSV file, appending, the start up check,
+// the table tail and the CSV export through the buffer sizes the web server hands out
+//
+
+#include <SD.h>
+#include <vector>
+
+#include "host.h"
+#include "binaryLog.h"
+
+/*---------------------------------------------------------------- */
+
+static const int rows = 100000;
+
+static bleSignal entry(int i) {
+
+	char line[64];
+	int length = snprintf(line, sizeof(line), "Title %d,%02d-03-2024,08:%02d:%02d,%c,%d%%",
+		i % 12, 1 + i / 3600 % 28, i / 60 % 60, i % 60, "UPAFO"[i % 5], i % 101);
+
+	return parseCSVLine(line, length);
+}
+
+static void report(const char* name, double seconds, int count, const char* unit) {
+
+	printf("%-28s %10.3f ms %12.0f %s/s   read %9lu B  written %9lu B  seeks %7lu\n", name, seconds * 1e3,
+		count / seconds, unit, hostfs::bytesRead, hostfs::bytesWritten, hostfs::seeks);
+
+	hostfs::bytesRead = hostfs::bytesWritten = hostfs::seeks = 0;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	std::string csv;
+
+	for (int i = 0; i < rows; i++) {
+		char line[64];
+		formatCSVLine(entry(i), line, sizeof(line));
+		csv += std::string(line) + "\r\n";
+	}
+
+	hostfs::reset();
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(csv);
+
+	double start = hostSeconds();
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	report("convert CSV", hostSeconds() - start, rows, "rows");
+
+	start = hostSeconds();
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	report("start up check", hostSeconds() - start, 1, "opens");
+
+	const int appends = 10000;
+
+	start = hostSeconds();
+	for (int i = 0; i < appends; i++) binaryLogAppend(entry(rows + i));
+	binaryLogSync();
+	report("append", hostSeconds() - start, appends, "records");
+
+	bleSignal entries[maxEntries];
+	const int tails = 10000;
+
+	start = hostSeconds();
+	for (int i = 0; i < tails; i++) binaryLogTail(entries, maxEntries);
+	report("table tail", hostSeconds() - start, tails, "reads");
+
+	// The export through each buffer size, a line split across buffers is read from the log twice
+
+	for (size_t size : { 64, 536, 1460, 4096 }) {
+
+		std::vector<char> buffer(size);
+		exportCursor cursor;
+		size_t sent = 0;
+
+		start = hostSeconds();
+		while (size_t length = binaryLogExportCSV(buffer.data(), size, cursor)) sent += length;
+		double seconds = hostSeconds() - start;
+
+		char name[32];
+		snprintf(name, sizeof(name), "export, %zu byte buffers", size);
+
+		printf("%-28s %10.3f ms %12.2f MB/s  read %9lu B  sent %12zu B  seeks %7lu\n", name, seconds * 1e3,
+			sent / seconds / 1e6, hostfs::bytesRead, sent, hostfs::seeks);
+
+		hostfs::bytesRead = hostfs::bytesWritten = hostfs::seeks = 0;
+
+		CHECK(cursor.next == rows + appends);
+	}
+
+	return HOST_RESULT();
+
+} // Close function
@@ -0,0 +1,198 @@
+//
+// bench_bleSignal.cpp
+//
+// Heap use and copy cost of the fixed width bleSignal against the five String record it replaced.
+// The old record is rebuilt here on a String modelled on the ESP32 core's WString, which keeps up
+// to 14 characters inline and puts anything longer on the heap, so the counts match the board
+//
+
+#include <vector>
+
+#include "host.h"
+#include "fileOperations.h"
+#include "parseDataReceived.h"
+
+/*---------------------------------------------------------------- */
+
+// WString storage: inline buffer for short strings, heap buffer grown on demand for long ones
+
+class legacyString {
+public:
+	legacyString() {}
+	legacyString(const legacyString& other) { assign(other.buffer(), other.length); }
+	legacyString(const char* text, size_t n) { assign(text, n); }
+	~legacyString() { delete[] heap; }
+
+	legacyString& operator=(const legacyString& other) { if (this != &other) assign(other.buffer(), other.length); return *this; }
+
+	const char* buffer() const { return heap ? heap : inline_; }
+	size_t size() const { return length; }
+
+	int indexOf(char c, size_t from = 0) const {
+		const char* p = from < length ? (const char*)memchr(buffer() + from, c, length - from) : nullptr;
+		return p ? p - buffer() : -1;
+	}
+
+	legacyString substring(size_t from, size_t to) const {
+		to = min(to, length);
+		return legacyString(buffer() + from, to > from ? to - from : 0);
+	}
+
+	void trim() {
+		const char* b = buffer();
+		size_t start = 0, end = length;
+		while (start < end && isspace((unsigned char)b[start])) start++;
+		while (end > start && isspace((unsigned char)b[end - 1])) end--;
+		memmove((char*)b, b + start, end - start);
+		length = end - start;
+		((char*)b)[length] = '\0';
+	}
+
+	void concat(const char* text, size_t n) {
+		reserve(length + n);
+		memcpy((char*)buffer() + length, text, n);
+		length += n;
+		((char*)buffer())[length] = '\0';
+	}
+
+private:
+	static const size_t inlineLength = 14;
+
+	char inline_[inlineLength + 1] = {};
+	char* heap = nullptr;
+	size_t capacity = inlineLength;
+	size_t length = 0;
+
+	void reserve(size_t n) {
+		if (n <= capacity) return;
+		char* grown = new char[n + 1];
+		memcpy(grown, buffer(), length + 1);
+		delete[] heap;
+		heap = grown;
+		capacity = n;
+	}
+
+	void assign(const char* text, size_t n) {
+		reserve(n);
+		memmove((char*)buffer(), text, n);
+		length = n;
+		((char*)buffer())[n] = '\0';
+	}
+};
+
+struct legacySignal {
+	legacyString title, date, time, category, percentage;
+};
+
+// The old parseCSVLine(), addEntryToArray() and toCSVLine()
+
+static legacySignal legacyParse(const legacyString& line) {
+
+	legacySignal data;
+	int start = 0, end = line.indexOf(',');
+
+	data.title = line.substring(start, end); data.title.trim();
+	start = end + 1; end = line.indexOf(',', start);
+	data.date = line.substring(start, end); data.date.trim();
+	start = end + 1; end = line.indexOf(',', start);
+	data.time = line.substring(start, end); data.time.trim();
+	start = end + 1; end = line.indexOf(',', start);
+	data.category = line.substring(start, end); data.category.trim();
+	start = end + 1;
+	data.percentage = line.substring(start, line.size()); data.percentage.trim();
+
+	return data;
+}
+
+static legacySignal legacyEntries[maxEntries];
+
+static void legacyAdd(legacySignal entry) {
+
+	for (int i = maxEntries - 1; i > 0; i--) legacyEntries[i] = legacyEntries[i - 1];
+	legacyEntries[0] = entry;
+}
+
+static legacyString legacyFormat(const legacySignal& data) {
+
+	legacyString line = data.title;
+	const legacyString* rest[] = { &data.date, &data.time, &data.category, &data.percentage };
+
+	for (const legacyString* field : rest) {
+		line.concat(",", 1);
+		line.concat(field->buffer(), field->size());
+	}
+
+	return line;
+}
+
+/*---------------------------------------------------------------- */
+
+struct result {
+	double seconds;
+	unsigned long allocations;
+	unsigned long bytes;
+};
+
+static const int records = 200000;
+
+// Parse a line, push it onto the ten row array and format it back, as a received detection does
+
+template <typename Work>
+static result measure(Work work) {
+
+	unsigned long allocations = hostAllocations, bytes = hostAllocatedBytes;
+	double start = hostSeconds();
+
+	for (int i = 0; i < records; i++) work(i);
+
+	return { hostSeconds() - start, hostAllocations - allocations, hostAllocatedBytes - bytes };
+}
+
+static void report(const char* name, size_t recordSize, const result& r) {
+
+	printf("%-10s %3zu bytes/record %7.2f allocations/detection %8.1f heap bytes/detection %7.1f ns/detection\n",
+		name, recordSize, (double)r.allocations / records, (double)r.bytes / records, r.seconds * 1e9 / records);
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	// Titles either side of the 14 character inline limit, as the transmitters send them
+
+	const char* lines[] = {
+		"Siren,12-03-2024,08:15:02,U,87%",
+		"Fire Alarm,12-03-2024,08:16:40,F,92%",
+		"Smoke Alarm Kitchen,12-03-2024,09:01:13,A,64%",
+		"Ambulance Siren,12-03-2024,10:22:51,P,71%",
+	};
+
+	std::vector<legacyString> legacyLines;
+	for (const char* line : lines) legacyLines.push_back(legacyString(line, strlen(line)));
+
+	size_t volatile sink = 0;
+
+	result fixed = measure([&](int i) {
+		const char* line = lines[i & 3];
+		addEntryToArray(parseCSVLine(line, strlen(line)));
+		char csv[80];
+		sink += formatCSVLine(dataEntries[0], csv, sizeof(csv));
+	});
+
+	result legacy = measure([&](int i) {
+		legacyAdd(legacyParse(legacyLines[i & 3]));
+		sink += legacyFormat(legacyEntries[0]).size();
+	});
+
+	report("bleSignal", sizeof(bleSignal), fixed);
+	report("String", 5 * 16, legacy);			// WString is 16 bytes on the board
+
+	// The point of the change: nothing on the heap, whatever the title length
+
+	CHECK(fixed.allocations == 0);
+	CHECK(legacy.allocations > 0);
+	CHECK(strcmp(dataEntries[0].title, legacyEntries[0].title.buffer()) == 0);
+
+	return HOST_RESULT();
+
+} // Close function
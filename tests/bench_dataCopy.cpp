@@ -0,0 +1,77 @@
+//
+// bench_dataCopy.cpp
+//
+// Backup copy throughput in MB/s and SD calls per MB, a byte at a time as the copy used to run
+// against copyBufferSize blocks through dataCopyStep()
+//
+
+#include <SD.h>
+
+#include "host.h"
+#include "fileOperations.h"
+
+/*---------------------------------------------------------------- */
+
+static void report(const char* name, size_t bytes, double seconds) {
+
+	double megabytes = bytes / 1e6;
+
+	printf("%-24s %8.1f MB/s   %9.0f reads/MB %9.0f writes/MB\n", name, megabytes / seconds,
+		hostfs::readCalls / megabytes, hostfs::writeCalls / megabytes);
+
+	hostfs::readCalls = hostfs::writeCalls = 0;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	for (size_t size : { 1000000, 10000000 }) {
+
+		std::string csv;
+
+		while (csv.size() < size) csv += "Smoke Alarm,12-03-2024,09:01:13,A,64%\r\n";
+
+		printf("%zu byte data file\n", csv.size());
+
+		// The old copy loop
+
+		hostfs::reset();
+		hostfs::files["/data.csv"] = std::make_shared<std::string>(csv);
+
+		double start = hostSeconds();
+
+		File source = SD.open("/data.csv", FILE_READ);
+		File target = SD.open("/data1.csv", FILE_WRITE);
+
+		while (source.available()) target.write(source.read());
+
+		source.close();
+		target.close();
+
+		report("  byte at a time", csv.size(), hostSeconds() - start);
+
+		CHECK(*hostfs::files["/data1.csv"] == csv);
+
+		// dataCopyStep() until it finishes
+
+		hostfs::reset();
+		hostfs::files["/data.csv"] = std::make_shared<std::string>(csv);
+
+		start = hostSeconds();
+
+		CHECK(beginDataCopy(SD, "/data.csv"));
+
+		copyStatus status;
+
+		while ((status = dataCopyStep()) == copyRunning) {}
+
+		report("  dataCopyStep()", csv.size(), hostSeconds() - start);
+
+		CHECK(status == copyDone);
+		CHECK(*hostfs::files["/data1.csv"] == csv);
+	}
+
+	return HOST_RESULT();
+
+} // Close function
@@ -0,0 +1,117 @@
+//
+// bench_drawBitmap.cpp
+//
+// Pixel throughput of drawBitmap() against the drawPixel() loop it replaced, and of drawIcon() on
+// the compressed assets. The display stand in counts bus transactions, address windows and pixels,
+// and the bytes those put on the wire give the throughput on a 40 MHz SPI bus. Host time is shown
+// too, it is the cost of the code around the bus.
+//
+
+#include <vector>
+
+#include "host.h"
+#include "drawBitmap.h"
+#include "iconAssets.h"
+
+/*---------------------------------------------------------------- */
+
+static TFT_eSPI tft;
+
+// The loop drawBitmap() used before it pushed one window
+
+static void drawBitmapByPixel(TFT_eSPI& tft, int x, int y, const uint16_t* bitmap, int bw, int bh) {
+
+	int index = 0;
+
+	for (int row = x; row < x + bh; row++) {
+		for (int col = y; col < y + bw; col++) {
+			tft.drawPixel(col, row, pgm_read_word(bitmap + index++));
+		}
+	}
+}
+
+// An address window is CASET, PASET and RAMWR with 8 data bytes, pixels are 2 bytes each
+
+static void report(const char* name, int draws, uint32_t pixels, double seconds) {
+
+	const tftCounters& c = tft.counters;
+	double busSeconds = (c.windows * 11.0 + c.pixels * 2.0) * 8 / 40e6;
+
+	printf("%-30s %6.2f Mpixel/s bus %8.1f Mpixel/s host %6lu transactions %6lu windows per draw\n",
+		name, c.pixels / busSeconds / 1e6, (double)pixels * draws / seconds / 1e6, c.transactions / draws, c.windows / draws);
+
+	tft.counters = {};
+}
+
+template <typename Draw>
+static double timed(int draws, Draw draw) {
+
+	tft.counters = {};
+
+	double start = hostSeconds();
+	for (int i = 0; i < draws; i++) draw();
+	return hostSeconds() - start;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	// The start screen icon, decoded so both bitmap paths get the same pixels
+
+	const iconAsset& icon = startScreen;
+	const int w = icon.width, h = icon.height, draws = 50;
+
+	drawIcon(tft, 0, 0, icon);
+
+	std::vector<uint16_t> bitmap(w * h);
+
+	for (int row = 0; row < h; row++) {
+		for (int col = 0; col < w; col++) bitmap[row * w + col] = tft.pixel(col, row);
+	}
+
+	printf("%d x %d bitmap\n", w, h);
+
+	double seconds = timed(draws, [&] { drawBitmapByPixel(tft, 0, 0, bitmap.data(), w, h); });
+	report("  drawPixel() loop", draws, w * h, seconds);
+
+	seconds = timed(draws, [&] { drawBitmap(tft, 0, 0, bitmap.data(), w, h); });
+	report("  drawBitmap()", draws, w * h, seconds);
+
+	seconds = timed(draws, [&] { drawIcon(tft, 0, 0, icon); });
+	report("  drawIcon()", draws, w * h, seconds);
+
+	// The status and menu icons, drawn as often as the screen changes
+
+	struct { const char* name; const iconAsset& icon; } small[] = {
+		{ "wiFiGreen", wiFiGreen }, { "pulseRed", pulseRed }, { "sdCardGreen", sdCardGreen },
+		{ "policeCar", policeCar }, { "categoriseEvents", categoriseEvents },
+	};
+
+	for (auto& i : small) {
+
+		char name[40];
+		snprintf(name, sizeof(name), "  drawIcon() %s", i.name);
+
+		seconds = timed(1000, [&] { drawIcon(tft, 0, 0, i.icon); });
+		report(name, 1000, i.icon.width * i.icon.height, seconds);
+	}
+
+	// Same picture both ways, sent through one window
+
+	tft.fillScreen(0);
+	drawBitmapByPixel(tft, 0, 0, bitmap.data(), w, h);
+
+	std::vector<uint16_t> expected(tft.pixelsOut, tft.pixelsOut + TFT_eSPI::frameWidth * TFT_eSPI::frameHeight);
+
+	tft.fillScreen(0);
+	tft.counters = {};
+	drawBitmap(tft, 0, 0, bitmap.data(), w, h);
+
+	CHECK(std::equal(expected.begin(), expected.end(), tft.pixelsOut));
+	CHECK(tft.counters.windows == 1);
+	CHECK(tft.counters.pixels == (unsigned long)(w * h));
+
+	return HOST_RESULT();
+
+} // Close function
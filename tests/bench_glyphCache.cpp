@@ -0,0 +1,190 @@
+//
+// bench_glyphCache.cpp
+//
+// Render time of drawText() before and after beginGlyphCache(), for a full table of cells and the
+// status line. Without the cache the library draws each character in its own window, with it the
+// whole padded string goes out as one block. Bus time is for a 40 MHz SPI bus, as in bench_drawBitmap.
+//
+// Most of that time is pixel data, which one window per string doesnt reduce. So the table is also
+// run as updateTable() sees it, a detection arriving and every row moving down one, with each changed
+// cell drawn whole and then with drawTextOver() sending only the characters that differ.
+//
+
+#include <vector>
+
+#include "host.h"
+#include "glyphCache.h"
+#include "colours.h"
+#include "fileOperations.h"
+
+/*---------------------------------------------------------------- */
+
+static const char* statusLine = "Last updated: 12-03-2024 08:15";
+
+static const bleSignal rows[] = {
+	{ "Siren", "12-03-2024", "08:15:02", "U", "87%" },
+	{ "Fire Alarm", "12-03-2024", "08:16:40", "F", "92%" },
+	{ "Doorbell", "12-03-2024", "08:17:03", "ME-A", "100%" },
+};
+
+// Every cell of the table as updateTable() draws it, then the status line as printLocalTime() does
+
+static void drawScreen() {
+
+	for (int i = 0; i < maxEntries; i++) {
+
+		const bleSignal& entry = rows[i % 3];
+		int y = 60 + i * 13;
+
+		drawText(15, y, entry.time, BLACK, WHITE, sizeof(entry.time) - 1);
+		drawText(80, y, entry.date, BLACK, WHITE, sizeof(entry.date) - 1);
+		drawText(155, y, entry.category, BLACK, WHITE, sizeof(entry.category) - 1);
+		drawText(195, y, entry.percentage, BLACK, WHITE, sizeof(entry.percentage) - 1);
+	}
+
+	drawText(13, 220, statusLine, BLACK, WHITE, 39);
+
+} // Close function
+
+static const int strings = maxEntries * 4 + 1;
+
+// An address window is CASET, PASET and RAMWR with 8 data bytes, pixels are 2 bytes each
+
+static double report(const char* name, int draws, double seconds) {
+
+	const tftCounters& c = tft.counters;
+	double busSeconds = (c.windows * 11.0 + c.pixels * 2.0) * 8 / 40e6 / draws;
+
+	printf("%-16s %7.2f ms/screen bus %7.1f us/screen host %5lu transactions %5lu windows per screen\n",
+		name, busSeconds * 1e3, seconds * 1e6 / draws, c.transactions / draws, c.windows / draws);
+
+	return busSeconds;
+}
+
+template <typename Draw>
+static double timed(int draws, Draw draw) {
+
+	tft.counters = {};
+
+	double start = hostSeconds();
+	for (int i = 0; i < draws; i++) draw();
+	return hostSeconds() - start;
+}
+
+// Detection k, 37 s after the one before, from 08:00:00
+
+static bleSignal arrival(int k) {
+
+	bleSignal entry = {};
+	int seconds = 8 * 3600 + k * 37;
+
+	snprintf(entry.time, sizeof(entry.time), "%02u:%02u:%02u", (unsigned)seconds / 3600 % 24, (unsigned)seconds / 60 % 60, (unsigned)seconds % 60);
+	snprintf(entry.date, sizeof(entry.date), "%02u-03-2024", 12u + (unsigned)k / 2000);
+	snprintf(entry.category, sizeof(entry.category), (k % 7) ? "%c" : "ME-%c", "UPAFO"[k % 5]);
+	snprintf(entry.percentage, sizeof(entry.percentage), "%u%%", 40u + (unsigned)k * 13 % 61);
+
+	return entry;
+}
+
+// Each detection moves the rows down one, then the cells that changed are drawn as updateTable() does
+
+static bleSignal entries[maxEntries];
+static bleSignal shown[maxEntries];
+
+static void arrive(int k, bool over) {
+
+	memmove(&entries[1], &entries[0], sizeof(bleSignal) * (maxEntries - 1));
+	entries[0] = arrival(k);
+
+	for (int i = 0; i < maxEntries; i++) {
+
+		int y = 60 + i * 13;
+
+		const char* now[] = { entries[i].time, entries[i].date, entries[i].category, entries[i].percentage };
+		const char* was[] = { shown[i].time, shown[i].date, shown[i].category, shown[i].percentage };
+		const int x[] = { 15, 80, 155, 195 };
+		const uint8_t width[] = { sizeof(entries[i].time) - 1, sizeof(entries[i].date) - 1, sizeof(entries[i].category) - 1, sizeof(entries[i].percentage) - 1 };
+
+		for (int cell = 0; cell < 4; cell++) {
+
+			if (strcmp(now[cell], was[cell]) == 0) continue;
+
+			if (over) drawTextOver(x[cell], y, now[cell], was[cell], BLACK, WHITE, width[cell]);
+			else drawText(x[cell], y, now[cell], BLACK, WHITE, width[cell]);
+		}
+
+		shown[i] = entries[i];
+	}
+}
+
+// A blank table then a run of detections, the screen it leaves is kept in frame
+
+static double arrivals(const char* name, int count, bool over, std::vector<uint16_t>& frame) {
+
+	memset(entries, 0, sizeof(entries));
+	memset(shown, 0, sizeof(shown));
+
+	for (int i = 0; i < TFT_eSPI::frameWidth * TFT_eSPI::frameHeight; i++) tft.pixelsOut[i] = WHITE;
+
+	int k = 0;
+
+	double seconds = timed(count, [&] { arrive(k++, over); });
+	double busSeconds = report(name, count, seconds);
+
+	frame.assign(tft.pixelsOut, tft.pixelsOut + TFT_eSPI::frameWidth * TFT_eSPI::frameHeight);
+
+	return busSeconds;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	const int draws = 200;
+
+	printf("%d strings per screen\n", strings);
+
+	// Before the cache is built drawText() prints through the library
+
+	double seconds = timed(draws, drawScreen);
+	double direct = report("  library", draws, seconds);
+	unsigned long directWindows = tft.counters.windows / draws;
+
+	std::vector<uint16_t> printed(tft.pixelsOut, tft.pixelsOut + TFT_eSPI::frameWidth * TFT_eSPI::frameHeight);
+
+	beginGlyphCache();
+
+	memset(tft.pixelsOut, 0, sizeof(tft.pixelsOut));
+
+	seconds = timed(draws, drawScreen);
+	double cached = report("  glyph cache", draws, seconds);
+
+	printf("  %.1fx faster on the bus\n", direct / cached);
+
+	// Same pixels either way, one window per string instead of one per character
+
+	CHECK(std::equal(printed.begin(), printed.end(), tft.pixelsOut));
+	CHECK(tft.counters.windows / draws == strings);
+	CHECK(tft.counters.transactions / draws == strings);
+	CHECK(directWindows > strings);
+	CHECK(cached < direct);
+
+	// A detection arriving, per update rather than per screen
+
+	printf("%d detections arriving\n", draws);
+
+	std::vector<uint16_t> wholeFrame, overFrame;
+
+	double whole = arrivals("  whole cells", draws, false, wholeFrame);
+	double over = arrivals("  changed chars", draws, true, overFrame);
+
+	printf("  %.1fx faster on the bus\n", whole / over);
+
+	// Same screen after the run either way
+
+	CHECK(wholeFrame == overFrame);
+	CHECK(over < whole);
+
+	return HOST_RESULT();
+
+} // Close function
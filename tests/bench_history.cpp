@@ -0,0 +1,183 @@
+//
+// bench_history.cpp
+//
+// Cost of a date bounded /history page through the route initialiseWiFi() registers, while the log
+// is in time order and so searched, and after one record out of order when every page walks back
+// checking dates. Either way the pages followed by cursor must hold the same rows.
+//
+
+#include <ESPAsyncWebSrv.h>
+#include <SPIFFS.h>
+#include <set>
+
+#include "host.h"
+#include "wifiSystem.h"
+#include "binaryLog.h"
+
+extern AsyncWebServer server;
+
+/*---------------------------------------------------------------- */
+
+static const int rows = 100000;				// One a second from 01-03-2024, a day is 3600 rows
+static const char* day = "10-03-2024";
+
+static std::string csvRow(int i) {
+
+	char line[64];
+	snprintf(line, sizeof(line), "Title %d,%02d-03-2024,08:%02d:%02d,%c,%d%%\r\n",
+		i % 12, 1 + i / 3600 % 28, i / 60 % 60, i % 60, "UPAFO"[i % 5], i % 101);
+	return line;
+}
+
+struct page {
+	int code;
+	std::string body;
+	std::string cursor;						// Empty when there are no more pages
+};
+
+// One page for the day, drained a TCP segment at a time
+
+static page historyPage(const std::string& cursor) {
+
+	static uint8_t buffer[1436];
+
+	AsyncWebServerRequest req;
+	req.parameters = { { "from", day }, { "to", day } };
+
+	if (!cursor.empty()) req.parameters.push_back({ "cursor", cursor.c_str() });
+
+	CHECK(server.get("/history", req));
+
+	page p = { req.sent->code };
+
+	if (!req.sent->filler) return p;
+
+	while (size_t n = req.sent->filler(buffer, sizeof(buffer), p.body.size())) p.body.append((const char*)buffer, n);
+
+	size_t at = p.body.rfind("\"cursor\":");
+
+	CHECK(at != std::string::npos);
+
+	p.cursor = p.body.substr(at + 9, p.body.size() - at - 10);
+
+	if (p.cursor == "null") p.cursor.clear();
+
+	return p;
+}
+
+static void rowsOf(const std::string& body, std::set<uint32_t>& found) {
+
+	for (size_t at = body.find("{\"row\":"); at != std::string::npos; at = body.find("{\"row\":", at + 1)) {
+		found.insert(strtoul(body.c_str() + at + 7, nullptr, 10));
+	}
+}
+
+struct result {
+	double firstMs;							// Until the first page with a row in it
+	unsigned long firstRecords;				// Records read to get there
+	int pages;								// Pages for the whole day
+	unsigned long records;
+	std::set<uint32_t> found;
+};
+
+// Follow the cursor from the newest page to the last
+
+static result walk() {
+
+	result r = {};
+	std::string cursor;
+	bool first = true;
+
+	hostfs::bytesRead = 0;
+
+	double start = hostSeconds();
+
+	do {
+
+		page p = historyPage(cursor);
+
+		CHECK(p.code == 200);
+
+		rowsOf(p.body, r.found);
+		r.pages++;
+
+		if (first && !r.found.empty()) {
+			r.firstMs = (hostSeconds() - start) * 1e3;
+			r.firstRecords = hostfs::bytesRead / sizeof(binaryLogRecord);
+			first = false;
+		}
+
+		cursor = p.cursor;
+
+	} while (!cursor.empty() && r.pages < 1000);
+
+	r.records = hostfs::bytesRead / sizeof(binaryLogRecord);
+
+	return r;
+}
+
+static void report(const char* name, const result& r) {
+
+	printf("%-12s first rows %7.3f ms %7lu records read   whole day %4d pages %7lu records read\n",
+		name, r.firstMs, r.firstRecords, r.pages, r.records);
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	hostfs::reset();
+
+	const char* settings[][2] = { { "/ssid.txt", "home" }, { "/pass.txt", "secret" }, { "/ip.txt", "192.168.1.50" },
+		{ "/subnet.txt", "255.255.255.0" }, { "/gateway.txt", "192.168.1.1" }, { "/dns.txt", "192.168.1.1" } };
+
+	for (auto& setting : settings) hostfs::files[setting[0]] = std::make_shared<std::string>(std::string(setting[1]) + "\n");
+
+	WiFi.connected = true;
+	initialiseWiFi();
+
+	std::string csv;
+	for (int i = 0; i < rows; i++) csv += csvRow(i);
+
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(csv);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogOrdered());
+
+	printf("%d records, %s is rows 32400 to 35999\n", rows, day);
+
+	result ordered = walk();
+	report("  ordered", ordered);
+
+	// A record the card doesnt return while searching is an error, not an empty page
+
+	const std::string log = *hostfs::files[binaryLogName];
+
+	hostfs::files[binaryLogName]->resize(sizeof(binaryLogHeader));
+	CHECK(historyPage("").code == 500);
+
+	*hostfs::files[binaryLogName] = log;
+
+	// The clock is set back and a detection from the first day is stored, nothing after it is searched
+
+	std::string early = csvRow(0);
+	binaryLogAppend(parseCSVLine(early.c_str(), early.size() - 2));
+
+	CHECK(!binaryLogOrdered());
+
+	result scanned = walk();
+	report("  unordered", scanned);
+
+	// Same rows either way, the whole day and nothing else
+
+	std::set<uint32_t> expected;
+	for (uint32_t i = 32400; i < 36000; i++) expected.insert(i);
+
+	CHECK(ordered.found == expected);
+	CHECK(scanned.found == expected);
+	CHECK(ordered.firstRecords < 100);
+	CHECK(scanned.records < (unsigned long)scanned.pages * historyScanLimit + 100);
+
+	return HOST_RESULT();
+
+} // Close function
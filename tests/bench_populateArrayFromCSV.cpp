@@ -0,0 +1,49 @@
+//
+// bench_populateArrayFromCSV.cpp
+//
+// Start up latency of reading the last ten rows from data files of 100 to 1,000,000 rows. The
+// tail is found by walking back from the end, so bytes read and seeks should not grow with the file
+//
+
+#include "host.h"
+#include "parseDataReceived.h"
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	std::string csv;
+	int rows = 0;
+
+	printf("%10s %12s %12s %8s\n", "rows", "us/read", "bytes read", "seeks");
+
+	for (int target = 100; target <= 1000000; target *= 10) {
+
+		// Grow the same file rather than rebuilding it each time
+
+		char line[64];
+
+		for (; rows < target; rows++) {
+			snprintf(line, sizeof(line), "Siren %d,12-03-2024,08:15:%02d,U,%d%%\n", rows, rows % 60, rows % 100);
+			csv += line;
+		}
+
+		hostfs::reset();
+		hostfs::files["/data.csv"] = std::make_shared<std::string>(csv);
+
+		const int runs = 200;
+		double start = hostSeconds();
+
+		for (int i = 0; i < runs; i++) populateArrayFromCSV(SD, "/data.csv", dataEntries, maxEntries);
+
+		double seconds = (hostSeconds() - start) / runs;
+
+		printf("%10d %12.2f %12lu %8lu\n", rows, seconds * 1e6, hostfs::bytesRead / runs, hostfs::seeks / runs);
+
+		snprintf(line, sizeof(line), "Siren %d", rows - 1);
+		CHECK(strcmp(dataEntries[0].title, line) == 0);
+	}
+
+	return HOST_RESULT();
+
+} // Close function
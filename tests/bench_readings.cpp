@@ -0,0 +1,139 @@
+//
+// bench_readings.cpp
+//
+// Heap use of one /readings request, through the route initialiseWiFi() registers. The response is
+// drained a TCP segment at a time as the server would. A detection that arrives between chunks must
+// not change the document, it already went out as an event.
+//
+
+#include <ESPAsyncWebSrv.h>
+#include <SPIFFS.h>
+
+#include "host.h"
+#include "wifiSystem.h"
+#include "parseDataReceived.h"
+#include "binaryLog.h"
+
+extern AsyncWebServer server;
+extern AsyncEventSource events;
+
+/*---------------------------------------------------------------- */
+
+static const size_t segment = 1436;			// Largest chunk AsyncTCP hands the filler
+
+struct result {
+	unsigned long allocations;				// Made by the route handler
+	unsigned long bytes;
+	unsigned long fillerAllocations;		// Made while the body is written
+	std::string body;
+};
+
+// One request drained chunk bytes at a time, a detection can arrive once the first chunk has gone
+
+static result request(size_t chunk, const bleSignal* arrival = nullptr) {
+
+	static uint8_t buffer[segment];
+
+	result r = {};
+	AsyncWebServerRequest req;
+
+	unsigned long allocations = hostAllocations, bytes = hostAllocatedBytes;
+
+	CHECK(server.get("/readings", req));
+
+	r.allocations = hostAllocations - allocations;
+	r.bytes = hostAllocatedBytes - bytes;
+
+	while (true) {
+
+		allocations = hostAllocations;
+		size_t n = req.sent->filler(buffer, chunk, r.body.size());
+		r.fillerAllocations += hostAllocations - allocations;
+
+		if (n == 0) break;
+
+		r.body.append((const char*)buffer, n);
+
+		// Stored by the persistence task, which tells open pages as it goes
+
+		if (arrival) {
+			lockStorage();
+			appendFile(SD, fileName, *arrival);
+			unlockStorage();
+			arrival = nullptr;
+		}
+	}
+
+	return r;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	hostfs::reset();
+
+	const char* settings[][2] = { { "/ssid.txt", "home" }, { "/pass.txt", "secret" }, { "/ip.txt", "192.168.1.50" },
+		{ "/subnet.txt", "255.255.255.0" }, { "/gateway.txt", "192.168.1.1" }, { "/dns.txt", "192.168.1.1" } };
+
+	for (auto& setting : settings) hostfs::files[setting[0]] = std::make_shared<std::string>(std::string(setting[1]) + "\n");
+
+	WiFi.connected = true;
+	initialiseWiFi();
+
+	std::string csv;
+
+	for (int i = 0; i < maxEntries; i++) {
+		char line[64];
+		snprintf(line, sizeof(line), "Smoke Alarm Kitchen %d,12-03-2024,08:%02d:02,U,87%%\r\n", i, i);
+		csv += line;
+	}
+
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(csv);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	beginWebEvents(binaryLogCount());
+
+	const int requests = 1000;
+	unsigned long allocations = 0, bytes = 0, fillerAllocations = 0;
+	std::string body;
+
+	for (int i = 0; i < requests; i++) {
+		result r = request(segment);
+		allocations += r.allocations;
+		bytes += r.bytes;
+		fillerAllocations += r.fillerAllocations;
+		body = r.body;
+	}
+
+	printf("/readings %zu byte document, %.1f allocations/request, %.0f heap bytes/request, %lu allocations writing the body\n",
+		body.size(), (double)allocations / requests, (double)bytes / requests, fillerAllocations);
+
+	// The rows are held once per request, writing the body allocates nothing
+
+	CHECK(bytes / requests < 2 * sizeof(readingsSnapshot));
+	CHECK(fillerAllocations == 0);
+	CHECK(body.compare(0, 10, "{\"rows\":10") == 0);
+
+	// A detection between chunks, the document still matches the event position it started at
+
+	bleSignal late = parseCSVLine("Doorbell,12-03-2024,09:00:00,U,55%", 34);
+
+	result r = request(64, &late);
+
+	CHECK(r.body == body);
+	CHECK(events.sent.size() == 1 && events.sent[0].event == "insert");
+	CHECK(events.sent[0].message.compare(0, 10, "{\"row\":10,") == 0);
+
+	// The next request has it, with the event id of its insert
+
+	char opening[64];
+	snprintf(opening, sizeof(opening), "{\"rows\":11,\"eventId\":%lu,\"readings\":[{\"title\":\"Doorbell\"", (unsigned long)events.sent[0].id);
+
+	body = request(segment).body;
+
+	CHECK(body.compare(0, strlen(opening), opening) == 0);
+
+	return HOST_RESULT();
+
+} // Close function
@@ -0,0 +1,253 @@
+//
+// host.cpp
+//
+// Definitions behind the stubs, shared by every host test
+//
+
+#include <SD.h>
+#include <SPIFFS.h>
+#include <EEPROM.h>
+#include <WiFi.h>
+#include <TFT_eSPI.h>
+#include <unistd.h>
+#include <new>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "host.h"
+
+/*---------------------------------------------------------------- */
+
+// File system
+
+namespace hostfs {
+
+	std::map<std::string, std::shared_ptr<std::string>> files;
+
+	long writeBudget = -1;
+	long writesLeft = -1;
+	unsigned long bytesRead = 0;
+	unsigned long bytesWritten = 0;
+	unsigned long readCalls = 0;
+	unsigned long writeCalls = 0;
+	unsigned long seeks = 0;
+
+	void reset() {
+		files.clear();
+		writeBudget = writesLeft = -1;
+		bytesRead = bytesWritten = readCalls = writeCalls = seeks = 0;
+	}
+}
+
+// The sketch cuts files through the VFS path SD.begin() mounted
+
+extern "C" int truncate(const char* path, off_t length) {
+
+	if (strncmp(path, "/sd", 3) == 0) path += 3;
+
+	auto it = hostfs::files.find(path);
+
+	if (it == hostfs::files.end()) return -1;
+
+	it->second->resize(length);
+	return 0;
+}
+
+SDFS SD;
+SPIFFSFS SPIFFS;
+SPIClass SPI;
+EEPROMClass EEPROM;
+WiFiClass WiFi;
+
+/*---------------------------------------------------------------- */
+
+// Board
+
+HardwareSerial Serial;
+HardwareSerial Serial2;
+EspClass ESP;
+
+void EspClass::restart() {}
+uint32_t EspClass::getFreeHeap() { return 100000; }
+
+const GFXfont FreeSans9pt7b, FreeSans12pt7b, FreeSansBold9pt7b;
+
+std::atomic<unsigned long> hostClock(0);
+
+unsigned long millis() { return hostClock; }
+unsigned long micros() { return hostClock * 1000; }
+void delay(unsigned long ms) { hostClock += ms; }
+void delayMicroseconds(unsigned) {}
+
+void digitalWrite(int, int) {}
+int digitalRead(int) { return HIGH; }
+void pinMode(int, int) {}
+int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterrupt(int, void (*)(), int) {}
+void detachInterrupt(int) {}
+void ledcAttach(int, int, int) {}
+void ledcWriteTone(int, int) {}
+
+bool getLocalTime(struct tm*, uint32_t) { return false; }
+void configTime(long, int, const char*) {}
+
+bool psramFound() { return false; }
+void* ps_malloc(size_t size) { return malloc(size); }
+
+size_t hostLargestFreeBlock = 110000;
+
+std::atomic<unsigned long> hostAllocations(0);
+std::atomic<unsigned long> hostAllocatedBytes(0);
+
+void* heap_caps_malloc(size_t size, uint32_t) {
+
+	if (size > hostLargestFreeBlock) return nullptr;
+
+	hostAllocations++;
+	hostAllocatedBytes += size;
+
+	return malloc(size);
+}
+size_t heap_caps_get_largest_free_block(uint32_t) { return hostLargestFreeBlock; }
+void heap_caps_free(void* p) { free(p); }
+
+// Everything new allocates is counted too, String included
+
+void* operator new(size_t size) {
+
+	hostAllocations++;
+	hostAllocatedBytes += size;
+
+	void* p = malloc(size ? size : 1);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+/*---------------------------------------------------------------- */
+
+// FreeRTOS. A task is a std::thread, the main thread is the loop task and has no handle. Tasks
+// never return, as on the board, so a test that starts one leaves through _exit().
+
+struct hostTask {
+	std::mutex lock;
+	std::condition_variable wake;
+	uint32_t notifications = 0;
+};
+
+static thread_local hostTask* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(void (*code)(void*), const char*, uint32_t, void* parameter, UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+
+	hostTask* task = new hostTask();
+
+	if (handle) *handle = task;
+
+	std::thread([code, parameter, task]() { currentTask = task; code(parameter); }).detach();
+
+	return pdPASS;
+}
+
+// Ticks are milliseconds. The loop task has no one to notify it, so it doesnt wait
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+
+	hostTask* task = currentTask;
+
+	if (!task) return 0;
+
+	std::unique_lock<std::mutex> lock(task->lock);
+
+	auto notified = [task]() { return task->notifications > 0; };
+
+	if (ticks == portMAX_DELAY) task->wake.wait(lock, notified);
+	else task->wake.wait_for(lock, std::chrono::milliseconds(ticks), notified);
+
+	uint32_t count = task->notifications;
+
+	task->notifications = clear ? 0 : (count ? count - 1 : 0);
+
+	return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t handle) {
+
+	hostTask* task = (hostTask*)handle;
+
+	{
+		std::lock_guard<std::mutex> lock(task->lock);
+		task->notifications++;
+	}
+
+	task->wake.notify_one();
+
+	return pdPASS;
+}
+
+// The loop task's delays move the test's clock, other tasks really sleep
+
+void vTaskDelay(TickType_t ticks) {
+
+	if (currentTask) std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+	else hostClock += ticks;
+}
+
+TickType_t xTaskGetTickCount() { return hostClock; }
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask; }
+
+// Every semaphore is a recursive mutex, the sketch only uses them as locks
+
+static BaseType_t take(SemaphoreHandle_t semaphore, TickType_t ticks) {
+
+	auto mutex = (std::recursive_timed_mutex*)semaphore;
+
+	if (ticks == portMAX_DELAY) {
+		mutex->lock();
+		return pdTRUE;
+	}
+
+	return mutex->try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+static BaseType_t give(SemaphoreHandle_t semaphore) {
+
+	((std::recursive_timed_mutex*)semaphore)->unlock();
+
+	return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new std::recursive_timed_mutex(); }
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new std::recursive_timed_mutex(); }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) { return take(semaphore, ticks); }
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) { return give(semaphore); }
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks) { return take(semaphore, ticks); }
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore) { return give(semaphore); }
+
+// One lock stands in for every spinlock
+
+static std::recursive_mutex criticalSection;
+
+void portENTER_CRITICAL(portMUX_TYPE*) { criticalSection.lock(); }
+void portEXIT_CRITICAL(portMUX_TYPE*) { criticalSection.unlock(); }
+
+/*---------------------------------------------------------------- */
+
+// Checks and timing
+
+int hostFailures = 0;
+
+double hostSeconds() {
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/*---------------------------------------------------------------- */
@@ -0,0 +1,29 @@
+// host.h - checks and timing shared by the host tests
+
+#pragma once
+
+#include <Arduino.h>
+
+extern int hostFailures;
+
+// Record a failed check and carry on, so one run reports every failure
+
+#define CHECK(condition) do { \
+	if (!(condition)) { \
+		fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+		hostFailures++; \
+	} \
+} while (0)
+
+// Exit status for main()
+
+#define HOST_RESULT() (hostFailures ? (fprintf(stderr, "%d check(s) failed\n", hostFailures), 1) : (printf("ok\n"), 0))
+
+// Heap allocations made through new and heap_caps_malloc since the program started
+
+extern std::atomic<unsigned long> hostAllocations;
+extern std::atomic<unsigned long> hostAllocatedBytes;
+
+// Wall clock for benchmarks
+
+double hostSeconds();
@@ -0,0 +1,257 @@
+// Arduino.h - host stand in for the ESP32 Arduino core, just enough for the sketch modules under test
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <cctype>
+#include <string>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(x) x
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+#define SERIAL_8N1 0
+
+inline uint16_t pgm_read_word(const void* p) { return *(const uint16_t*)p; }
+inline uint8_t pgm_read_byte(const void* p) { return *(const uint8_t*)p; }
+
+// Time, driven by the test through hostClock (milliseconds), tasks read it from their own threads
+
+extern std::atomic<unsigned long> hostClock;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned us);
+
+// GPIO
+
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+void pinMode(int pin, int mode);
+int digitalPinToInterrupt(int pin);
+void attachInterrupt(int pin, void (*isr)(), int mode);
+void detachInterrupt(int pin);
+void ledcAttach(int pin, int frequency, int resolution);
+void ledcWriteTone(int pin, int frequency);
+
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+void configTime(long gmtOffset, int daylightOffset, const char* server);
+
+bool psramFound();
+void* ps_malloc(size_t size);
+
+// Heap, counts what the tests allocate through heap_caps_malloc
+
+#define MALLOC_CAP_8BIT 0x4
+#define MALLOC_CAP_DMA 0x8
+#define MALLOC_CAP_INTERNAL 0x800
+#define MALLOC_CAP_SPIRAM 0x400
+
+extern size_t hostLargestFreeBlock;
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+void heap_caps_free(void* p);
+
+// String, backed by std::string
+
+class String {
+public:
+	std::string s;
+
+	String() {}
+	String(const char* c) { if (c) s = c; }
+	String(const char* c, unsigned n) : s(c, n) {}
+	String(const String&) = default;
+	String(int v) : s(std::to_string(v)) {}
+	String(unsigned v) : s(std::to_string(v)) {}
+	String(long v) : s(std::to_string(v)) {}
+	String(unsigned long v) : s(std::to_string(v)) {}
+	String(char c) : s(1, c) {}
+
+	String& operator=(const char* c) { s = c ? c : ""; return *this; }
+	String& operator=(const String&) = default;
+	String& operator+=(const String& o) { s += o.s; return *this; }
+	String& operator+=(const char* o) { s += o; return *this; }
+	String& operator+=(char c) { s += c; return *this; }
+
+	friend String operator+(const String& a, const String& b) { String r; r.s = a.s + b.s; return r; }
+	friend String operator+(const String& a, const char* b) { String r; r.s = a.s + b; return r; }
+	friend String operator+(const char* a, const String& b) { String r; r.s = std::string(a) + b.s; return r; }
+	friend String operator+(const String& a, char b) { String r; r.s = a.s + b; return r; }
+
+	bool operator==(const char* o) const { return s == o; }
+	bool operator==(const String& o) const { return s == o.s; }
+	bool operator!=(const char* o) const { return s != o; }
+
+	bool concat(const char* c, unsigned n) { s.append(c, n); return true; }
+	bool isEmpty() const { return s.empty(); }
+	unsigned length() const { return s.size(); }
+	const char* c_str() const { return s.c_str(); }
+
+	int indexOf(char c, unsigned from = 0) const { auto p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+	int indexOf(const char* c, unsigned from = 0) const { auto p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+
+	String substring(unsigned a) const { return String(s.substr(a).c_str()); }
+	String substring(unsigned a, unsigned b) const { return String(s.substr(a, b - a).c_str()); }
+
+	void trim() {
+		size_t a = s.find_first_not_of(" \t\r\n");
+		size_t b = s.find_last_not_of(" \t\r\n");
+		s = (a == std::string::npos) ? "" : s.substr(a, b - a + 1);
+	}
+
+	void replace(const char* a, const char* b) {
+		size_t p = 0, la = strlen(a), lb = strlen(b);
+		while ((p = s.find(a, p)) != std::string::npos) { s.replace(p, la, b); p += lb; }
+	}
+
+	bool equals(const String& o) const { return s == o.s; }
+	bool startsWith(const char* p) const { return s.compare(0, strlen(p), p) == 0; }
+	bool endsWith(const char* p) const { size_t n = strlen(p); return s.size() >= n && s.compare(s.size() - n, n, p) == 0; }
+	int toInt() const { return atoi(s.c_str()); }
+	char charAt(unsigned i) const { return s[i]; }
+	char operator[](unsigned i) const { return s[i]; }
+	void reserve(unsigned n) { s.reserve(n); }
+};
+
+// Print and Stream, output is discarded
+
+class Print {
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t) = 0;
+	virtual size_t write(const uint8_t* b, size_t n) { for (size_t i = 0; i < n; i++) write(b[i]); return n; }
+	size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+
+	size_t print(const char* s) { return write(s); }
+	size_t print(char* s) { return write(s); }
+	template<class T> size_t print(const T&) { return 0; }
+	template<class T> size_t print(const T&, int) { return 0; }
+	template<class T> size_t println(const T&) { return 0; }
+	size_t println() { return 0; }
+	size_t print(const struct tm*, const char*) { return 0; }
+	size_t println(const struct tm*, const char*) { return 0; }
+	size_t printf(const char*, ...) { return 0; }
+};
+
+class Stream : public Print {
+public:
+	virtual int available() { return 0; }
+	virtual int read() { return -1; }
+	virtual int peek() { return -1; }
+	size_t write(uint8_t) override { return 1; }
+	using Print::write;
+	void flush() {}
+
+	String readStringUntil(char end) {
+		String line;
+		int c;
+		while ((c = read()) >= 0 && c != end) line += (char)c;
+		return line;
+	}
+};
+
+// UART, the test fills input and the module reads it back
+
+class HardwareSerial : public Stream {
+public:
+	std::string input;
+
+	void begin(unsigned long, int = 0, int = -1, int = -1) {}
+	void onReceive(std::function<void(void)>, bool = false) {}
+	void setRxBufferSize(size_t) {}
+
+	int available() override { return input.size(); }
+
+	int read() override {
+		if (input.empty()) return -1;
+		int c = (uint8_t)input[0];
+		input.erase(0, 1);
+		return c;
+	}
+
+	size_t read(uint8_t* b, size_t n) {
+		n = std::min(n, input.size());
+		memcpy(b, input.data(), n);
+		input.erase(0, n);
+		return n;
+	}
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
+
+class IPAddress {
+public:
+	bool fromString(const char*) { return true; }
+};
+
+struct EspClass {
+	void restart();
+	uint32_t getFreeHeap();
+};
+
+extern EspClass ESP;
+
+// FreeRTOS, each task runs on its own thread and the loop task is the main thread
+
+typedef void* TaskHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef void* QueueHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define portMAX_DELAY 0xffffffffu
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdMS_TO_TICKS(x) (x)
+#define portTICK_PERIOD_MS 1
+
+BaseType_t xTaskCreatePinnedToCore(void (*task)(void*), const char*, uint32_t, void*, UBaseType_t, TaskHandle_t*, BaseType_t);
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t);
+BaseType_t xTaskNotifyGive(TaskHandle_t);
+void vTaskDelay(TickType_t);
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t);
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t);
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t);
+
+typedef struct { int unused; } portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+
+void portENTER_CRITICAL(portMUX_TYPE*);
+void portEXIT_CRITICAL(portMUX_TYPE*);
@@ -0,0 +1 @@
+// AsyncTCP.h - host stand in, pulled in by ESPAsyncWebSrv.h only
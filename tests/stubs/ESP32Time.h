@@ -0,0 +1,8 @@
+// ESP32Time.h - host stand in, the sketch only sets the clock
+
+#pragma once
+
+class ESP32Time {
+public:
+	void setTime(int, int, int, int, int, int, int = 0) {}
+};
@@ -0,0 +1,168 @@
+// ESPAsyncWebSrv.h - host stand in that records handlers and responses so a test can call a route and read the body back
+
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <WiFi.h>
+#include <map>
+#include <vector>
+#include <memory>
+
+#define HTTP_GET 1
+#define HTTP_POST 2
+
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebParameter {
+public:
+	String paramName, paramValue;
+	bool isPost() { return false; }
+	const String& name() { return paramName; }
+	const String& value() { return paramValue; }
+};
+
+// A response keeps its headers and either a body, a file or a filler the test drains
+
+class AsyncWebServerResponse {
+public:
+	int code = 200;
+	String contentType;
+	std::string body;
+	std::map<std::string, std::string> headers;
+	AwsResponseFiller filler;
+
+	void addHeader(const String& name, const String& value) { headers[name.c_str()] = value.c_str(); }
+	void setCode(int c) { code = c; }
+
+	// Pull the whole body through the filler maxLen bytes at a time, as the server would
+
+	std::string drain(size_t maxLen) {
+		if (!filler) return body;
+		std::string out;
+		std::vector<uint8_t> buffer(maxLen);
+		while (true) {
+			size_t n = filler(buffer.data(), maxLen, out.size());
+			if (n == 0) break;
+			out.append((const char*)buffer.data(), n);
+		}
+		return out;
+	}
+};
+
+class AsyncWebServerRequest {
+public:
+	std::vector<AsyncWebParameter> parameters;
+	std::map<std::string, std::string> requestHeaders;
+	std::unique_ptr<AsyncWebServerResponse> sent;
+
+	int params() { return parameters.size(); }
+	AsyncWebParameter* getParam(int i) { return &parameters[i]; }
+
+	AsyncWebParameter* getParam(const char* name, bool = false) {
+		for (auto& p : parameters) if (p.paramName == name) return &p;
+		return nullptr;
+	}
+
+	bool hasParam(const char* name, bool = false) { return getParam(name) != nullptr; }
+
+	String header(const char* name) {
+		auto it = requestHeaders.find(name);
+		return it == requestHeaders.end() ? String() : String(it->second.c_str());
+	}
+
+	AsyncWebServerResponse* beginResponse(int code, const String& type = String(), const String& content = String()) {
+		auto r = new AsyncWebServerResponse();
+		r->code = code; r->contentType = type; r->body = content.c_str();
+		return r;
+	}
+
+	// Like the library, NULL when the file cannot be opened
+
+	AsyncWebServerResponse* beginResponse(fs::FS& fs, const String& path, const String& type = String(), bool = false) {
+		File f = fs.open(path.c_str(), "r");
+		if (!f) return nullptr;
+		auto r = new AsyncWebServerResponse();
+		r->contentType = type;
+		while (f.available()) r->body += (char)f.read();
+		return r;
+	}
+
+	AsyncWebServerResponse* beginChunkedResponse(const String& type, AwsResponseFiller filler) {
+		auto r = new AsyncWebServerResponse();
+		r->contentType = type; r->filler = filler;
+		return r;
+	}
+
+	void send(AsyncWebServerResponse* r) { sent.reset(r); }
+	void send(int code, const char* type = nullptr, const String& content = String()) { send(beginResponse(code, type ? type : "", content)); }
+
+	void send(fs::FS& fs, const String& path, const String& type = String(), bool download = false) {
+		AsyncWebServerResponse* r = beginResponse(fs, path, type, download);
+		send(r ? r : beginResponse(404));
+	}
+};
+
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+
+class AsyncStaticWebHandler {
+public:
+	AsyncStaticWebHandler& setCacheControl(const char*) { return *this; }
+	AsyncStaticWebHandler& setDefaultFile(const char*) { return *this; }
+};
+
+// Server sent events, each send is kept so a test can read the stream back
+
+struct hostEvent {
+	std::string message, event;
+	uint32_t id;
+};
+
+class AsyncEventSourceClient {
+public:
+	uint32_t last = 0;
+	std::vector<hostEvent> received;
+	uint32_t lastId() { return last; }
+	void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t = 0) { received.push_back({message, event ? event : "", id}); }
+};
+
+class AsyncWebHandler {};
+
+class AsyncEventSource : public AsyncWebHandler {
+public:
+	std::function<void(AsyncEventSourceClient*)> connectHandler;
+	std::vector<hostEvent> sent;
+
+	AsyncEventSource(const String&) {}
+	void onConnect(std::function<void(AsyncEventSourceClient*)> handler) { connectHandler = handler; }
+	void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t = 0) { sent.push_back({message, event ? event : "", id}); }
+	size_t count() const { return 1; }
+};
+
+class AsyncWebServer {
+public:
+	struct route {
+		std::string uri;
+		int method;
+		ArRequestHandlerFunction handler;
+	};
+
+	std::vector<route> routes;
+
+	AsyncWebServer(int) {}
+
+	void on(const char* uri, int method, ArRequestHandlerFunction handler) { routes.push_back({uri, method, handler}); }
+	AsyncStaticWebHandler& serveStatic(const char*, fs::FS&, const char*, const char* = nullptr) { static AsyncStaticWebHandler h; return h; }
+	void addHandler(AsyncWebHandler*) {}
+	void begin() {}
+	void onNotFound(ArRequestHandlerFunction) {}
+
+	// Run the first GET handler registered for uri, false if there is none
+
+	bool get(const char* uri, AsyncWebServerRequest& request) {
+		for (auto& r : routes) {
+			if (r.method == HTTP_GET && r.uri == uri) { r.handler(&request); return true; }
+		}
+		return false;
+	}
+};
@@ -0,0 +1,171 @@
+// FS.h - in memory file system for host tests
+//
+// Files live in hostfs::files. hostfs::writeBudget limits how many more bytes may be written and
+// hostfs::writesLeft how many more write calls go through. Once either runs out every write stops
+// short, which is how the tests simulate a power cut or a full card part way through an update.
+
+#pragma once
+
+#include "Arduino.h"
+#include <map>
+#include <memory>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace hostfs {
+
+	extern std::map<std::string, std::shared_ptr<std::string>> files;
+
+	extern long writeBudget;				// Bytes that may still be written, -1 for no limit
+	extern long writesLeft;					// Write calls that may still store anything, -1 for no limit
+	extern unsigned long bytesRead;
+	extern unsigned long bytesWritten;
+	extern unsigned long readCalls;			// Each one is at least one SD transfer on the board
+	extern unsigned long writeCalls;
+	extern unsigned long seeks;
+
+	void reset();							// Empty the file system and the counters
+}
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+public:
+	std::shared_ptr<std::string> data;
+	size_t pos = 0;
+	bool append = false;
+	std::string path_;
+
+	File() {}
+
+	operator bool() const { return (bool)data; }
+
+	size_t write(const uint8_t* b, size_t n) override {
+
+		if (!data) return 0;
+
+		hostfs::writeCalls++;
+
+		if (hostfs::writesLeft >= 0) {
+			if (hostfs::writesLeft == 0) return 0;
+			hostfs::writesLeft--;
+		}
+
+		if (hostfs::writeBudget >= 0) {
+			n = std::min(n, (size_t)hostfs::writeBudget);
+			hostfs::writeBudget -= n;
+		}
+
+		if (append) pos = data->size();
+		if (pos + n > data->size()) data->resize(pos + n);
+
+		memcpy(&(*data)[pos], b, n);
+		pos += n;
+		hostfs::bytesWritten += n;
+
+		return n;
+	}
+
+	size_t write(uint8_t c) override { return write(&c, 1); }
+	using Print::write;
+
+	size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+	size_t println(const char* s) { size_t n = print(s); return n + print("\r\n"); }
+	size_t print(const String& s) { return print(s.c_str()); }
+	size_t println(const String& s) { return println(s.c_str()); }
+
+	size_t read(uint8_t* b, size_t n) {
+		if (!data) return 0;
+		hostfs::readCalls++;
+		if (pos >= data->size()) return 0;
+		n = std::min(n, data->size() - pos);
+		memcpy(b, data->data() + pos, n);
+		pos += n;
+		hostfs::bytesRead += n;
+		return n;
+	}
+
+	int read() override {
+		uint8_t c;
+		return read(&c, 1) ? c : -1;
+	}
+
+	int peek() override { return (data && pos < data->size()) ? (uint8_t)(*data)[pos] : -1; }
+
+	int available() override { return (data && pos < data->size()) ? data->size() - pos : 0; }
+
+	bool seek(uint32_t p, SeekMode mode = SeekSet) {
+		if (!data) return false;
+		hostfs::seeks++;
+		if (mode == SeekSet) pos = p;
+		else if (mode == SeekCur) pos += p;
+		else pos = data->size() + p;
+		return pos <= data->size();
+	}
+
+	size_t position() const { return pos; }
+	size_t size() const { return data ? data->size() : 0; }
+	void flush() {}
+	void close() { data.reset(); }
+	bool isDirectory() { return false; }
+	File openNextFile() { return File(); }
+	const char* name() const { return path_.c_str(); }
+	const char* path() const { return path_.c_str(); }
+	time_t getLastWrite() { return 0; }
+};
+
+class FS {
+public:
+	File open(const char* path, const char* mode = FILE_READ, bool create = false) {
+
+		File f;
+		auto it = hostfs::files.find(path);
+
+		if (mode[0] == 'r') {
+			if (it == hostfs::files.end()) return f;
+			f.data = it->second;
+		}
+
+		else if (mode[0] == 'w') {
+			f.data = hostfs::files[path] = std::make_shared<std::string>();
+		}
+
+		else {
+			if (it == hostfs::files.end()) hostfs::files[path] = std::make_shared<std::string>();
+			f.data = hostfs::files[path];
+			f.append = true;
+			f.pos = f.data->size();
+		}
+
+		f.path_ = path;
+		return f;
+	}
+
+	File open(const String& path, const char* mode = FILE_READ) { return open(path.c_str(), mode); }
+
+	bool exists(const char* path) { return hostfs::files.count(path) > 0; }
+	bool exists(const String& path) { return exists(path.c_str()); }
+	bool remove(const char* path) { return hostfs::files.erase(path) > 0; }
+
+	bool rename(const char* from, const char* to) {
+		if (!exists(from)) return false;
+		hostfs::files[to] = hostfs::files[from];
+		hostfs::files.erase(from);
+		return true;
+	}
+
+	bool mkdir(const char*) { return true; }
+	const char* mountpoint() { return "/sd"; }
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
@@ -0,0 +1 @@
+// Network.h - host stand in, nothing used
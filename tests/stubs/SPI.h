@@ -0,0 +1,23 @@
+// SPI.h - host stand in
+
+#pragma once
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0
+#define MSBFIRST 1
+#define VSPI 3
+
+struct SPISettings {
+	SPISettings(uint32_t = 0, uint8_t = 0, uint8_t = 0) {}
+};
+
+class SPIClass {
+public:
+	SPIClass(int = 0) {}
+	void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+	void beginTransaction(SPISettings) {}
+	void endTransaction() {}
+};
+
+extern SPIClass SPI;
@@ -0,0 +1,12 @@
+// SPIFFS.h - host stand in, shares the in memory file system
+
+#pragma once
+
+#include "FS.h"
+
+class SPIFFSFS : public fs::FS {
+public:
+	bool begin(bool = false) { return true; }
+};
+
+extern SPIFFSFS SPIFFS;
@@ -0,0 +1,235 @@
+// TFT_eSPI.h - host stand in for the display
+//
+// Drawing goes into a 320 x 240 RGB565 frame so tests can check pixels. Pixel arrays are sent in
+// memory order as the library does, so they only show the right colour with setSwapBytes(true). Each time chip select
+// would be asserted counts as a bus transaction: once per startWrite()/endWrite() batch, or once
+// per drawing call made outside a batch. Address windows and pixels sent are counted as well.
+//
+// Text in the built in font is drawn as the library does it, one window per character with its
+// background, from a made up glyph set. Free fonts and text without a background draw nothing.
+
+#pragma once
+
+#include "Arduino.h"
+
+#include <vector>
+
+struct GFXfont {};
+
+extern const GFXfont FreeSans9pt7b, FreeSans12pt7b, FreeSansBold9pt7b;
+
+#define TFT_WHITE 0xFFFF
+#define TFT_BLACK 0
+#define TL_DATUM 0
+#define PSRAM_ENABLE 3
+
+struct tftCounters {
+	unsigned long transactions;				// Chip select asserted
+	unsigned long windows;					// Address windows set
+	unsigned long pixels;					// Pixels sent
+	unsigned long commands;					// Raw commands written
+};
+
+class TFT_eSPI : public Print {
+public:
+	static const int16_t frameWidth = 320;
+	static const int16_t frameHeight = 240;
+
+	uint16_t pixelsOut[frameWidth * frameHeight] = {};
+	tftCounters counters = {};
+
+	TFT_eSPI(int16_t = 240, int16_t = 320) {}
+
+	size_t write(uint8_t c) override {
+		if (gfxFont == nullptr && textFont == 1 && textBackground != textColour && c >= ' ' && c <= '~') {
+			drawGlyph(cursorX, cursorY, c, textColour, textBackground);
+			cursorX += 6;
+		}
+		return 1;
+	}
+	using Print::write;
+
+	// Batches
+
+	void startWrite() { if (depth++ == 0) counters.transactions++; }
+	void endWrite() { if (depth > 0) depth--; }
+
+	// Address window, pixels pushed after it fill it left to right, top to bottom
+
+	void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+		touch();
+		counters.windows++;
+		wx = x; wy = y; ww = w; wh = h; wi = 0;
+	}
+
+	void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) { setAddrWindow(x0, y0, x1 - x0 + 1, y1 - y0 + 1); }
+
+	void pushPixels(const void* data, uint32_t count) {
+		touch();
+		const uint16_t* p = (const uint16_t*)data;
+		for (uint32_t i = 0; i < count; i++) windowPixel(swap ? p[i] : (uint16_t)((p[i] >> 8) | (p[i] << 8)));
+	}
+
+	void pushBlock(uint16_t colour, uint32_t count) {
+		touch();
+		for (uint32_t i = 0; i < count; i++) windowPixel(colour);
+	}
+
+	void pushColor(uint16_t colour) { pushBlock(colour, 1); }
+	void pushColor(uint16_t colour, uint32_t count) { pushBlock(colour, count); }
+
+	void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+		startWrite();
+		setAddrWindow(x, y, w, h);
+		pushPixels(data, w * h);
+		endWrite();
+	}
+
+	void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) { pushImage(x, y, w, h, (const uint16_t*)data); }
+	void pushImage(int32_t, int32_t, int32_t, int32_t, const uint8_t*, bool, uint16_t* = nullptr) { touch(); }
+
+	bool initDMA(bool = false) { return true; }
+	void deInitDMA() {}
+	void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* = nullptr) { pushImage(x, y, w, h, data); }
+	void pushPixelsDMA(uint16_t* data, uint32_t count) { pushPixels(data, count); }
+	void dmaWait() {}
+	bool dmaBusy() { return false; }
+
+	void setSwapBytes(bool s) { swap = s; }
+	bool getSwapBytes() { return swap; }
+
+	// Shapes
+
+	void drawPixel(int32_t x, int32_t y, uint32_t colour) { touch(); counters.windows++; plot(x, y, colour); counters.pixels++; }
+	void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour) { startWrite(); setAddrWindow(x, y, w, h); pushBlock(colour, w * h); endWrite(); }
+	void fillScreen(uint32_t colour) { fillRect(0, 0, frameWidth, frameHeight, colour); }
+	void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t colour) { fillRect(x, y, w, 1, colour); }
+	void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t colour) { fillRect(x, y, 1, h, colour); }
+
+	void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour) {
+		drawFastHLine(x, y, w, colour);
+		drawFastHLine(x, y + h - 1, w, colour);
+		drawFastVLine(x, y, h, colour);
+		drawFastVLine(x + w - 1, y, h, colour);
+	}
+
+	void readRect(int32_t, int32_t, int32_t, int32_t, uint16_t*) {}
+
+	// Text
+
+	void begin() {}
+	void init() {}
+	void setRotation(uint8_t) {}
+	void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+	void setFreeFont(const GFXfont* font = nullptr) { gfxFont = font; }
+	void setTextFont(uint8_t font) { gfxFont = nullptr; textFont = font; }
+	void setTextSize(uint8_t) {}
+	void setTextColor(uint16_t colour) { textColour = textBackground = colour; }
+	void setTextColor(uint16_t colour, uint16_t background, bool = false) { textColour = colour; textBackground = background; }
+	void setTextDatum(uint8_t) {}
+	int16_t textWidth(const char*) { return 0; }
+	int16_t fontHeight() { return 8; }
+	int16_t drawString(const char*, int32_t, int32_t) { return 0; }
+	int16_t drawChar(uint16_t, int32_t, int32_t) { return 6; }
+	void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t colour, uint32_t background, uint8_t) { drawGlyph(x, y, c, colour, background); }
+	int16_t width() { return frameWidth; }
+	int16_t height() { return frameHeight; }
+	void setViewport(int32_t, int32_t, int32_t, int32_t, bool = true) {}
+	void resetViewport() {}
+
+	// Touch, the test sets where the pen is
+
+	bool touched = false;
+	uint16_t touchX = 0, touchY = 0;
+
+	uint8_t getTouch(uint16_t* x, uint16_t* y, uint16_t = 600) { *x = touchX; *y = touchY; return touched; }
+	void setTouch(uint16_t*) {}
+	void calibrateTouch(uint16_t*, uint32_t, uint32_t, uint8_t) {}
+	uint16_t getTouchRawZ() { return 0; }
+	bool getTouchRaw(uint16_t*, uint16_t*) { return false; }
+
+	void writecommand(uint8_t) { touch(); counters.commands++; }
+	void writedata(uint8_t) { touch(); }
+
+	uint16_t pixel(int32_t x, int32_t y) const { return pixelsOut[y * frameWidth + x]; }
+
+	// Stand in glyph row, bit 5 is the left column and the sixth column is left blank as in the real font
+
+	static uint8_t glyphRow(uint16_t c, uint8_t row) { return c == ' ' ? 0 : ((c * 37 + row * 11) ^ (c >> 2)) & 0x3E; }
+
+private:
+	int depth = 0;
+	bool swap = false;
+	int32_t wx = 0, wy = 0, ww = 0, wh = 0, wi = 0;
+
+	const GFXfont* gfxFont = nullptr;
+	uint8_t textFont = 1;
+	uint16_t textColour = TFT_WHITE, textBackground = TFT_WHITE;
+	int32_t cursorX = 0, cursorY = 0;
+
+	void drawGlyph(int32_t x, int32_t y, uint16_t c, uint16_t colour, uint16_t background) {
+		startWrite();
+		setAddrWindow(x, y, 6, 8);
+		for (uint8_t row = 0; row < 8; row++) {
+			for (uint8_t col = 0; col < 6; col++) windowPixel((glyphRow(c, row) & (0x20 >> col)) ? colour : background);
+		}
+		endWrite();
+	}
+
+	void touch() { if (depth == 0) counters.transactions++; }
+
+	void plot(int32_t x, int32_t y, uint16_t colour) {
+		if (x >= 0 && y >= 0 && x < frameWidth && y < frameHeight) pixelsOut[y * frameWidth + x] = colour;
+	}
+
+	void windowPixel(uint16_t colour) {
+		if (ww > 0) plot(wx + wi % ww, wy + wi / ww, colour);
+		wi++;
+		counters.pixels++;
+	}
+};
+
+// A sprite draws into its own frame, its memory is taken through heap_caps_malloc so the heap limit applies
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+	TFT_eSprite(TFT_eSPI* tft) : parent(tft) {}
+	~TFT_eSprite() { deleteSprite(); }
+
+	void* createSprite(int16_t w, int16_t h, uint8_t = 1) {
+		deleteSprite();
+		if (w > frameWidth || h > frameHeight) return nullptr;
+		memory = heap_caps_malloc(bitDepth == 1 ? (w + 7) / 8 * h : w * h * (bitDepth / 8), MALLOC_CAP_8BIT);
+		if (memory) { spriteWidth = w; spriteHeight = h; }
+		return memory;
+	}
+
+	void deleteSprite() { heap_caps_free(memory); memory = nullptr; }
+	bool created() { return memory != nullptr; }
+	void* setColorDepth(int8_t b) { bitDepth = b; return memory; }
+	void setAttribute(uint8_t, uint8_t) {}
+	void fillSprite(uint32_t colour) { fillRect(0, 0, spriteWidth, spriteHeight, colour); }
+	uint16_t readPixel(int32_t x, int32_t y) { return pixel(x, y); }
+	void* getPointer() { return memory; }
+	void* frameBuffer(int8_t) { return memory; }
+	void setPsram(bool) {}
+
+	void pushSprite(int32_t x, int32_t y) {
+		std::vector<uint16_t> image;
+		for (int32_t row = 0; row < spriteHeight; row++) {
+			for (int32_t col = 0; col < spriteWidth; col++) image.push_back(pixel(col, row));
+		}
+		bool swapped = parent->getSwapBytes();
+		parent->setSwapBytes(true);
+		parent->pushImage(x, y, spriteWidth, spriteHeight, image.data());
+		parent->setSwapBytes(swapped);
+	}
+
+	void pushSprite(int32_t x, int32_t y, uint16_t) { pushSprite(x, y); }
+
+private:
+	TFT_eSPI* parent;
+	void* memory = nullptr;
+	int8_t bitDepth = 16;
+	int16_t spriteWidth = 0, spriteHeight = 0;
+};
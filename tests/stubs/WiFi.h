@@ -0,0 +1,27 @@
+// WiFi.h - host stand in, connects straight away once a test sets connected
+
+#pragma once
+
+#include <Arduino.h>
+
+#define WL_CONNECTED 3
+#define WIFI_STA 1
+
+class WiFiClass {
+public:
+	bool connected = false;
+
+	int status() { return connected ? WL_CONNECTED : 0; }
+	void mode(int) {}
+	bool config(IPAddress, IPAddress, IPAddress, IPAddress) { return true; }
+	void begin(const char*, const char*) {}
+	IPAddress localIP() { return IPAddress(); }
+	IPAddress dnsIP() { return IPAddress(); }
+	IPAddress gatewayIP() { return IPAddress(); }
+	int RSSI() { return 0; }
+	String SSID() { return String(); }
+	bool softAP(const char*, const char*) { return true; }
+	IPAddress softAPIP() { return IPAddress(); }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,198 @@
+//
+// test_binaryLog.cpp
+//
+// CSV export through buffers of every small size, more titles than the old table held, and the
+// start up check that rebuilds the log when the CSV file has more or fewer rows. Also the time
+// order flag, which a row out of order clears for good, the search it allows, and titles as long
+// as a frame can carry, through the log and on to the CSV file
+//
+
+#include <SD.h>
+#include <vector>
+
+#include "host.h"
+#include "binaryLog.h"
+#include "logWriter.h"
+
+/*---------------------------------------------------------------- */
+
+static std::string row(int i, int titles) {
+
+	char line[64];
+	snprintf(line, sizeof(line), "Title %d,%02d-03-2024,08:%02d:%02d,%c,%d%%\r\n",
+		i % titles, 1 + i / 3600 % 28, i / 60 % 60, i % 60, "UPAFO"[i % 5], i % 101);
+	return line;
+}
+
+static std::string csvRows(int first, int count, int titles) {
+
+	std::string csv;
+	for (int i = first; i < first + count; i++) csv += row(i, titles);
+	return csv;
+}
+
+// Pull the whole export through buffers of one size
+
+static std::string exportAll(size_t size) {
+
+	std::string out;
+	std::vector<char> buffer(size);
+	exportCursor cursor;
+
+	while (size_t length = binaryLogExportCSV(buffer.data(), size, cursor)) {
+		out.append(buffer.data(), length);
+	}
+
+	return out;
+}
+
+static std::string& csvFile() {
+
+	return *hostfs::files["/data.csv"];
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	// 40 titles, more than the 16 the table used to hold, none come back as Unknown
+
+	hostfs::reset();
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(csvRows(0, 200, 40));
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogCount() == 200);
+	CHECK(exportAll(4096) == csvFile());
+
+	// Buffers shorter than a line still make progress, every size gives the same bytes
+
+	for (size_t size = 1; size <= 100; size++) {
+		CHECK(exportAll(size) == csvFile());
+	}
+
+	// A log that agrees with the CSV file is kept as it is
+
+	hostfs::bytesWritten = 0;
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogCount() == 200);
+	CHECK(hostfs::bytesWritten == 0);
+
+	// The CSV file lost its last rows to a power cut, the log is rebuilt to match it
+
+	csvFile() = csvRows(0, 197, 40);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogCount() == 197);
+	CHECK(exportAll(1460) == csvFile());
+
+	// The log lost its last rows instead
+
+	csvFile() = csvRows(0, 203, 40);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogCount() == 203);
+	CHECK(exportAll(1460) == csvFile());
+
+	// Fewer rows than are compared, blank lines and a row padded past a stored line all count the
+	// same way the table reader counts them
+
+	csvFile() = row(0, 40) + "\r\n  \r\n" + std::string(100, ' ') + row(1, 40);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogCount() == 2);
+
+	hostfs::bytesWritten = 0;
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(hostfs::bytesWritten == 0);
+
+	// Rows in time order can be searched, the find lands on the first record at or after a time
+
+	hostfs::reset();
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(csvRows(0, 100, 4));
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogOrdered());
+
+	binaryLogRecord record;
+	uint32_t index = 0;
+
+	CHECK(binaryLogReadRecord(40, record));
+	CHECK(binaryLogFind(record.epoch, index) && index == 40);
+	CHECK(binaryLogFind(record.epoch + 1, index) && index == 41);
+	CHECK(binaryLogFind(UINT32_MAX, index) && index == 100);
+
+	// A record the card doesnt return is an error, not somewhere to stop
+
+	const std::string log = *hostfs::files[binaryLogName];
+
+	hostfs::files[binaryLogName]->resize(sizeof(binaryLogHeader) + 50 * sizeof(binaryLogRecord));
+	CHECK(!binaryLogFind(record.epoch, index));
+
+	*hostfs::files[binaryLogName] = log;
+
+	// The clock was set back, the header cant be written so neither is the record
+
+	std::string early = row(10, 4);
+	bleSignal entry = parseCSVLine(early.c_str(), early.size() - 2);
+
+	hostfs::writesLeft = 0;
+	CHECK(binaryLogAppend(entry) == noLogRecord);
+	hostfs::writesLeft = -1;
+
+	CHECK(binaryLogCount() == 100);
+
+	// Then it can, the log is no longer searched and stays that way after a restart
+
+	CHECK(binaryLogAppend(entry) == 100);
+	CHECK(!binaryLogOrdered());
+	CHECK(!binaryLogFind(record.epoch, index));
+
+	binaryLogSync();
+	csvFile() += early;
+	hostfs::bytesWritten = 0;
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(hostfs::bytesWritten == 0);
+	CHECK(binaryLogCount() == 101);
+	CHECK(!binaryLogOrdered());
+
+	// A date that couldnt be read is stored as time 0, which is out of order too
+
+	csvFile() = csvRows(0, 5, 4) + "Title 9,not a date,08:00:00,U,50%\r\n" + csvRows(5, 5, 4);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogCount() == 11);
+	CHECK(!binaryLogOrdered());
+
+	// The longest title a frame can carry comes back whole, from the log and in the export
+
+	std::string title = "Smoke Alarm Kitchen " + std::string(titleLength - 20, 'K');
+
+	csvFile() = title + ",12-03-2024,08:15:02,U,87%\r\n" + row(1, 40);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	CHECK(binaryLogRead(0, entry) && title == entry.title);
+	CHECK(exportAll(64) == csvFile());
+
+	// And reaches the CSV file whole when it arrives as a detection
+
+	std::string arrived = title + ",12-03-2024,08:15:03,U,88%";
+
+	appendFile(SD, "/data.csv", parseCSVLine(arrived.c_str(), arrived.size()));
+	logWriterSync();
+
+	CHECK(csvFile().size() >= arrived.size() + 2);
+	CHECK(csvFile().compare(csvFile().size() - arrived.size() - 2, std::string::npos, arrived + "\r\n") == 0);
+
+	// One character more is reported rather than cut without a word
+
+	std::string longer = title + "S";
+
+	CHECK(setField(entry.title, title.c_str(), title.c_str() + title.size()));
+	CHECK(!setField(entry.title, longer.c_str(), longer.c_str() + longer.size()));
+
+	return HOST_RESULT();
+
+} // Close function
@@ -0,0 +1,162 @@
+//
+// test_categoryCrash.cpp
+//
+// Cuts the power after every write a category change makes, restarts, and checks the CSV file and
+// the binary log agree. Also checks the log is left alone, with no change noted, when the CSV byte
+// is not changed, and that a delete past the row being looked at for U moves the change back to
+// the right record.
+//
+
+#include <SD.h>
+
+#include "host.h"
+#include "binaryLog.h"
+#include "logWriter.h"
+
+/*---------------------------------------------------------------- */
+
+static const char* rows =
+	"Siren,12-03-2024,08:15:02,A,87%\r\n"
+	"Fire Alarm,12-03-2024,08:16:40,F,92%\r\n"
+	"Doorbell,12-03-2024,08:17:03,U,55%\r\n"
+	"\r\n"
+	"Siren,12-03-2024,08:19:44,P,70%\r\n"
+	"Smoke Alarm,12-03-2024,08:21:09,U,61%\r\n"
+	"Siren,12-03-2024,08:25:18,O,66%\r\n"
+	"Siren,12-03-2024,08:31:52,A,90%\r\n"
+	"Doorbell,12-03-2024,08:40:07,U,58%\r\n"
+	"Fire Alarm,12-03-2024,08:44:30,ME-F,100%\r\n";
+
+static const uint32_t changedRecord = 2;		// Far enough from the end that the start up check doesnt compare it
+static const char categories[] = "AFUPUOAUF";
+
+// Fresh copies of both files, as they were before the change was started
+
+static void restore(const std::string& csv, const std::string& log) {
+
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(csv);
+	hostfs::files[binaryLogName] = std::make_shared<std::string>(log);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+}
+
+static uint32_t pendingOffset() {
+
+	binaryLogHeader header;
+
+	memcpy(&header, hostfs::files[binaryLogName]->data(), sizeof(header));
+
+	return header.pendingOffset;
+}
+
+static char recordCategory(uint32_t index) {
+
+	binaryLogRecord record;
+
+	return binaryLogReadRecord(index, record) ? record.category : '?';
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	hostfs::reset();
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(rows);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+
+	const std::string csv = *hostfs::files["/data.csv"];
+	const std::string log = *hostfs::files[binaryLogName];
+	const size_t uOffset = csv.find(",U,") + 1;
+
+	// Cut after 0, 1, 2 ... writes until the change runs to the end
+
+	char last = 0;
+
+	for (long writes = 0; writes < 20; writes++) {
+
+		restore(csv, log);
+
+		CHECK(beginCategorise(SD, "/data.csv"));
+
+		hostfs::writesLeft = writes;
+		applyCategory(SD, "/data.csv", 'A');
+		hostfs::writesLeft = -1;
+
+		// Restart
+
+		CHECK(binaryLogBegin(SD, "/data.csv"));
+
+		const std::string& after = *hostfs::files["/data.csv"];
+		char csvCategory = after[uOffset];
+
+		// The CSV row is U or A, never torn, and nothing else in the file moved
+
+		CHECK(csvCategory == 'U' || csvCategory == 'A');
+		CHECK(after.substr(0, uOffset) == csv.substr(0, uOffset));
+		CHECK(after.substr(uOffset + 1) == csv.substr(uOffset + 1));
+
+		// The log says the same, and every other record is untouched
+
+		CHECK(binaryLogCount() == strlen(categories));
+		CHECK(recordCategory(changedRecord) == csvCategory);
+
+		for (uint32_t i = 0; i < binaryLogCount(); i++) {
+			if (i != changedRecord) CHECK(recordCategory(i) == categories[i]);
+		}
+
+		last = csvCategory;
+	}
+
+	// Given enough writes the change goes through
+
+	CHECK(last == 'A');
+
+	// The row was changed some other way while it was on screen, the CSV byte isnt written and
+	// the log must not move either
+
+	restore(csv, log);
+
+	CHECK(beginCategorise(SD, "/data.csv"));
+
+	(*hostfs::files["/data.csv"])[uOffset] = 'P';
+
+	applyCategory(SD, "/data.csv", 'A');
+
+	CHECK((*hostfs::files["/data.csv"])[uOffset] == 'P');
+	CHECK(recordCategory(changedRecord) == 'U');
+
+	// Nor is the change left noted in the log header
+
+	CHECK(pendingOffset() == 0);
+
+	// The first U is changed and the next is looked at, then the last six rows are deleted with it
+
+	restore(csv, log);
+
+	CHECK(beginCategorise(SD, "/data.csv"));
+	applyCategory(SD, "/data.csv", 'A');
+	CHECK(beginCategorise(SD, "/data.csv"));
+
+	deleteLastEntry(SD, "/data.csv", 6);
+
+	CHECK(binaryLogCount() == 3);
+
+	// A new detection is the next U, and its own record takes the change
+
+	std::string line = "Siren,12-03-2024,09:02:11,U,73%";
+
+	appendFile(SD, "/data.csv", parseCSVLine(line.c_str(), line.size()));
+	logWriterSync();
+
+	CHECK(beginCategorise(SD, "/data.csv"));
+	applyCategory(SD, "/data.csv", 'F');
+
+	CHECK(hostfs::files["/data.csv"]->find("Siren,12-03-2024,09:02:11,F,73%") != std::string::npos);
+	CHECK(binaryLogCount() == 4);
+	CHECK(recordCategory(2) == 'A');
+	CHECK(recordCategory(3) == 'F');
+
+	return HOST_RESULT();
+
+} // Close function
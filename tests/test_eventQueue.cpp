@@ -0,0 +1,126 @@
+//
+// test_eventQueue.cpp
+//
+// Rereading the table from SD while detections are still queued keeps them, the queue is written
+// out before the file is read. Open pages only hear of a detection once it is stored, under the
+// record number the log gave it. Then ingest floods the queue while the persistence task drains it
+// on its own thread: every detection is either stored once, in order, or counted as dropped.
+//
+
+#include <ESPAsyncWebSrv.h>
+#include <thread>
+#include <unistd.h>
+
+#include "host.h"
+#include "eventQueue.h"
+#include "parseDataReceived.h"
+#include "binaryLog.h"
+#include "wifiSystem.h"
+#include "spiBus.h"
+#include "logWriter.h"
+
+extern int numEntries;
+extern AsyncEventSource events;
+
+/*---------------------------------------------------------------- */
+
+static const int floodEvents = 50000;
+static const int burst = 64;					// Pushed back to back, four times the queue
+
+static std::string floodLine(int i) {
+
+	char line[48];
+	snprintf(line, sizeof(line), "Event %d,12-03-2024,09:%02d:%02d,U,%d%%", i, i / 60 % 60, i % 60, i % 101);
+	return line;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	hostfs::reset();
+	hostfs::files["/data.csv"] = std::make_shared<std::string>("Siren,12-03-2024,08:15:02,U,87%\n");
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+	beginWebEvents(binaryLogCount());
+
+	// Two detections shown in the table but not yet written by the persistence task
+
+	bleSignal first = parseCSVLine("Fire Alarm,12-03-2024,08:16:40,U,92%", 36);
+	bleSignal second = parseCSVLine("Doorbell,12-03-2024,08:17:03,U,55%", 34);
+
+	CHECK(pushEvent(first));
+	CHECK(pushEvent(second));
+
+	CHECK(events.sent.empty());
+
+	populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
+
+	CHECK(eventQueueDepth() == 0);
+	CHECK(numEntries == 3);
+	CHECK(strcmp(dataEntries[0].title, "Doorbell") == 0);
+	CHECK(strcmp(dataEntries[1].title, "Fire Alarm") == 0);
+	CHECK(strcmp(dataEntries[2].title, "Siren") == 0);
+
+	// And they are in the file in arrival order, once each, with the log writer's line endings
+
+	CHECK(*hostfs::files["/data.csv"] == "Siren,12-03-2024,08:15:02,U,87%\n"
+		"Fire Alarm,12-03-2024,08:16:40,U,92%\r\n"
+		"Doorbell,12-03-2024,08:17:03,U,55%\r\n");
+
+	CHECK(binaryLogCount() == 3);
+	CHECK(events.sent.size() == 2);
+	CHECK(events.sent[0].message.compare(0, 9, "{\"row\":1,") == 0);
+	CHECK(events.sent[1].message.compare(0, 9, "{\"row\":2,") == 0);
+	CHECK(events.sent[1].id == events.sent[0].id + 1);
+
+	// The storage lock is real from here, and the persistence task runs on its own thread
+
+	beginSpiBus(15, 21, 5);
+	startPersistenceTask();
+
+	std::string expected = *hostfs::files["/data.csv"];
+	uint32_t stored = binaryLogCount();
+	uint32_t dropped = 0;
+
+	for (int i = 0; i < floodEvents; i++) {
+
+		std::string line = floodLine(i);
+
+		if (pushEvent(parseCSVLine(line.c_str(), line.size()))) {
+			expected += line + "\r\n";
+			stored++;
+		}
+
+		else dropped++;
+
+		if (i % burst == burst - 1) std::this_thread::yield();
+	}
+
+	// Wait for the task to catch up, then hold the lock so it cant start another pass
+
+	for (int i = 0; i < 10000 && eventQueueDepth() > 0; i++) usleep(1000);
+
+	lockStorage();
+	logWriterSync();
+
+	CHECK(eventQueueDepth() == 0);
+	CHECK(stored > 3);
+	CHECK(eventQueueDrops() == dropped);
+	CHECK(eventQueueHighWater() <= eventQueueSize);
+	CHECK(dropped == 0 || eventQueueHighWater() == eventQueueSize);
+
+	CHECK(*hostfs::files["/data.csv"] == expected);
+	CHECK(binaryLogCount() == stored);
+
+	printf("%d detections, %lu stored, %lu dropped, queue high water %lu\n", floodEvents,
+		(unsigned long)stored - 3, (unsigned long)dropped, (unsigned long)eventQueueHighWater());
+
+	// The task never returns, so leave without running destructors under it
+
+	int result = HOST_RESULT();
+
+	fflush(stdout);
+	_exit(result);
+
+} // Close function
@@ -0,0 +1,92 @@
+//
+// test_logWriter.cpp
+//
+// Short writes keep the bytes the card didnt take, so once it recovers the file holds every line
+// exactly once and in order. A line that doesnt fit is refused whole, never torn.
+//
+
+#include <SD.h>
+
+#include "host.h"
+#include "logWriter.h"
+
+/*---------------------------------------------------------------- */
+
+static std::string line(int i) {
+
+	char text[48];
+	snprintf(text, sizeof(text), "Siren %d,12-03-2024,08:15:%02d,U,%d%%", i, i % 60, i % 100);
+	return text;
+}
+
+// Append count lines, the expected file contents are added to expected
+
+static int append(int first, int count, std::string& expected) {
+
+	int accepted = 0;
+
+	for (int i = first; i < first + count; i++) {
+		if (logWriterAppend(SD, "/data.csv", line(i).c_str())) accepted++;
+		expected += line(i) + "\r\n";
+	}
+
+	return accepted;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	// Every cut point in the first few sectors, the card taking nothing more until it recovers
+
+	for (long budget = 0; budget < 3 * (long)logBufferSize; budget += 7) {
+
+		hostfs::reset();
+		std::string expected;
+
+		CHECK(append(0, 5, expected) == 5);
+
+		hostfs::writeBudget = budget;
+
+		CHECK(append(5, 5, expected) == 5);
+		logWriterSync();
+
+		hostfs::writeBudget = -1;
+
+		CHECK(append(10, 20, expected) == 20);
+		logWriterClose();
+
+		CHECK(*hostfs::files["/data.csv"] == expected);
+	}
+
+	// A card that stops taking data: appends fail once the buffer is full, and nothing hangs. Once
+	// it recovers the file holds every line that was accepted, whole and in order, and nothing else.
+
+	for (long budget : { 0, 7, 100, 600 }) {
+
+		hostfs::reset();
+		hostfs::writeBudget = budget;
+
+		std::string expected;
+		int accepted = 0;
+
+		for (int i = 0; i < 100; i++) {
+			if (logWriterAppend(SD, "/data.csv", line(i).c_str())) {
+				expected += line(i) + "\r\n";
+				accepted++;
+			}
+		}
+
+		CHECK(accepted < 100);
+
+		hostfs::writeBudget = -1;
+
+		CHECK(append(100, 5, expected) == 5);
+		logWriterClose();
+
+		CHECK(*hostfs::files["/data.csv"] == expected);
+	}
+
+	return HOST_RESULT();
+
+} // Close function
@@ -0,0 +1,87 @@
+//
+// test_populateArrayFromCSV.cpp
+//
+// Reads the last ten rows back from data files with blank lines, whitespace padding longer than
+// a stored line and no final line ending, and checks every read finishes
+//
+
+#include <unistd.h>
+
+#include "host.h"
+#include "parseDataReceived.h"
+
+extern int numEntries;
+
+/*---------------------------------------------------------------- */
+
+// Write a data file and read its tail back into dataEntries
+
+static void load(const std::string& contents) {
+
+	hostfs::reset();
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(contents);
+
+	populateArrayFromCSV(SD, "/data.csv", dataEntries, maxEntries);
+}
+
+static std::string row(int i) {
+
+	char line[64];
+	snprintf(line, sizeof(line), "Siren %d,12-03-2024,08:15:%02d,U,%d%%\n", i, i % 60, i % 100);
+	return line;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	// A hang here is the bug being tested for, so give up rather than spin
+
+	alarm(10);
+
+	// Plain file, newest row first in the array
+
+	std::string csv;
+	for (int i = 0; i < 25; i++) csv += row(i);
+
+	load(csv);
+
+	CHECK(numEntries == maxEntries);
+	CHECK(strcmp(dataEntries[0].title, "Siren 24") == 0);
+	CHECK(strcmp(dataEntries[9].title, "Siren 15") == 0);
+
+	// Blank and whitespace only lines between rows are skipped, including ones longer than a stored line
+
+	load(row(1) + "\n   \n" + std::string(200, ' ') + "\n" + row(2) + "\r\n" + row(3) + std::string(120, ' '));
+
+	CHECK(numEntries == 3);
+	CHECK(strcmp(dataEntries[0].title, "Siren 3") == 0);
+	CHECK(strcmp(dataEntries[2].title, "Siren 1") == 0);
+
+	// A row padded with more leading spaces than a stored line holds is still a row, whether or not
+	// it is the last one, and the read stops at the end of the file
+
+	std::string padded = std::string(100, ' ') + row(9);
+
+	load(row(1) + padded + row(2) + padded);
+
+	CHECK(numEntries == 4);
+	CHECK(strcmp(dataEntries[3].title, "Siren 1") == 0);
+	CHECK(strcmp(dataEntries[2].title, "Siren 9") == 0);
+	CHECK(strcmp(dataEntries[1].title, "Siren 2") == 0);
+
+	load(padded.substr(0, padded.size() - 1));
+
+	CHECK(numEntries == 1);
+
+	// Only whitespace, and nothing at all
+
+	load(std::string(300, ' '));
+	CHECK(numEntries == 0);
+
+	load("");
+	CHECK(numEntries == 0);
+
+	return HOST_RESULT();
+
+} // Close function
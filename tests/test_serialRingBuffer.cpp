@@ -0,0 +1,123 @@
+//
+// test_serialRingBuffer.cpp
+//
+// Replays a stream of frames through the UART ring, split at every possible byte boundary,
+// fed a byte at a time, and with frames that wrap the end of the ring
+//
+
+#include <vector>
+
+#include "host.h"
+#include "serialRingBuffer.h"
+
+/*---------------------------------------------------------------- */
+
+// Take every complete frame out of the ring
+
+static void drain(std::vector<std::string>& frames) {
+
+	frameSlice frame;
+
+	while (nextFrame(frame)) {
+		frames.push_back(std::string(frame.data, frame.length));
+		releaseFrame(frame);
+	}
+}
+
+/*---------------------------------------------------------------- */
+
+// Feed the stream in the given chunks, draining after each
+
+static std::vector<std::string> replay(const std::string& stream, const std::vector<size_t>& cuts) {
+
+	std::vector<std::string> frames;
+	size_t start = 0;
+
+	for (size_t cut : cuts) {
+		Serial2.input.append(stream, start, cut - start);
+		serialRingReceive();
+		drain(frames);
+		start = cut;
+	}
+
+	Serial2.input.append(stream, start, std::string::npos);
+	serialRingReceive();
+	drain(frames);
+
+	return frames;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	beginSerialRing(Serial2);
+
+	// Frames of every length from empty to the longest allowed, so over many replays the
+	// start of a frame lands on every position of the ring, wrapping ones included
+
+	std::vector<std::string> expected;
+	std::string stream;
+
+	for (size_t length = 0; length <= maxFrameLength; length += 7) {
+
+		std::string frame = "Siren," + std::to_string(length) + ",";
+		frame.resize(length, 'x');
+		frame = frame.substr(0, length);
+
+		expected.push_back(frame);
+		stream += frame + "%";
+	}
+
+	CHECK(stream.size() > serialRingSize / 2);
+
+	// One split at every boundary
+
+	for (size_t cut = 0; cut <= stream.size(); cut++) {
+		CHECK(replay(stream, { cut }) == expected);
+	}
+
+	// Two splits, every pair a few bytes apart
+
+	for (size_t a = 0; a + 5 <= stream.size(); a += 3) {
+		CHECK(replay(stream, { a, a + 1, a + 5 }) == expected);
+	}
+
+	// A byte at a time
+
+	std::vector<size_t> bytes;
+
+	for (size_t i = 1; i < stream.size(); i++) bytes.push_back(i);
+
+	CHECK(replay(stream, bytes) == expected);
+
+	CHECK(serialRingDropped() == 0);
+
+	// A frame too long for the ring is dropped, the next one still comes through
+
+	std::string longFrame(maxFrameLength + 10, 'y');
+	std::vector<std::string> frames = replay(longFrame + "%" + "good%", { 20, maxFrameLength + 5 });
+
+	CHECK(frames.size() == 1 && frames[0] == "good");
+	CHECK(serialRingDropped() > maxFrameLength);
+
+	// Unread frames are not overwritten when the ring fills, the excess is dropped
+
+	uint32_t droppedBefore = serialRingDropped();
+	std::string burst;
+
+	while (burst.size() < serialRingSize * 2) burst += "burst%";
+
+	Serial2.input = burst;
+	serialRingReceive();
+
+	CHECK(serialRingDropped() - droppedBefore == burst.size() - serialRingSize);
+
+	frames.clear();
+	drain(frames);
+
+	CHECK(frames.size() == serialRingSize / 6);
+	CHECK(std::all_of(frames.begin(), frames.end(), [](const std::string& f) { return f == "burst"; }));
+
+	return HOST_RESULT();
+}
@@ -0,0 +1,149 @@
+//
+// test_statsRollup.cpp
+//
+// Categorises rows and checks the counts kept as it happens match a fresh count of the log, the
+// confidence of each row moving with it. Also checks the file is only rewritten after a batch of
+// changes or a while, and that a restart before then still comes back with the right counts.
+//
+
+#include <SD.h>
+
+#include "host.h"
+#include "binaryLog.h"
+#include "statsRollup.h"
+
+/*---------------------------------------------------------------- */
+
+static std::string row(int i) {
+
+	char line[64];
+	snprintf(line, sizeof(line), "Siren %d,12-03-2024,%02d:%02d:00,U,%d%%\r\n", i % 3, 8 + i / 60, i % 60, 40 + i * 7 % 61);
+	return line;
+}
+
+static void catchUp() {
+
+	for (int i = 0; i < 100 && !statsPoll(); i++);
+
+	CHECK(statsReady());
+}
+
+static void categorise(const char* categories) {
+
+	for (const char* c = categories; *c; c++) {
+		CHECK(beginCategorise(SD, "/data.csv"));
+		applyCategory(SD, "/data.csv", *c);
+	}
+}
+
+// Counts that should match, whether kept as changes came in or counted again from the log
+
+static bool sameCounts(const statsRollup& a, const statsRollup& b) {
+
+	return a.covered == b.covered && a.newestHour == b.newestHour
+		&& memcmp(a.totals, b.totals, sizeof(a.totals)) == 0
+		&& memcmp(a.hours, b.hours, sizeof(a.hours)) == 0
+		&& memcmp(a.days, b.days, sizeof(a.days)) == 0;
+}
+
+static std::string& statsFile() {
+
+	return *hostfs::files[statsFileName];
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	hostfs::reset();
+
+	std::string csv;
+	for (int i = 0; i < 30; i++) csv += row(i);
+
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(csv);
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+
+	statsBegin(SD);
+	catchUp();
+
+	// Every row arrives as U and is categorised later
+
+	categorise("AFPAOFA");
+
+	statsRollup kept = statsData();
+
+	// No category averages more than 100 percent
+
+	for (const statsTotal& total : kept.totals) CHECK(total.confidence <= total.count * 100);
+
+	CHECK(kept.totals[0].count == 23);
+
+	// A count from scratch agrees
+
+	hostfs::files.erase(statsFileName);
+
+	statsBegin(SD);
+	catchUp();
+
+	CHECK(sameCounts(statsData(), kept));
+
+	// A few changes dont rewrite the file
+
+	const std::string saved = statsFile();
+
+	categorise("PF");
+	catchUp();
+
+	CHECK(statsFile() == saved);
+
+	// The power goes before they are saved, the file doesnt know of the changes and is counted again
+
+	kept = statsData();
+
+	CHECK(binaryLogBegin(SD, "/data.csv"));
+
+	statsBegin(SD);
+	catchUp();
+
+	CHECK(sameCounts(statsData(), kept));
+
+	// Saved once the interval has passed
+
+	const std::string rebuilt = statsFile();
+
+	categorise("O");
+	catchUp();
+
+	CHECK(statsFile() == rebuilt);
+
+	hostClock += statsSaveInterval;
+	catchUp();
+
+	CHECK(statsFile() != rebuilt);
+
+	// Then loaded as it is at the next start
+
+	kept = statsData();
+
+	statsBegin(SD);
+
+	CHECK(statsReady());
+	CHECK(sameCounts(statsData(), kept));
+
+	// Or straight away after a batch of changes
+
+	const std::string before = statsFile();
+
+	for (int i = 0; i < statsSaveChanges; i++) {
+		std::string line = row(30 + i);
+		binaryLogAppend(parseCSVLine(line.c_str(), line.size() - 2));
+	}
+
+	catchUp();
+
+	CHECK(statsFile() != before);
+
+	return HOST_RESULT();
+
+} // Close function
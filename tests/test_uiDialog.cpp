@@ -0,0 +1,137 @@
+//
+// test_uiDialog.cpp
+//
+// Runs loop()'s ingest and dialog steps a millisecond at a time while a sensor streams frames at
+// the UART's full rate, with the categorise dialog open for most of the run. Every frame has to be
+// taken from the ring in the pass it completes in, none may be dropped, and the detections made
+// while the dialog is up must reach the CSV file once it closes.
+//
+
+#include "host.h"
+#include "serialRingBuffer.h"
+#include "parseDataReceived.h"
+#include "eventQueue.h"
+#include "userInterface.h"
+#include "screenWidgets.h"
+
+/*---------------------------------------------------------------- */
+
+static const unsigned long framePeriod = 100;		// A frame from the sensor every 100 ms
+static const size_t bytesPerMs = 11;				// 115200 baud, 10 bits a byte
+
+static std::string wire;							// Bytes the sensor has sent that the UART hasnt delivered yet
+static unsigned long framesSent = 0;
+static unsigned long lastFrame = 0;
+
+// One pass of loop(): the UART delivers what arrived this millisecond, then the dialog and ingest run
+
+static void pass() {
+
+	hostClock++;
+
+	if (hostClock - lastFrame >= framePeriod) {
+
+		char frame[48];
+
+		snprintf(frame, sizeof(frame), "Siren %lu,12-03-2024,08:15:02,U,87%%", framesSent++);
+		wire += frame;
+
+		lastFrame = hostClock;
+	}
+
+	size_t n = min(wire.size(), bytesPerMs);
+
+	Serial2.input.append(wire, 0, n);
+	wire.erase(0, n);
+	serialRingReceive();
+
+	uiTick();
+
+	if (serialRingAvailable()) parseData();
+
+	// Nothing complete is left behind for a later pass
+
+	frameSlice frame;
+
+	CHECK(!nextFrame(frame));
+}
+
+static void run(unsigned long ms) {
+
+	for (unsigned long i = 0; i < ms; i++) pass();
+}
+
+// Press the middle of a widget
+
+static void press(int x, int y, int w, int h) {
+
+	CHECK(uiTouch(x + w / 2, y + h / 2));
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	hostfs::reset();
+	hostfs::files["/data.csv"] = std::make_shared<std::string>(
+		"Siren,12-03-2024,07:15:02,A,87%\r\n"
+		"Doorbell,12-03-2024,07:17:03,U,55%\r\n");
+
+	beginSerialRing(Serial2);
+
+	hostClock = 20000;							// Past the detection wait periods
+
+	// Update categories? then Yes, the row to change and the category buttons come up
+
+	press(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H);
+	CHECK(uiCurrentState() == uiHold);
+
+	run(uiMessageTime + 1);
+	CHECK(uiCurrentState() == uiConfirm);
+
+	run(5000);
+
+	press(BUTTON3_X, BUTTON3_Y, BUTTON3_W, BUTTON3_H);
+	CHECK(uiCurrentState() == uiChooseCategory);
+
+	// Nobody answers for a while, the sensor keeps sending
+
+	run(30000);
+
+	CHECK(uiCurrentState() == uiChooseCategory);
+	CHECK(serialRingDropped() == 0);
+	CHECK(eventQueueDrops() == 0);
+	CHECK(newDataReceived);
+
+	unsigned long sent = framesSent;
+	uint32_t queued = eventQueueDepth();
+
+	CHECK(sent > 300);
+	CHECK(queued >= 3);
+
+	// Choosing P goes back to the main menu, the row is changed and the queued detections are written
+
+	press(BUTTON1_X, BUTTON1_Y, BUTTON1_W, BUTTON1_H);
+	CHECK(uiCurrentState() == uiIdle);
+
+	const std::string& csv = *hostfs::files["/data.csv"];
+
+	CHECK(csv.find("Doorbell,12-03-2024,07:17:03,P,55%") != std::string::npos);
+	CHECK(eventQueueDepth() == 0);
+
+	size_t written = 0;
+
+	for (size_t at = csv.find("Siren "); at != std::string::npos; at = csv.find("Siren ", at + 1)) written++;
+
+	CHECK(written == queued);
+
+	// The frames still on the wire come in too
+
+	while (!wire.empty()) run(1);
+
+	CHECK(serialRingDropped() == 0);
+	CHECK(!serialRingAvailable());
+
+	return HOST_RESULT();
+
+} // Close function
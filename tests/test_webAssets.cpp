@@ -0,0 +1,86 @@
+//
+// test_webAssets.cpp
+//
+// Routes made from the asset manifest when the card doesnt hold every file it lists: a missing file
+// gets no route, a missing .gz is sent plain, and a file removed after start up is a 404
+//
+
+#include <ESPAsyncWebSrv.h>
+#include <SPIFFS.h>
+
+#include "host.h"
+#include "webAssets.h"
+
+/*---------------------------------------------------------------- */
+
+static AsyncWebServer server(80);
+
+static void addFile(const char* path, const char* contents) {
+
+	hostfs::files[path] = std::make_shared<std::string>(contents);
+}
+
+// Ask for uri as a browser that takes gzip, false if there is no route
+
+static bool fetch(const char* uri, AsyncWebServerRequest& req) {
+
+	req.requestHeaders["Accept-Encoding"] = "gzip, deflate";
+
+	return server.get(uri, req) && req.sent;
+}
+
+/*---------------------------------------------------------------- */
+
+int main() {
+
+	hostfs::reset();
+
+	addFile(assetManifestName,
+		"# name hash gzip\n"
+		"index.html 0a1b2c3d 1\n"
+		"app.js 4e5f6a7b 1\n"
+		"style.css 8c9d0e1f 0\n");
+
+	addFile("/index.html", "<html></html>");
+	addFile("/index.html.gz", "gzipped page");
+	addFile("/app.js", "let x;");						// No app.js.gz and no style.css
+
+	CHECK(serveAssets(server, SPIFFS));
+
+	// Listed and on the card, gzipped
+
+	AsyncWebServerRequest page;
+
+	CHECK(fetch("/", page));
+	CHECK(page.sent->code == 200);
+	CHECK(page.sent->body == "gzipped page");
+	CHECK(page.sent->headers["Content-Encoding"] == "gzip");
+
+	// The .gz is missing, the plain file goes out with the plain tag
+
+	AsyncWebServerRequest script;
+
+	CHECK(fetch("/app.js", script));
+	CHECK(script.sent->code == 200);
+	CHECK(script.sent->body == "let x;");
+	CHECK(script.sent->headers.count("Content-Encoding") == 0);
+	CHECK(script.sent->headers["ETag"] == "\"4e5f6a7b\"");
+
+	// Not on the card, no route is added for it
+
+	AsyncWebServerRequest style;
+
+	CHECK(!fetch("/style.css", style));
+
+	// Removed after start up, a 404 rather than a NULL response
+
+	hostfs::files.erase("/index.html.gz");
+
+	AsyncWebServerRequest gone;
+
+	CHECK(fetch("/index.html", gone));
+	CHECK(gone.sent->code == 404);
+
+	return HOST_RESULT();
+
+} // Close function
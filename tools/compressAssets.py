@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+# compressAssets.py
+#
+# Prepares the web files in data/ for upload to SPIFFS. Each file gets a content hash, text files
+# get a gzip copy beside them (name.gz), and the pages are rewritten to load script.js?v=hash so a
+# browser can keep them for a year and still picks up a new upload straight away.
+#
+# The hashes are listed in data/assets.txt, the web server uses them as ETags (webAssets.cpp).
+#
+# Usage: python3 tools/compressAssets.py   (run from the sketch folder, before uploading data/)
+#
+
+import gzip
+import hashlib
+import os
+import re
+
+DATA = "data"
+MANIFEST = "assets.txt"
+PAGES = ["index.html", "wifimanager.html"]		# Sent no-cache, they name the other files
+COMPRESS = (".html", ".js", ".css")				# PNGs are already compressed
+HASH_LENGTH = 8
+
+
+def content_hash(data):
+	return hashlib.sha256(data).hexdigest()[:HASH_LENGTH]
+
+
+def versioned(page, hashes):
+	# Point src / href at name?v=hash, replacing any older hash
+
+	text = page.decode("utf-8")
+
+	for name, digest in hashes.items():
+		pattern = r'((?:src|href)=")' + re.escape(name) + r'(?:\?v=[0-9a-f]+)?"'
+		text = re.sub(pattern, r"\g<1>" + name + "?v=" + digest + '"', text)
+
+	return text.encode("utf-8")
+
+
+def write_gzip(path, data):
+	# mtime 0 keeps the output identical from one run to the next
+
+	packed = gzip.compress(data, 9, mtime=0)
+
+	if len(packed) < len(data):
+		with open(path + ".gz", "wb") as f:
+			f.write(packed)
+		return len(packed)
+
+	if os.path.exists(path + ".gz"):
+		os.remove(path + ".gz")
+
+	return None
+
+
+def main():
+	names = sorted(n for n in os.listdir(DATA)
+		if os.path.isfile(os.path.join(DATA, n)) and not n.endswith(".gz") and n != MANIFEST)
+
+	assets = [n for n in names if n not in PAGES]
+	pages = [n for n in names if n in PAGES]
+
+	hashes = {}
+
+	for name in assets:
+		with open(os.path.join(DATA, name), "rb") as f:
+			hashes[name] = content_hash(f.read())
+
+	# Pages last, their hash covers the versioned links
+
+	for name in pages:
+		path = os.path.join(DATA, name)
+
+		with open(path, "rb") as f:
+			page = versioned(f.read(), hashes)
+
+		with open(path, "wb") as f:
+			f.write(page)
+
+		hashes[name] = content_hash(page)
+
+	lines = ["# name hash gzip, written by tools/compressAssets.py"]
+	total = packed_total = 0
+
+	for name in names:
+		path = os.path.join(DATA, name)
+
+		with open(path, "rb") as f:
+			data = f.read()
+
+		packed = write_gzip(path, data) if name.endswith(COMPRESS) else None
+
+		lines.append("%s %s %d" % (name, hashes[name], 1 if packed else 0))
+
+		total += len(data)
+		packed_total += packed if packed else len(data)
+
+		print("%-20s %s %6d -> %6d" % (name, hashes[name], len(data), packed if packed else len(data)))
+
+	with open(os.path.join(DATA, MANIFEST), "w", newline="\n") as f:
+		f.write("\n".join(lines) + "\n")
+
+	print("%-20s %s %6d -> %6d" % ("total", " " * HASH_LENGTH, total, packed_total))
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+#
+# convertIcons.py
+#
+# Converts the raw RGB565 arrays in assets/icons.h and assets/startScreen.h into the
+# run length encoded, palette indexed format drawIcon() decodes (iconAssets.h / .cpp).
+#
+# Colour variants of one icon (red / amber / green) are stored once: each palette entry
+# holds a neutral colour and a tint strength, the variant only supplies the tint colour.
+#
+# Usage: python3 tools/convertIcons.py   (run from the sketch folder)
+#
+
+import os
+import re
+
+SOURCES = ["assets/icons.h", "assets/startScreen.h"]
+HEADER = "iconAssets.h"
+SOURCE = "iconAssets.cpp"
+
+# Icons drawn in more than one colour, the key names the shared data. The SD card icons
+# differ in shape as well as colour, so they stay separate.
+
+VARIANTS = {
+	"wiFi": ["wiFiRed", "wiFiGreen", "wiFiAmber"],
+	"pulse": ["pulseRed", "pulseAmber", "pulseGreen"],
+}
+
+# Width & height, the arrays themselves dont record them
+
+SIZES = {
+	"startScreen": (128, 128),
+}
+
+ALPHA_LEVELS = 15			# Tint strength is stored as 0 - 15
+TINT_TOLERANCE = 3			# Largest error allowed in any one channel of a tinted pixel, in RGB565 steps
+
+
+def read_icons():
+	icons = {}
+	for path in SOURCES:
+		text = open(path).read()
+		for match in re.finditer(r"const uint16_t (\w+)\[\] PROGMEM = \{(.*?)\};", text, re.S):
+			icons[match.group(1)] = [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", match.group(2))]
+	return icons
+
+
+def size_of(name, pixels):
+	if name in SIZES:
+		return SIZES[name]
+	side = int(len(pixels) ** 0.5)
+	assert side * side == len(pixels), name
+	return side, side
+
+
+def to_rgb(c):
+	return ((c >> 11) & 31) / 31.0, ((c >> 5) & 63) / 63.0, (c & 31) / 31.0
+
+
+def to_565(rgb):
+	r, g, b = (min(max(v, 0.0), 1.0) for v in rgb)
+	return (round(r * 31) << 11) | (round(g * 63) << 5) | round(b * 31)
+
+
+def blend(neutral, tint, alpha):
+	# Must match blendTint() in drawBitmap.cpp
+	if alpha == 0:
+		return neutral
+	nr, ng, nb = (neutral >> 11) & 31, (neutral >> 5) & 63, neutral & 31
+	tr, tg, tb = (tint >> 11) & 31, (tint >> 5) & 63, tint & 31
+	r = nr + ((tr - nr) * alpha + 7) // ALPHA_LEVELS
+	g = ng + ((tg - ng) * alpha + 7) // ALPHA_LEVELS
+	b = nb + ((tb - nb) * alpha + 7) // ALPHA_LEVELS
+	return (r << 11) | (g << 5) | b
+
+
+def channel_error(a, b):
+	# Largest difference in any one channel, in RGB565 steps
+	return max(abs(((a >> 11) & 31) - ((b >> 11) & 31)), abs(((a >> 5) & 63) - ((b >> 5) & 63)), abs((a & 31) - (b & 31)))
+
+
+def split_variants(names, icons):
+	"""Find the tint of each variant, then a neutral colour and tint strength per pixel."""
+
+	images = [icons[n] for n in names]
+
+	# The tint is the commonest colour among the pixels that differ between variants
+
+	differ = [i for i in range(len(images[0])) if len({img[i] for img in images}) > 1]
+	tints = []
+	for img in images:
+		counts = {}
+		for i in differ:
+			counts[img[i]] = counts.get(img[i], 0) + 1
+		tints.append(max(counts, key=counts.get))
+
+	trgb = [to_rgb(t) for t in tints]
+	entries = []
+	worst = 0
+
+	for i in range(len(images[0])):
+
+		colours = [img[i] for img in images]
+
+		if len(set(colours)) == 1:
+			entries.append((colours[0], 0))
+			continue
+
+		# pixel = neutral + a * (tint - neutral), the difference between two variants gives a
+
+		prgb = [to_rgb(c) for c in colours]
+		num = den = 0.0
+		for j in range(1, len(images)):
+			for k in range(3):
+				dp = prgb[0][k] - prgb[j][k]
+				dt = trgb[0][k] - trgb[j][k]
+				num += dp * dt
+				den += dt * dt
+		a = min(max(num / den if den else 0.0, 0.0), 1.0)
+
+		best = None
+		for level in range(1, ALPHA_LEVELS + 1):
+			af = level / ALPHA_LEVELS
+			if af < 1.0:
+				n = [sum((prgb[j][k] - af * trgb[j][k]) / (1 - af) for j in range(len(images))) / len(images) for k in range(3)]
+				neutral = to_565(n)
+			else:
+				neutral = 0xFFFF
+			error = sum(abs(to_rgb(blend(neutral, tints[j], level))[k] - prgb[j][k]) for j in range(len(images)) for k in range(3))
+			if best is None or error < best[0]:
+				best = (error, neutral, level)
+
+		entries.append((best[1], best[2]))
+		worst = max(worst, best[0])
+
+	return entries, tints, worst
+
+
+def encode(entries):
+	"""Palette plus a byte stream of runs: 0x80 | (n - 1) then one index, or (n - 1) then n indices."""
+
+	palette = sorted(set(entries), key=lambda e: -entries.count(e))
+	lookup = {e: i for i, e in enumerate(palette)}
+	wide = len(palette) > 256
+	indices = [lookup[e] for e in entries]
+
+	def put(out, index):
+		if wide:
+			out.append(index >> 8)
+		out.append(index & 0xFF)
+
+	out = bytearray()
+	i = 0
+	literals = []
+
+	def flush():
+		while literals:
+			chunk = literals[:128]
+			del literals[:128]
+			out.append(len(chunk) - 1)
+			for index in chunk:
+				put(out, index)
+
+	while i < len(indices):
+		run = 1
+		while i + run < len(indices) and indices[i + run] == indices[i] and run < 128:
+			run += 1
+		if run >= 3 or (run == 2 and not literals):
+			flush()
+			out.append(0x80 | (run - 1))
+			put(out, indices[i])
+		else:
+			literals.extend(indices[i:i + run])
+		i += run
+	flush()
+
+	return palette, bytes(out), wide
+
+
+def decode(palette, data, wide, count, tint):
+	# Host copy of drawIcon(), used to check every asset round trips
+	pixels = []
+	i = 0
+	def index():
+		nonlocal i
+		if wide:
+			v = (data[i] << 8) | data[i + 1]
+			i += 2
+		else:
+			v = data[i]
+			i += 1
+		return v
+	while len(pixels) < count:
+		token = data[i]
+		i += 1
+		if token & 0x80:
+			colour, alpha = palette[index()]
+			pixels.extend([blend(colour, tint, alpha)] * ((token & 0x7F) + 1))
+		else:
+			for _ in range(token + 1):
+				colour, alpha = palette[index()]
+				pixels.append(blend(colour, tint, alpha))
+	return pixels
+
+
+def c_array(data, per_line, fmt):
+	lines = []
+	for i in range(0, len(data), per_line):
+		lines.append("\t" + ", ".join(fmt % v for v in data[i:i + per_line]) + ",")
+	return "\n".join(lines)
+
+
+def main():
+	icons = read_icons()
+
+	grouped = {n for names in VARIANTS.values() for n in names}
+	assets = []				# (data name, [(asset name, tint)], entries, width, height)
+
+	for base, names in VARIANTS.items():
+		entries, tints, worst = split_variants(names, icons)
+		width, height = size_of(names[0], icons[names[0]])
+		assets.append((base, list(zip(names, tints)), entries, width, height))
+		print("%-12s %d variants, worst channel error %.3f" % (base, len(names), worst))
+
+	for name, pixels in icons.items():
+		if name not in grouped:
+			width, height = size_of(name, pixels)
+			assets.append((name, [(name, 0)], [(c, 0) for c in pixels], width, height))
+
+	header = ["// iconAssets.h", "", "// Generated by tools/convertIcons.py from assets/, do not edit", "",
+		"#ifndef _ICONASSETS_h", "#define _ICONASSETS_h", "", "#include \"drawBitmap.h\"", "",
+		"/*---------------------------------------------------------------- */", ""]
+	source = ["//", "// iconAssets.cpp", "//", "", "// Generated by tools/convertIcons.py from assets/, do not edit", "",
+		"#include \"iconAssets.h\"", "", "/*---------------------------------------------------------------- */", ""]
+
+	raw_total = packed_total = 0
+
+	for base, variants, entries, width, height in assets:
+
+		palette, data, wide = encode(entries)
+
+		for name, tint in variants:
+			original = icons[name]
+			decoded = decode(palette, data, wide, width * height, tint)
+			if base not in VARIANTS:
+				assert decoded == original, name
+			else:
+				steps = max(channel_error(d, o) for d, o in zip(decoded, original))
+				print("%-12s worst channel %d RGB565 steps" % (name, steps))
+				assert steps <= TINT_TOLERANCE, name
+
+		tinted = any(alpha for _, alpha in palette)
+
+		source.append("static const uint16_t %sPalette[] = {" % base)
+		source.append(c_array([c for c, _ in palette], 12, "0x%04x"))
+		source.append("};")
+		source.append("")
+		if tinted:
+			source.append("static const uint8_t %sTint[] = {" % base)
+			source.append(c_array([a for _, a in palette], 24, "%d"))
+			source.append("};")
+			source.append("")
+		source.append("static const uint8_t %sData[] = {" % base)
+		source.append(c_array(list(data), 24, "0x%02x"))
+		source.append("};")
+		source.append("")
+
+		for name, tint in variants:
+			source.append("const iconAsset %s = { %d, %d, %sPalette, %s, %sData, %s, 0x%04x };" % (
+				name, width, height, base, base + "Tint" if tinted else "nullptr", base, "true" if wide else "false", tint))
+			header.append("extern const iconAsset %s;" % name)
+		source.append("")
+		source.append("/*---------------------------------------------------------------- */")
+		source.append("")
+
+		raw = sum(len(icons[n]) * 2 for n, _ in variants)
+		packed = len(palette) * (3 if tinted else 2) + len(data)
+		raw_total += raw
+		packed_total += packed
+		print("%-16s %6d -> %6d bytes" % (base, raw, packed))
+
+	header += ["", "#endif", ""]
+
+	open(HEADER, "w", newline="\n").write("\n".join(header))
+	open(SOURCE, "w", newline="\n").write("\n".join(source))
+
+	print("total %d -> %d bytes" % (raw_total, packed_total))
+
+
+if __name__ == "__main__":
+	main()
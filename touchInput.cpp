@@ -0,0 +1,208 @@
+//
+// touchInput.cpp
+//
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "touchInput.h"
+#include "spiBus.h"					// Shared SPI bus
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+static int penIrqPin = -1;							// XPT2046 PENIRQ, low while the screen is touched
+static volatile bool penIrq = false;				// Set by the interrupt, cleared once the controller has been read
+
+static unsigned long lastSample = 0;				// When the controller was last read
+static unsigned long pressStart = 0;				// When the current press was reported
+
+static bool pressed = false;						// A press has been reported and not yet released
+static bool longPressSent = false;					// This press has already been reported as long
+static uint8_t touchedCount = 0;					// Touched reads in a row
+static uint8_t releaseCount = 0;					// Untouched reads in a row while pressed
+
+static uint32_t sumX = 0;							// Running total of the reads making up the press
+static uint32_t sumY = 0;
+static uint16_t touchX = 0;							// Filtered position
+static uint16_t touchY = 0;
+
+static touchEvent touchQueue[touchQueueSize];
+
+static const uint32_t touchMask = touchQueueSize - 1;
+
+static uint32_t touchHead = 0;						// Both ends are only used from loop()
+static uint32_t touchTail = 0;
+
+/*---------------------------------------------------------------- */
+
+// Pen down
+
+static void IRAM_ATTR handlePenIrq() {
+
+	penIrq = true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Add an event, the newest is lost when the UI has fallen this far behind
+
+static void pushTouch(touchEventType type) {
+
+	if (touchHead - touchTail >= touchQueueSize) {
+
+		outputDebugLn("Touch queue full, event dropped");
+
+		return;
+	}
+
+	touchQueue[touchHead & touchMask] = { type, touchX, touchY };
+	touchHead++;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Start touch input
+
+void beginTouchInput(int irqPin) {
+
+	penIrqPin = irqPin;
+
+	if (penIrqPin >= 0) {
+
+		pinMode(penIrqPin, INPUT_PULLUP);
+		attachInterrupt(digitalPinToInterrupt(penIrqPin), handlePenIrq, FALLING);
+
+	}
+
+	outputDebug("Touch input, PENIRQ pin: ");
+	outputDebugLn(penIrqPin);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Read the touch controller when there may be something to read
+
+void pollTouchInput() {
+
+	unsigned long now = millis();
+
+	if (now - lastSample < touchSampleInterval) return;
+
+	// With PENIRQ fitted the bus is left alone until the pen goes down. The level is checked
+	// too, as the line also moves while the controller is being read and an edge can be missed.
+
+	if (penIrqPin >= 0 && !pressed && touchedCount == 0) {
+
+		if (!penIrq && digitalRead(penIrqPin) == HIGH) return;
+
+	}
+
+	penIrq = false;
+	lastSample = now;
+
+	uint16_t x, y;
+
+	busAcquire(busTouch);
+
+	bool touched = tft.getTouch(&x, &y);
+
+	busRelease(busTouch);
+
+	if (touched) {
+
+		releaseCount = 0;
+
+		if (!pressed) {
+
+			// Average the reads that make up the press
+
+			if (touchedCount == 0) {
+				sumX = 0;
+				sumY = 0;
+			}
+
+			sumX += x;
+			sumY += y;
+			touchedCount++;
+
+			if (touchedCount >= touchPressSamples) {
+
+				touchX = sumX / touchedCount;
+				touchY = sumY / touchedCount;
+
+				pressed = true;
+				longPressSent = false;
+				pressStart = now;
+
+				pushTouch(touchPress);
+			}
+		}
+
+		else {
+
+			// Follow the pen while held, weighted to the last position to ride over noisy reads
+
+			touchX = (touchX * 3 + x) / 4;
+			touchY = (touchY * 3 + y) / 4;
+
+			if (!longPressSent && now - pressStart >= touchLongPressTime) {
+
+				longPressSent = true;
+
+				pushTouch(touchLongPress);
+			}
+		}
+
+	}
+
+	else {
+
+		touchedCount = 0;
+
+		if (pressed && ++releaseCount >= touchReleaseSamples) {
+
+			pressed = false;
+			releaseCount = 0;
+
+			pushTouch(touchRelease);
+		}
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Take the oldest touch event
+
+bool nextTouchEvent(touchEvent& event) {
+
+	if (touchTail == touchHead) return false;
+
+	event = touchQueue[touchTail & touchMask];
+	touchTail++;
+
+	return true;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
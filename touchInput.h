@@ -0,0 +1,64 @@
+// touchInput.h
+
+#ifndef _TOUCHINPUT_h
+#define _TOUCHINPUT_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Main libraries
+
+#include <TFT_eSPI.h>				// TFT_eSPI library
+
+// Local declarations
+
+#include "global.h"
+
+/*---------------------------------------------------------------- */
+
+// Timing
+
+const unsigned long touchSampleInterval = 20;		// Time between touch controller reads, ms
+const unsigned long touchLongPressTime = 800;		// Held this long is a long press, ms
+
+const uint8_t touchPressSamples = 2;				// Touched reads in a row before a press is reported
+const uint8_t touchReleaseSamples = 3;				// Untouched reads in a row before a release is reported
+
+// Queue size
+
+const size_t touchQueueSize = 8;					// Events waiting for the UI, must be a power of two
+
+// Events
+
+enum touchEventType : uint8_t {
+	touchPress,
+	touchRelease,
+	touchLongPress
+};
+
+struct touchEvent {
+	touchEventType type;
+	uint16_t x;								// Screen position, averaged over the press
+	uint16_t y;
+};
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Start touch input, irqPin is the XPT2046 PENIRQ line or -1 to poll
+
+void beginTouchInput(int irqPin);
+
+// Read the touch controller when there may be something to read, call every time round loop()
+
+void pollTouchInput();
+
+// Take the oldest touch event
+
+bool nextTouchEvent(touchEvent& event);
+
+#endif
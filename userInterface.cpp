@@ -0,0 +1,366 @@
+//
+// userInterface.cpp
+//
+
+// Main libraries
+
+#include <SD.h>						// SD Card library
+
+// Local declarations
+
+#include "userInterface.h"
+#include "fileOperations.h"
+#include "parseDataReceived.h"
+#include "mainDisplay.h"
+#include "screenWidgets.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// Variables
+
+enum uiAction : uint8_t {			// What the open dialog is for
+	actionNone,
+	actionCategorise,
+	actionManualEntry,
+	actionDelete,
+	actionCopy
+};
+
+static uiState state = uiIdle;
+static uiAction action = actionNone;
+
+static unsigned long holdStart = 0;				// When the message went up
+static void (*afterHold)() = nullptr;			// Step to take once it has been up long enough
+
+/*---------------------------------------------------------------- */
+
+// Leave a message up for uiMessageTime, then take the next step
+
+static void holdThen(void (*next)()) {
+
+	holdStart = millis();
+	afterHold = next;
+	state = uiHold;
+
+} // Close function
+
+static void promptThen(const char* text, int cursorX, void (*next)()) {
+
+	showPrompt(text, cursorX);
+	holdThen(next);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Back to the main menu with the table reread
+
+static void finish() {
+
+	showMainMenu();
+
+	populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
+	redrawTable();
+
+	action = actionNone;
+	state = uiIdle;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Yes / No
+
+static void askConfirm() {
+
+	showPrompt("Are you sure?", 60);
+	showYesNo();
+
+	state = uiConfirm;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Category icons, the row to change or the prompt is already on screen
+
+static void askCategory() {
+
+	showCategoryMenu();
+
+	state = uiChooseCategory;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Yes was pressed
+
+static void confirmed() {
+
+	switch (action) {
+
+	case actionCategorise:
+
+		// Shows the row, or that there are none left
+
+		if (beginCategorise(SD, fileName)) askCategory();
+
+		else holdThen(finish);
+
+		break;
+
+	case actionManualEntry:
+
+		showPrompt("Select category", 50);
+		askCategory();
+
+		break;
+
+	case actionDelete:
+
+		deleteLastEntry(SD, fileName);
+
+		memset(dataEntries, 0, sizeof(dataEntries));
+
+		promptThen("Last entry deleted", 35, finish);
+
+		break;
+
+	case actionCopy:
+
+		showMainMenu();
+
+		if (beginDataCopy(SD, fileName)) state = uiCopying;
+
+		else promptThen("Abort copy / error", 40, finish);
+
+		break;
+
+	default:
+
+		finish();
+
+		break;
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// No was pressed
+
+static void declined() {
+
+	if (action == actionCopy) {
+
+		showMainMenu();
+
+		promptThen("Abort copy / error", 40, finish);
+
+	}
+
+	else finish();
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// A category button was pressed
+
+static void categoryChosen(char category) {
+
+	if (action == actionCategorise) {
+
+		applyCategory(SD, fileName, category);
+
+		finish();
+
+	}
+
+	else {
+
+		showMainMenu();
+
+		addManualEntry(SD, fileName, category);
+
+		populateArrayFromCSV(SD, fileName, dataEntries, maxEntries);
+		redrawTable();
+
+		promptThen("Manual entry added", 25, finish);
+
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Open a dialog from the main menu, the question stays up before Yes / No are offered
+
+static void startAction(uiAction next, const char* text, int cursorX) {
+
+	playTone(buzzerP, buzzerF, buzzerD);
+
+	action = next;
+
+	promptThen(text, cursorX, askConfirm);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// A new press
+
+bool uiTouch(uint16_t x, uint16_t y) {
+
+	screenButton button = buttonAt(x, y);
+
+	switch (state) {
+
+	case uiIdle:
+
+		if (button == button1) {
+
+			outputDebugLn("Button 1 pressed ");
+
+			startAction(actionCategorise, "Update categories?", 25);
+
+			return true;
+		}
+
+		if (button == button2) {
+
+			outputDebugLn("Button 2 pressed ");
+
+			startAction(actionManualEntry, "Add manual entry?", 33);
+
+			return true;
+		}
+
+		if (button == button3) {
+
+			outputDebugLn("Button 3 pressed ");
+
+			startAction(actionDelete, "Delete last entry?", 40);
+
+			return true;
+		}
+
+		if (statusIconAt(x, y) == sdCardStatus) {
+
+			outputDebugLn("SD Icon Pressed");
+
+			startAction(actionCopy, "Data file copy", 60);
+
+			return true;
+		}
+
+		return false;
+
+	case uiConfirm:
+
+		if (button == button3 || button == button4) {
+
+			playTone(buzzerP, buzzerF, buzzerD);
+
+			outputDebug("Button hit ");
+			outputDebugLn(button + 1);
+
+			hideYesNo();
+
+			if (button == button3) confirmed();
+
+			else declined();
+
+			return true;
+		}
+
+		return false;
+
+	case uiChooseCategory:
+
+		if (button < buttonCount) {
+
+			static const char categories[buttonCount] = { 'P', 'A', 'F', 'O' };
+
+			playTone(buzzerP, buzzerF, buzzerD);
+
+			outputDebug("Category chosen ");
+			outputDebugLn(categories[button]);
+
+			categoryChosen(categories[button]);
+
+			return true;
+		}
+
+		return false;
+
+	default:
+
+		return false;		// Messages and the copy ignore presses
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Move the current dialog on
+
+void uiTick() {
+
+	switch (state) {
+
+	case uiHold:
+
+		if (millis() - holdStart >= uiMessageTime) {
+
+			void (*next)() = afterHold;
+			afterHold = nullptr;
+
+			next();
+		}
+
+		break;
+
+	case uiCopying:
+
+		{
+			copyStatus status = dataCopyStep();
+
+			if (status == copyDone) promptThen("Data file copied", 50, finish);
+
+			else if (status == copyFailed) promptThen("Abort copy / error", 40, finish);
+		}
+
+		break;
+
+	default:
+
+		break;
+	}
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Current state
+
+uiState uiCurrentState() {
+
+	return state;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
@@ -0,0 +1,48 @@
+// userInterface.h
+
+#ifndef _USERINTERFACE_h
+#define _USERINTERFACE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Local declarations
+
+#include "global.h"
+#include "screenLayout.h"			// Screen layout
+
+/*---------------------------------------------------------------- */
+
+// Menus and dialogs run a step at a time from loop(), nothing here waits, so serial ingest,
+// the sensor check and the web server keep running while a dialog is open.
+
+enum uiState : uint8_t {
+	uiIdle,							// Main menu, waiting for a button
+	uiHold,							// Message on screen, waiting for its time to pass
+	uiConfirm,						// Yes / No on buttons three and four
+	uiChooseCategory,				// Category icons on all four buttons
+	uiCopying						// Data file copy, one buffer per tick
+};
+
+const unsigned long uiMessageTime = 1500;		// How long prompts and results stay up
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// A new press at x, y, true when it was on something the current screen uses
+
+bool uiTouch(uint16_t x, uint16_t y);
+
+// Move the current dialog on, call every time round loop()
+
+void uiTick();
+
+// Current state
+
+uiState uiCurrentState();
+
+#endif
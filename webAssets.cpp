@@ -0,0 +1,190 @@
+//
+// webAssets.cpp
+//
+
+// Main libraries
+
+#include <FS.h>						// Files system library
+#include <ESPAsyncWebSrv.h>
+
+// Local declarations
+
+#include "webAssets.h"
+
+// Debug serial prints
+
+#define DEBUG 0
+
+#if DEBUG==1
+#define outputDebug(x); Serial.print(x);
+#define outputDebugLn(x); Serial.println(x);
+#else
+#define outputDebug(x);
+#define outputDebugLn(x);
+#endif
+
+/*---------------------------------------------------------------- */
+
+// File name
+
+const char* assetManifestName = "/assets.txt";		// name hash gzip, one file per line
+
+// Variables
+
+struct webAsset {							// One file from the manifest
+	char name[assetNameLength];				// File name, without the leading /
+	char hash[assetHashLength + 1];			// Content hash
+	bool gzip;								// name.gz is on the card as well
+};
+
+static webAsset assets[maxWebAssets];
+static uint8_t assetCount = 0;
+static fs::FS* assetFs = nullptr;
+
+/*---------------------------------------------------------------- */
+
+// Check a file name ends with ext
+
+static bool endsWith(const char* name, const char* ext) {
+
+	size_t length = strlen(name);
+	size_t extLength = strlen(ext);
+
+	return length >= extLength && strcmp(name + length - extLength, ext) == 0;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// MIME type from the file name
+
+static const char* contentType(const char* name) {
+
+	if (endsWith(name, ".html")) return "text/html";
+	if (endsWith(name, ".js")) return "application/javascript";
+	if (endsWith(name, ".css")) return "text/css";
+	if (endsWith(name, ".png")) return "image/png";
+	if (endsWith(name, ".ico")) return "image/x-icon";
+
+	return "text/plain";
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Send a file, gzipped if the browser takes it. A matching ETag gets a 304 and no file read at all.
+
+static void sendAsset(AsyncWebServerRequest* request, const webAsset& asset) {
+
+	bool gzip = asset.gzip && request->header("Accept-Encoding").indexOf("gzip") >= 0;
+
+	// Pages name the other files by hash so they must be checked every time, the rest never change
+
+	char cacheControl[48];
+
+	if (endsWith(asset.name, ".html")) snprintf(cacheControl, sizeof(cacheControl), "no-cache");
+	else snprintf(cacheControl, sizeof(cacheControl), "public, max-age=%lu, immutable", (unsigned long)assetMaxAge);
+
+	// The two encodings are different bytes, so they get different tags
+
+	char etag[assetHashLength + 8];
+	snprintf(etag, sizeof(etag), "\"%s%s\"", asset.hash, gzip ? "-gz" : "");
+
+	AsyncWebServerResponse* response;
+
+	if (request->header("If-None-Match").indexOf(etag) >= 0) {
+		response = request->beginResponse(304);
+	}
+
+	else {
+
+		char path[assetNameLength + 4];
+		snprintf(path, sizeof(path), "/%s%s", asset.name, gzip ? ".gz" : "");
+
+		response = request->beginResponse(*assetFs, path, contentType(asset.name));
+
+		// Gone from the card since start up, the library gives NULL rather than a 404
+
+		if (!response) {
+			outputDebug("Web asset missing: ");
+			outputDebugLn(path);
+			request->send(404);
+			return;
+		}
+
+		if (gzip) response->addHeader("Content-Encoding", "gzip");
+	}
+
+	response->addHeader("ETag", etag);
+	response->addHeader("Cache-Control", cacheControl);
+	response->addHeader("Vary", "Accept-Encoding");
+
+	request->send(response);
+
+} // Close function
+
+/*---------------------------------------------------------------- */
+
+// Add a route for each file in the manifest, returns false if there is no manifest
+
+bool serveAssets(AsyncWebServer& server, fs::FS& fs) {
+
+	File file = fs.open(assetManifestName, FILE_READ);
+
+	if (!file) {
+		outputDebugLn("No asset manifest, web files served as they are");
+		return false;
+	}
+
+	assetFs = &fs;
+	assetCount = 0;
+
+	while (file.available() && assetCount < maxWebAssets) {
+
+		String line = file.readStringUntil('\n');
+		webAsset& asset = assets[assetCount];
+		int gzip = 0;
+
+		// Format is name hash gzip, comments start with #
+
+		if (line.startsWith("#") || sscanf(line.c_str(), "%23s %8s %d", asset.name, asset.hash, &gzip) != 3) continue;
+
+		// A file the manifest lists but the card doesnt have is left to serveStatic(), which 404s it
+
+		char path[assetNameLength + 4];
+		snprintf(path, sizeof(path), "/%s", asset.name);
+
+		if (!fs.exists(path)) {
+			outputDebug("Web asset not on the card: ");
+			outputDebugLn(path);
+			continue;
+		}
+
+		strcat(path, ".gz");
+
+		asset.gzip = gzip != 0 && fs.exists(path);
+
+		uint8_t index = assetCount++;
+		String uri = String("/") + asset.name;
+
+		server.on(uri.c_str(), HTTP_GET, [index](AsyncWebServerRequest* request) {
+			sendAsset(request, assets[index]);
+			});
+
+		if (strcmp(asset.name, "index.html") == 0) {
+			server.on("/", HTTP_GET, [index](AsyncWebServerRequest* request) {
+				sendAsset(request, assets[index]);
+				});
+		}
+
+		outputDebug("Web asset: ");
+		outputDebugLn(uri);
+	}
+
+	file.close();
+
+	return assetCount > 0;
+
+} // Close function
+
+/*---------------------------------------------------------------- */
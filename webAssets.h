@@ -0,0 +1,37 @@
+// webAssets.h
+
+#ifndef _WEBASSETS_h
+#define _WEBASSETS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+// Main libraries
+
+#include <FS.h>						// Files system library
+#include <ESPAsyncWebSrv.h>
+
+/*---------------------------------------------------------------- */
+
+// Web files listed by tools/compressAssets.py
+
+extern const char* assetManifestName;
+
+const uint8_t maxWebAssets = 16;			// Files the manifest can list
+const uint8_t assetNameLength = 24;			// Longest file name, without the leading /
+const uint8_t assetHashLength = 8;			// Hex digits of content hash, used as the ETag
+
+const uint32_t assetMaxAge = 31536000;		// Seconds a hashed file can be kept, pages are always revalidated
+
+/*---------------------------------------------------------------- */
+
+// Functions
+
+// Add a route for each file in the manifest, returns false if there is no manifest
+
+bool serveAssets(AsyncWebServer& server, fs::FS& fs);
+
+#endif
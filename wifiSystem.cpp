@@ -8,8 +8,7 @@
 #include <TFT_eSPI.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebSrv.h>
-#include <ArduinoJson.h>
-#include <ArduinoJson.hpp>
+#include <memory>
 
 // Local declarations
 
@@ -17,10 +16,15 @@
 #include "global.h"
 #include "fileOperations.h"
 #include "parseDataReceived.h"
+#include "binaryLog.h"
+#include "statsRollup.h"
+#include "webAssets.h"
 #include "screenLayout.h"
-#include "icons.h"
+#include "iconAssets.h"
 #include "drawBitmap.h"
 #include "mainDisplay.h"
+#include "screenWidgets.h"
+#include "spiBus.h"
 #include "Free_Fonts.h"
 
 // Debug serial prints
@@ -81,9 +85,28 @@ IPAddress dns1;
 AsyncWebServer server(80);			// Create AsyncWebServer object on port 80
 AsyncEventSource events("/events");	// Create an Event Source on /events
 
-// Json Variable to hold sensor readings
+// Readings document
 
-DynamicJsonDocument readings(1024);
+static const size_t readingsPieceSize = 640;			// Largest row, every field escaped at its widest
+
+struct readingsResponse {				// What one /readings response keeps between chunks
+	readingsSnapshot snapshot;
+	jsonCursor cursor;
+};
+
+// Live events, written by the loop task and read back by the web server task on reconnect
+
+struct webDelta {						// One change, formatted when it is sent
+	uint32_t id;						// SSE event id, one more than the last
+	webDeltaType type;
+	uint32_t row;						// Record number, or rows removed for a delete
+	bleSignal entry;					// New row, or just the category for a change
+};
+
+static webDelta deltaRing[webDeltaSlots];
+static uint32_t nextEventId = 1;		// Id the next event will carry
+static uint32_t webRows = 0;			// Rows in the log as the browser sees them
+static portMUX_TYPE deltaLock = portMUX_INITIALIZER_UNLOCKED;
 
 // Timer variables (check wifi).
 
@@ -94,6 +117,8 @@ volatile bool disWiFiF = false;				// Used in the sensor interrupt function to d
 unsigned long previousMillis = 0;			// Used in the WiFI Init function
 const long interval = 10000;				// Interval to wait for Wi-Fi connection (milliseconds)
 
+static void replayWebEvents(AsyncEventSourceClient* client);
+
 /*---------------------------------------------------------------- */
 
 void  checkWiFiReset(boolean& wiFiYN) {
@@ -128,12 +153,7 @@ void wiFiTitle() {
 
 	// WiFi title screen
 
-	tft.setFreeFont(&FreeSans9pt7b);
-	tft.setTextSize(1);
-	tft.setTextColor(BLACK);
-	tft.setCursor(13, 26);
-	tft.println("Setting up WiFi");
-	tft.setFreeFont();
+	setTitle("Setting up WiFi");
 
 	tft.setTextColor(BLACK);
 	tft.setFreeFont();
@@ -182,7 +202,7 @@ bool initWiFi() {
 
 	// If ESP32 inits successfully in station mode, recolour WiFi to red.
 
-	drawBitmap(tft, WIFI_ICON_Y, WIFI_ICON_X, wiFiRed, WIFI_ICON_W, WIFI_ICON_H);
+	setStatusIcon(wiFiStatus, wiFiRed);
 
 	// Check if settings are available to connect to WiFi.
 
@@ -207,7 +227,7 @@ bool initWiFi() {
 
 	// If ESP32 inits successfully in station mode, recolour WiFi to amber.
 
-	drawBitmap(tft, WIFI_ICON_Y, WIFI_ICON_X, wiFiAmber, WIFI_ICON_W, WIFI_ICON_H);
+	setStatusIcon(wiFiStatus, wiFiAmber);
 
 	unsigned long currentMillis = millis();
 	previousMillis = currentMillis;
@@ -217,7 +237,7 @@ bool initWiFi() {
 		if (currentMillis - previousMillis >= interval) {
 			outputDebugLn("Failed to connect.");
 			// If ESP32 fails to connect, recolour WiFi to red.
-			drawBitmap(tft, WIFI_ICON_Y, WIFI_ICON_X, wiFiRed, WIFI_ICON_W, WIFI_ICON_H);
+			setStatusIcon(wiFiStatus, wiFiRed);
 			drawWhiteBox();
 			return false;
 		}
@@ -289,7 +309,7 @@ bool initWiFi() {
 
 	// If ESP32 inits successfully in station mode, recolour WiFi to green.
 
-	drawBitmap(tft, WIFI_ICON_Y, WIFI_ICON_X, wiFiGreen, WIFI_ICON_W, WIFI_ICON_H);
+	setStatusIcon(wiFiStatus, wiFiGreen);
 
 	// Update message to advise unit is starting.
 
@@ -317,12 +337,16 @@ void initialiseWiFi() {
 
 	if (initWiFi()) {
 
-		// Handle the Web Server in Station Mode and route for root / web page
+		// Handle the Web Server in Station Mode and route for root / web page. Files listed by
+		// tools/compressAssets.py go out gzipped with ETags, anything else is sent as it is.
 
-		server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
+		if (!serveAssets(server, SPIFFS)) {
 
-			request->send(SPIFFS, "/index.html", "text/html");
-			});
+			server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
+
+				request->send(SPIFFS, "/index.html", "text/html");
+				});
+		}
 
 		server.serveStatic("/", SPIFFS, "/");
 
@@ -330,15 +354,136 @@ void initialiseWiFi() {
 
 		server.on("/readings", HTTP_GET, [](AsyncWebServerRequest* request) {
 
-			String json = getJSONReadings();
+			// The rows are copied once, so a detection arriving between chunks cant split the document.
+			// The copy is shared, so only a pointer is copied when the server takes the filler.
+
+			auto readings = std::make_shared<readingsResponse>();
+
+			takeReadingsSnapshot(readings->snapshot);
+
+			request->send(request->beginChunkedResponse("application/json", [readings](uint8_t* buffer, size_t maxLen, size_t /* index */) -> size_t {
+
+				return writeReadingsJSON((char*)buffer, maxLen, readings->snapshot, readings->cursor);		// 0 ends the response
+				}));
+			});
+
+#if BINARY_LOG
+
+		// Full history as CSV, rebuilt from the binary log a buffer at a time
+
+		server.on("/export.csv", HTTP_GET, [](AsyncWebServerRequest* request) {
+
+			exportCursor cursor;		// Where the export has got to, kept by the response between chunks
+
+			AsyncWebServerResponse* response = request->beginChunkedResponse("text/csv", [cursor](uint8_t* buffer, size_t maxLen, size_t /* index */) mutable -> size_t {
+
+				lockStorage();
+				size_t length = binaryLogExportCSV((char*)buffer, maxLen, cursor);
+				unlockStorage();
+
+				return length;			// 0 ends the response
+				});
+
+			response->addHeader("Content-Disposition", "attachment; filename=data.csv");
+			request->send(response);
+			});
+
+		// A page of the full history, newest first. from and to are DD-MM-YYYY and inclusive,
+		// category is one letter (M for manual entries), cursor is the value the last page ended with.
+
+		server.on("/history", HTTP_GET, [](AsyncWebServerRequest* request) {
+
+			historyQuery query;			// Where the page has got to, kept by the response between chunks
+
+			if (request->hasParam("to")) {
+				query.to = logEpoch(request->getParam("to")->value().c_str(), "23:59:59");
+			}
+
+			if (request->hasParam("from")) {
+				query.from = logEpoch(request->getParam("from")->value().c_str(), "00:00:00");
+			}
+
+			// A log in time order is searched for the range, otherwise the page walks back through
+			// every record checking dates, historyScanLimit keeps each page bounded
+
+			lockStorage();
+
+			query.next = binaryLogCount();
+
+			bool found = true;
+
+			if (binaryLogOrdered()) {
+				if (query.to) found = binaryLogFind(query.to + 1, query.next);
+				if (found && query.from) found = binaryLogFind(query.from, query.first);
+			}
+
+			unlockStorage();
+
+			if (!found) {
+				request->send(500, "application/json", "{\"error\":\"log read failed\"}");
+				return;
+			}
+
+			if (request->hasParam("cursor")) {
+				query.next = min(query.next, (uint32_t)strtoul(request->getParam("cursor")->value().c_str(), nullptr, 10));
+			}
+
+			if (request->hasParam("category")) {
+				query.category = toupper(request->getParam("category")->value()[0]);
+			}
+
+			if (request->hasParam("limit")) {
+				query.limit = constrain(request->getParam("limit")->value().toInt(), 1, historyMaxLimit);
+			}
+
+			request->send(request->beginChunkedResponse("application/json", [query](uint8_t* buffer, size_t maxLen, size_t /* index */) mutable -> size_t {
+
+				return writeHistoryJSON((char*)buffer, maxLen, query);		// 0 ends the response
+				}));
+			});
+
+		// Counts per category, per day for the last month and per hour for the last week
+
+		server.on("/stats", HTTP_GET, [](AsyncWebServerRequest* request) {
+
+			jsonCursor cursor;			// Where the document has got to, kept by the response between chunks
+
+			request->send(request->beginChunkedResponse("application/json", [cursor](uint8_t* buffer, size_t maxLen, size_t /* index */) mutable -> size_t {
+
+				return writeStatsJSON((char*)buffer, maxLen, cursor);		// 0 ends the response
+				}));
+			});
+
+#endif
+
+		// Shared SPI bus occupancy per device
+
+		server.on("/bus", HTTP_GET, [](AsyncWebServerRequest* request) {
+
+			char json[512];
+			size_t length = snprintf(json, sizeof(json), "{\"uptimeMs\":%lu", millis());
+
+			for (uint8_t i = 0; i < busDeviceCount; i++) {
+
+				busStats stats = busDeviceStats((busDevice)i);
+
+				length += snprintf(json + length, sizeof(json) - length,
+					",\"%s\":{\"clock\":%lu,\"batches\":%lu,\"busyUs\":%llu,\"waitUs\":%llu,\"longestUs\":%lu}",
+					busDeviceName((busDevice)i), (unsigned long)busClock((busDevice)i), (unsigned long)stats.acquisitions,
+					(unsigned long long)stats.busyMicros, (unsigned long long)stats.waitMicros, (unsigned long)stats.longestMicros);
+			}
+
+			snprintf(json + length, sizeof(json) - length, "}");
+
 			request->send(200, "application/json", json);
-			json = String();
 			});
 
+		// A reconnecting browser is sent whatever it missed, or told to reload if that has gone
+
 		events.onConnect([](AsyncEventSourceClient* client) {
 
 			if (client->lastId()) {
-				Serial.printf("Client reconnected! Last message ID that it got is: %u\n", client->lastId());
+				replayWebEvents(client);
 			}
 			});
 
@@ -368,7 +513,7 @@ void initialiseWiFi() {
 
 		// Initialize the ESP32 in Access Point mode, recolour to WiFI red
 
-		drawBitmap(tft, WIFI_ICON_Y, WIFI_ICON_X, wiFiRed, WIFI_ICON_W, WIFI_ICON_H);
+		setStatusIcon(wiFiStatus, wiFiRed);
 		delay(1000);
 
 		// Set Access Point
@@ -508,44 +653,542 @@ void initialiseWiFi() {
 
 /*-----------------------------------------------------------------*/
 
-// Return JSON String from sensor Readings
+// Copy text into a JSON string value, quotes, backslashes and control characters are escaped
+
+static size_t appendJSONString(char* out, size_t size, const char* text, size_t maxLength) {
+
+	static const char hex[] = "0123456789abcdef";
+
+	size_t used = 0;
+	size_t length = strnlen(text, maxLength);		// Fields are fixed width, never read past one
 
-String getJSONReadings() {
+	for (size_t i = 0; i < length && used + 6 < size; i++) {
 
-	// Get siren activity
+		unsigned char c = text[i];
 
-		DynamicJsonDocument doc(1024); // Adjust size as needed
-		JsonArray readings = doc.createNestedArray("readings");
+		if (c == '"' || c == '\\') {
+			out[used++] = '\\';
+			out[used++] = c;
+		}
 
-		for (int i = 0; i < 10; ++i) {
-			JsonObject entry = readings.createNestedObject();
-			entry["title"] = dataEntries[i].title;
-			entry["date"] = dataEntries[i].date;
-			entry["time"] = dataEntries[i].time;
-			entry["category"] = dataEntries[i].category;
-			entry["percentage"] = dataEntries[i].percentage;
+		else if (c < 0x20) {
+			memcpy(out + used, "\\u00", 4);
+			out[used + 4] = hex[c >> 4];
+			out[used + 5] = hex[c & 0x0F];
+			used += 6;
 		}
 
-		String jsonString;
-		serializeJson(doc, jsonString);
-		return jsonString;
+		else out[used++] = c;
+	}
 
-}  // Close function.
+	return used;
+
+} // Close function
 
 /*-----------------------------------------------------------------*/
 
-// Update webserver with latest events
+// Format the fields of one row, without the braces
 
-void updateWebServer() {
+static size_t entryFields(const bleSignal& entry, char* out, size_t size) {
 
-	String message = getJSONReadings();
+	size_t used = snprintf(out, size, "\"title\":\"");
 
-	outputDebugLn("");
-	outputDebug("New Readings: ");
-	outputDebug(message);
-	outputDebugLn("");
+	used += appendJSONString(out + used, size - used, entry.title, sizeof(entry.title));
+	used += snprintf(out + used, size - used, "\",\"date\":\"");
+	used += appendJSONString(out + used, size - used, entry.date, sizeof(entry.date));
+	used += snprintf(out + used, size - used, "\",\"time\":\"");
+	used += appendJSONString(out + used, size - used, entry.time, sizeof(entry.time));
+	used += snprintf(out + used, size - used, "\",\"category\":\"");
+	used += appendJSONString(out + used, size - used, entry.category, sizeof(entry.category));
+	used += snprintf(out + used, size - used, "\",\"percentage\":\"");
+	used += appendJSONString(out + used, size - used, entry.percentage, sizeof(entry.percentage));
+	used += snprintf(out + used, size - used, "\"");
+
+	return used;
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Format one piece of the readings document, the opening, a row or the close. The opening
+// carries the row count and last event id so the page can apply later events on top.
+
+static size_t readingsPiece(const void* source, uint8_t part, char* piece, size_t size) {
+
+	const readingsSnapshot& snapshot = *(const readingsSnapshot*)source;
+
+	if (part == 0) return snprintf(piece, size, "{\"rows\":%lu,\"eventId\":%lu,\"readings\":[", (unsigned long)snapshot.rows, (unsigned long)snapshot.eventId);
+
+	if (part > maxEntries) return snprintf(piece, size, "]}");
+
+	size_t used = snprintf(piece, size, "%s{", (part > 1) ? "," : "");
+
+	used += entryFields(snapshot.entries[part - 1], piece + used, size - used);
+	used += snprintf(piece + used, size - used, "}");
+
+	return used;
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Copy a document made of numbered pieces into buffer, carrying on from cursor. Returns the bytes
+// written, 0 once every piece is sent. Any buffer size works, a piece can be split across calls.
+
+typedef size_t (*jsonPiece)(const void* source, uint8_t part, char* piece, size_t size);
+
+static size_t writePieces(char* buffer, size_t size, jsonCursor& cursor, jsonPiece format, const void* source, uint16_t parts) {
+
+	char piece[readingsPieceSize];
+	size_t used = 0;
+
+	while (used < size && cursor.part < parts) {
+
+		size_t length = format(source, cursor.part, piece, sizeof(piece));
+		size_t count = min(length - cursor.offset, size - used);
+
+		memcpy(buffer + used, piece + cursor.offset, count);
+
+		used += count;
+		cursor.offset += count;
+
+		if (cursor.offset >= length) {
+			cursor.part++;
+			cursor.offset = 0;
+		}
+	}
+
+	return used;
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Copy the rows and the event position they match, at the start of a request
+
+void takeReadingsSnapshot(readingsSnapshot& snapshot) {
+
+	// Changes are stored and published under the storage lock, so the rows, the count and the
+	// event id all come from the same moment. The TFT table isnt used, it shows rows still queued.
+
+	lockStorage();
+
+#if BINARY_LOG
+	if (binaryLogReady()) binaryLogTail(snapshot.entries, maxEntries);
+	else memcpy(snapshot.entries, dataEntries, sizeof(snapshot.entries));
+#else
+	memcpy(snapshot.entries, dataEntries, sizeof(snapshot.entries));
+#endif
+
+	portENTER_CRITICAL(&deltaLock);
+	snapshot.rows = webRows;
+	snapshot.eventId = nextEventId - 1;
+	portEXIT_CRITICAL(&deltaLock);
+
+	unlockStorage();
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Write the readings document into buffer, carrying on from cursor
+
+size_t writeReadingsJSON(char* buffer, size_t size, const readingsSnapshot& snapshot, jsonCursor& cursor) {
+
+	return writePieces(buffer, size, cursor, readingsPiece, &snapshot, maxEntries + 2);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+#if BINARY_LOG
+
+// Check a record belongs in the page, M picks out manual entries
+
+static bool historyMatch(const binaryLogRecord& record, const historyQuery& query) {
+
+	if (query.from && record.epoch < query.from) return false;
+	if (query.to && record.epoch > query.to) return false;
+
+	if (query.category == 0 || record.category == query.category) return true;
+
+	return query.category == 'M' && (record.flags & logFlagManual);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Move the query down to the next record that belongs in the page, false once the page is full,
+// the range is used up or enough records have been looked at for one page
+
+static bool nextHistoryRecord(historyQuery& query, binaryLogRecord& record) {
+
+	while (query.sent < query.limit && query.next > query.first && query.scanned < historyScanLimit) {
+
+		if (binaryLogReadRecord(query.next - 1, record) && historyMatch(record, query)) return true;
+
+		query.next--;
+		query.scanned++;
+	}
+
+	return false;
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Write a page of history into buffer, carrying on from query. Returns the bytes written, 0 once
+// the page is complete. A row split across buffers is read again, the query only moves once it is sent.
+
+size_t writeHistoryJSON(char* buffer, size_t size, historyQuery& query) {
+
+	char piece[readingsPieceSize];
+	size_t used = 0;
+
+	lockStorage();
+
+	query.next = min(query.next, binaryLogCount());		// Rows deleted since the last buffer
+
+	while (used < size && query.part < 3) {
+
+		size_t length;
+
+		if (query.part == 0) {
+			length = snprintf(piece, sizeof(piece), "{\"readings\":[");
+		}
+
+		else if (query.part == 1) {
+
+			binaryLogRecord record;
+
+			if (!nextHistoryRecord(query, record)) {
+				query.part = 2;
+				continue;
+			}
+
+			bleSignal entry;
+			fromBinaryRecord(record, entry);
+
+			length = snprintf(piece, sizeof(piece), "%s{\"row\":%lu,", (query.sent > 0) ? "," : "", (unsigned long)(query.next - 1));
+			length += entryFields(entry, piece + length, sizeof(piece) - length);
+			length += snprintf(piece + length, sizeof(piece) - length, "}");
+		}
+
+		// The cursor is where the next page starts, null when there are no more
+
+		else if (query.next > query.first) {
+			length = snprintf(piece, sizeof(piece), "],\"cursor\":%lu}", (unsigned long)query.next);
+		}
+
+		else {
+			length = snprintf(piece, sizeof(piece), "],\"cursor\":null}");
+		}
+
+		size_t count = min(length - query.offset, size - used);
+
+		memcpy(buffer + used, piece + query.offset, count);
+
+		used += count;
+		query.offset += count;
+
+		if (query.offset >= length) {
+
+			if (query.part == 1) {
+				query.next--;
+				query.scanned++;
+				query.sent++;
+			}
+
+			else query.part++;
+
+			query.offset = 0;
+		}
+	}
+
+	unlockStorage();
+
+	return used;
+
+} // Close function
+
+#endif
+
+/*-----------------------------------------------------------------*/
+
+#if BINARY_LOG
+
+// Format the counts of one hour or day, with the average confidence
+
+static size_t bucketFields(const uint16_t* count, uint32_t confidence, char* out, size_t size) {
+
+	uint32_t rows = 0;
+	size_t used = 0;
+
+	for (uint8_t i = 0; i < statsCategories; i++) {
+		used += snprintf(out + used, size - used, "\"%c\":%u,", statsCategoryNames[i], count[i]);
+		rows += count[i];
+	}
+
+	used += snprintf(out + used, size - used, "\"count\":%lu,\"confidence\":%lu", (unsigned long)rows, (unsigned long)(rows ? confidence / rows : 0));
+
+	return used;
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Format one piece of the stats document. The opening holds the totals, then a piece for each
+// day of the month and each hour of the week ending at the newest record, oldest first.
+
+static const uint8_t statsDaysPart = 1;
+static const uint8_t statsHoursPart = statsDaysPart + statsDays + 1;
+static const uint16_t statsParts = statsHoursPart + statsHours + 1;
+
+static size_t statsPiece(const void* /* source */, uint8_t part, char* piece, size_t size) {
+
+	const statsRollup& rollup = statsData();
+
+	if (part == 0) {
+
+		size_t used = snprintf(piece, size, "{\"ready\":%s,\"records\":%lu,\"totals\":{",
+			statsReady() ? "true" : "false", (unsigned long)rollup.covered);
+
+		for (uint8_t i = 0; i < statsCategories; i++) {
+			used += snprintf(piece + used, size - used, "%s\"%c\":{\"count\":%lu,\"confidence\":%lu}", i ? "," : "",
+				statsCategoryNames[i], (unsigned long)rollup.totals[i].count,
+				(unsigned long)(rollup.totals[i].count ? rollup.totals[i].confidence / rollup.totals[i].count : 0));
+		}
+
+		return used + snprintf(piece + used, size - used, "},\"days\":[");
+	}
+
+	if (part == statsHoursPart - 1) return snprintf(piece, size, "],\"hours\":[");
+
+	if (part == statsParts - 1) return snprintf(piece, size, "]}");
+
+	// Nothing counted yet, the lists stay empty
+
+	if (rollup.newestHour == 0) return 0;
+
+	bool hourly = part >= statsHoursPart;
+	uint8_t slots = hourly ? statsHours : statsDays;
+	uint8_t position = part - (hourly ? statsHoursPart : statsDaysPart);
+	uint32_t key = (hourly ? rollup.newestHour : rollup.newestHour / 24) + 1 - slots + position;
+
+	const statsBucket& bucket = (hourly ? rollup.hours : rollup.days)[key % slots];
+	static const uint16_t none[statsCategories] = {};
+
+	time_t epoch = (time_t)key * (hourly ? 3600 : 86400);
+	struct tm timeinfo;
+
+	gmtime_r(&epoch, &timeinfo);
+
+	size_t used = snprintf(piece, size, "%s{\"%s\":\"%02d-%02d-%04d", position ? "," : "", hourly ? "hour" : "day",
+		timeinfo.tm_mday, timeinfo.tm_mon + 1, timeinfo.tm_year + 1900);
+
+	if (hourly) used += snprintf(piece + used, size - used, " %02d:00", timeinfo.tm_hour);
+
+	used += snprintf(piece + used, size - used, "\",");
+
+	// A slot still holding an older period counts as empty
+
+	if (bucket.key == key) used += bucketFields(bucket.count, bucket.confidence, piece + used, size - used);
+	else used += bucketFields(none, 0, piece + used, size - used);
+
+	return used + snprintf(piece + used, size - used, "}");
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Write the stats document into buffer, carrying on from cursor
+
+size_t writeStatsJSON(char* buffer, size_t size, jsonCursor& cursor) {
+
+	lockStorage();
+	size_t length = writePieces(buffer, size, cursor, statsPiece, nullptr, statsParts);		// statsPiece reads statsData() itself
+	unlockStorage();
+
+	return length;
+
+} // Close function
+
+#endif
+
+/*-----------------------------------------------------------------*/
+
+// Start numbering events, ids carry on from the clock so a browser open across a restart
+// never mistakes new events for ones it has already seen
+
+void beginWebEvents(uint32_t rows) {
+
+	time_t now = time(nullptr);
+
+	nextEventId = (now > 1600000000) ? (uint32_t)now : 1;
+	webRows = rows;
+
+} // Close function
 
-	events.send(message.c_str(), "new_readings", millis());
+/*-----------------------------------------------------------------*/
+
+// Format an event, returns its SSE event name
+
+static const char* formatDelta(const webDelta& delta, char* message, size_t size) {
+
+	switch (delta.type) {
+
+	case deltaInsert: {
+
+		size_t used = snprintf(message, size, "{\"row\":%lu,", (unsigned long)delta.row);
+
+		used += entryFields(delta.entry, message + used, size - used);
+		snprintf(message + used, size - used, "}");
+
+		return "insert";
+	}
+
+	case deltaCategory: {
+
+		size_t used = snprintf(message, size, "{\"row\":%lu,\"category\":\"", (unsigned long)delta.row);
+
+		used += appendJSONString(message + used, size - used, delta.entry.category, sizeof(delta.entry.category));
+		snprintf(message + used, size - used, "\"}");
+
+		return "category";
+	}
+
+	default:
+
+		snprintf(message, size, "{\"count\":%lu}", (unsigned long)delta.row);
+
+		return "delete";
+	}
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Keep an event for replay and send it to every open page
+
+static void publishDelta(webDelta& delta) {
+
+	portENTER_CRITICAL(&deltaLock);
+
+	delta.id = nextEventId++;
+	deltaRing[delta.id % webDeltaSlots] = delta;
+
+	portEXIT_CRITICAL(&deltaLock);
+
+	char message[readingsPieceSize];
+	const char* event = formatDelta(delta, message, sizeof(message));
+
+	outputDebug("Web event: ");
+	outputDebug(event);
+	outputDebug(" ");
+	outputDebugLn(message);
+
+	events.send(message, event, delta.id);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// A row was stored, row is its log record number or noLogRecord to place it after the last
+
+void publishInsert(const bleSignal& entry, uint32_t row) {
+
+	webDelta delta;
+
+	if (row == noLogRecord) row = webRows;
+
+	webRows = row + 1;
+
+	delta.type = deltaInsert;
+	delta.row = row;
+	delta.entry = entry;
+
+	publishDelta(delta);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// A row was categorised
+
+void publishCategory(uint32_t row, const char* category) {
+
+	webDelta delta = {};
+
+	delta.type = deltaCategory;
+	delta.row = row;
+	setField(delta.entry.category, category, category + strlen(category));
+
+	publishDelta(delta);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// The newest rows were removed
+
+void publishDelete(uint32_t count) {
+
+	webDelta delta = {};
+
+	count = min(count, webRows);
+	webRows -= count;
+
+	delta.type = deltaDelete;
+	delta.row = count;
+
+	publishDelta(delta);
+
+} // Close function
+
+/*-----------------------------------------------------------------*/
+
+// Send a reconnecting page the events after its last id. Ids from before a restart, or
+// older than the ring holds, get a reset so the page reloads the readings instead.
+
+static void replayWebEvents(AsyncEventSourceClient* client) {
+
+	uint32_t lastId = client->lastId();
+
+	portENTER_CRITICAL(&deltaLock);
+	uint32_t newest = nextEventId - 1;
+	portEXIT_CRITICAL(&deltaLock);
+
+	if (lastId >= newest) {
+		if (lastId > newest) client->send("{}", "reset", newest);
+		return;
+	}
+
+	if (newest - lastId > webDeltaSlots) {
+		client->send("{}", "reset", newest);
+		return;
+	}
+
+	char message[readingsPieceSize];
+
+	for (uint32_t id = lastId + 1; id <= newest; id++) {
+
+		webDelta delta;
+
+		portENTER_CRITICAL(&deltaLock);
+		delta = deltaRing[id % webDeltaSlots];
+		portEXIT_CRITICAL(&deltaLock);
+
+		// Overwritten while replaying, the page has to start again
+
+		if (delta.id != id) {
+			client->send("{}", "reset", newest);
+			return;
+		}
+
+		const char* event = formatDelta(delta, message, sizeof(message));
+
+		client->send(message, event, id);
+	}
 
 } // Close function
 
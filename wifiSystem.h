@@ -9,6 +9,8 @@
 	#include "WProgram.h"
 #endif
 
+#include "fileOperations.h"
+
 void checkWiFiReset(boolean& wiFiYN);
 
 void wiFiTitle();
@@ -17,9 +19,65 @@ bool initWiFi();
 
 void initialiseWiFi();
 
-String getJSONReadings();
+// Readings document, streamed a piece at a time from a copy taken when the request came in
+
+struct jsonCursor {					// Where a streamed document has got to
+	uint8_t part = 0;				// Opening, each row, then the close
+	uint16_t offset = 0;			// Bytes of that part already sent
+};
+
+struct readingsSnapshot {			// The rows one response sends, kept by it between chunks
+	uint32_t rows;					// Rows in the log as the browser sees them
+	uint32_t eventId;				// Last event the rows already include
+	bleSignal entries[maxEntries];
+};
+
+void takeReadingsSnapshot(readingsSnapshot& snapshot);
+
+size_t writeReadingsJSON(char* buffer, size_t size, const readingsSnapshot& snapshot, jsonCursor& cursor);
+
+size_t writeStatsJSON(char* buffer, size_t size, jsonCursor& cursor);
+
+// History pages, newest first, streamed a row at a time
+
+const uint16_t historyDefaultLimit = 50;	// Rows per page when none is asked for
+const uint16_t historyMaxLimit = 200;		// Most rows a page can ask for
+const uint32_t historyScanLimit = 2000;		// Records looked at per page, a rare category ends the page early
+
+struct historyQuery {				// One page of /history, kept by the response between chunks
+	uint32_t next = 0;				// One past the next record to look at, walks down to first
+	uint32_t first = 0;				// Oldest record in the range
+	uint32_t from = 0;				// Dates asked for as log times, 0 for none, checked on every record
+	uint32_t to = 0;				// so a log out of time order still pages right
+	uint32_t scanned = 0;			// Records looked at so far
+	uint16_t limit = historyDefaultLimit;
+	uint16_t sent = 0;				// Rows sent so far
+	char category = 0;				// Only rows of this category, 0 for all
+	uint8_t part = 0;				// Opening, the rows, then the close
+	uint16_t offset = 0;			// Bytes of that part already sent
+};
+
+size_t writeHistoryJSON(char* buffer, size_t size, historyQuery& query);
+
+// Changes pushed to the browser as they happen, each event carries the next id. Events are
+// published with the storage lock held, so a readings snapshot sees every change before its
+// event id and none after.
+
+const uint8_t webDeltaSlots = 16;		// Recent events kept for clients that reconnect
+
+enum webDeltaType {
+	deltaInsert,						// New row at the top of the table
+	deltaCategory,						// Row categorised
+	deltaDelete							// Newest rows removed
+};
+
+void beginWebEvents(uint32_t rows);
+
+void publishInsert(const bleSignal& entry, uint32_t row);
+
+void publishCategory(uint32_t row, const char* category);
 
-void updateWebServer();
+void publishDelete(uint32_t count);
 
 #endif
 